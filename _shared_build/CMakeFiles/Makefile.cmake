@@ -0,0 +1,183 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/lib/CMakeLists.txt"
+  "/root/repo/tests/CMakeLists.txt"
+  "/root/repo/tests/slicing/CMakeLists.txt"
+  "/root/repo/tools/CMakeLists.txt"
+  "/root/repo/tools/git-version.h.in"
+  "/usr/lib/cmake/Catch2/Catch2Config.cmake"
+  "/usr/lib/cmake/Catch2/Catch2ConfigVersion.cmake"
+  "/usr/lib/cmake/Catch2/Catch2Targets-none.cmake"
+  "/usr/lib/cmake/Catch2/Catch2Targets.cmake"
+  "/usr/lib/llvm-14/cmake/AddLLVM.cmake"
+  "/usr/lib/llvm-14/cmake/DetermineGCCCompatible.cmake"
+  "/usr/lib/llvm-14/cmake/FindFFI.cmake"
+  "/usr/lib/llvm-14/cmake/FindTerminfo.cmake"
+  "/usr/lib/llvm-14/cmake/LLVM-Config.cmake"
+  "/usr/lib/llvm-14/cmake/LLVMConfig.cmake"
+  "/usr/lib/llvm-14/cmake/LLVMConfigVersion.cmake"
+  "/usr/lib/llvm-14/cmake/LLVMDistributionSupport.cmake"
+  "/usr/lib/llvm-14/cmake/LLVMProcessSources.cmake"
+  "/usr/lib/llvm-14/lib/cmake/llvm/LLVM-Config.cmake"
+  "/usr/lib/llvm-14/lib/cmake/llvm/LLVMExports-release.cmake"
+  "/usr/lib/llvm-14/lib/cmake/llvm/LLVMExports.cmake"
+  "/usr/share/cmake-3.25/Modules/AddFileDependencies.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCheckCompilerFlagCommonPatterns.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseArguments.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePushCheckState.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CTest.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestUseLaunchers.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/DartConfiguration.tcl.in"
+  "/usr/share/cmake-3.25/Modules/FindGit.cmake"
+  "/usr/share/cmake-3.25/Modules/FindLibXml2.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPkgConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/FindZLIB.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckFlagCommonConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/ProcessorCount.cmake"
+  "/usr/share/cmake-3.25/Modules/SelectLibraryConfigurations.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "DartConfiguration.tcl"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lib/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/git-version.h"
+  "tools/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/slicing/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/Experimental.dir/DependInfo.cmake"
+  "CMakeFiles/Nightly.dir/DependInfo.cmake"
+  "CMakeFiles/Continuous.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemoryCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyStart.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyBuild.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyTest.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlySubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalStart.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalTest.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousStart.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousTest.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/intrinsics_gen.dir/DependInfo.cmake"
+  "CMakeFiles/omp_gen.dir/DependInfo.cmake"
+  "CMakeFiles/acc_gen.dir/DependInfo.cmake"
+  "lib/CMakeFiles/dganalysis.dir/DependInfo.cmake"
+  "lib/CMakeFiles/dgpta.dir/DependInfo.cmake"
+  "lib/CMakeFiles/dgdda.dir/DependInfo.cmake"
+  "lib/CMakeFiles/dgcda.dir/DependInfo.cmake"
+  "lib/CMakeFiles/dgsdg.dir/DependInfo.cmake"
+  "lib/CMakeFiles/dgvra.dir/DependInfo.cmake"
+  "lib/CMakeFiles/dgllvmpta.dir/DependInfo.cmake"
+  "lib/CMakeFiles/dgllvmforkjoin.dir/DependInfo.cmake"
+  "lib/CMakeFiles/dgllvmdda.dir/DependInfo.cmake"
+  "lib/CMakeFiles/dgllvmthreadregions.dir/DependInfo.cmake"
+  "lib/CMakeFiles/dgllvmcda.dir/DependInfo.cmake"
+  "lib/CMakeFiles/dgllvmdg.dir/DependInfo.cmake"
+  "lib/CMakeFiles/dgllvmvra.dir/DependInfo.cmake"
+  "lib/CMakeFiles/dgllvmsdg.dir/DependInfo.cmake"
+  "tools/CMakeFiles/llvm-dg-dump.dir/DependInfo.cmake"
+  "tools/CMakeFiles/dgllvmslicer.dir/DependInfo.cmake"
+  "tools/CMakeFiles/llvm-slicer.dir/DependInfo.cmake"
+  "tools/CMakeFiles/llvm-sdg-dump.dir/DependInfo.cmake"
+  "tools/CMakeFiles/llvm-cg-dump.dir/DependInfo.cmake"
+  "tools/CMakeFiles/llvm-cda-dump.dir/DependInfo.cmake"
+  "tools/CMakeFiles/llvm-cda-bench.dir/DependInfo.cmake"
+  "tools/CMakeFiles/llvm-cda-stress.dir/DependInfo.cmake"
+  "tools/CMakeFiles/llvm-pta-dump.dir/DependInfo.cmake"
+  "tools/CMakeFiles/llvm-pta-ben.dir/DependInfo.cmake"
+  "tools/CMakeFiles/llvm-pta-compare.dir/DependInfo.cmake"
+  "tools/CMakeFiles/llvm-dda-dump.dir/DependInfo.cmake"
+  "tools/CMakeFiles/llvm-vr-dump.dir/DependInfo.cmake"
+  "tools/CMakeFiles/llvm-to-source.dir/DependInfo.cmake"
+  "tools/CMakeFiles/llvm-thread-regions-dump.dir/DependInfo.cmake"
+  "tools/CMakeFiles/llvm-ntscd-dump.dir/DependInfo.cmake"
+  "tests/CMakeFiles/check.dir/DependInfo.cmake"
+  "tests/CMakeFiles/catch-main.dir/DependInfo.cmake"
+  "tests/CMakeFiles/points-to-test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/readwritegraph-test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/adt-test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/bitvector-test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/numbers-set-test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/points-to-set-test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/disjunctive-intervals-map-test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/nodes-walk-test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/cda-test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/thread-regions-test-file.dir/DependInfo.cmake"
+  "tests/CMakeFiles/thread-regions-test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/llvm-dg-test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/llvm-pta-update-test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/llvm-pta-stored-test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/llvm-cda-cache-test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/llvm-cda-update-test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/llvm-dda-test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/ptset-benchmark.dir/DependInfo.cmake"
+  "tests/CMakeFiles/memory-map-benchmark.dir/DependInfo.cmake"
+  "tests/CMakeFiles/interval-map-benchmark.dir/DependInfo.cmake"
+  "tests/CMakeFiles/value-relations-test.dir/DependInfo.cmake"
+  )
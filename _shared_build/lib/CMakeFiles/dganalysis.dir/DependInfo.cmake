@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/BBlockBase.cpp" "lib/CMakeFiles/dganalysis.dir/BBlockBase.cpp.o" "gcc" "lib/CMakeFiles/dganalysis.dir/BBlockBase.cpp.o.d"
+  "/root/repo/lib/Debug.cpp" "lib/CMakeFiles/dganalysis.dir/Debug.cpp.o" "gcc" "lib/CMakeFiles/dganalysis.dir/Debug.cpp.o.d"
+  "/root/repo/lib/Offset.cpp" "lib/CMakeFiles/dganalysis.dir/Offset.cpp.o" "gcc" "lib/CMakeFiles/dganalysis.dir/Offset.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
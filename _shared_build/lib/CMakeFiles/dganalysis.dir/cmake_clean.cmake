@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dganalysis.dir/BBlockBase.cpp.o"
+  "CMakeFiles/dganalysis.dir/BBlockBase.cpp.o.d"
+  "CMakeFiles/dganalysis.dir/Debug.cpp.o"
+  "CMakeFiles/dganalysis.dir/Debug.cpp.o.d"
+  "CMakeFiles/dganalysis.dir/Offset.cpp.o"
+  "CMakeFiles/dganalysis.dir/Offset.cpp.o.d"
+  "libdganalysis.pdb"
+  "libdganalysis.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dganalysis.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dgcda.dir/ControlDependence/NTSCD.cpp.o"
+  "CMakeFiles/dgcda.dir/ControlDependence/NTSCD.cpp.o.d"
+  "libdgcda.pdb"
+  "libdgcda.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dgcda.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
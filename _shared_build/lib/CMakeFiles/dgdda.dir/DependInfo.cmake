@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/MemorySSA/Definitions.cpp" "lib/CMakeFiles/dgdda.dir/MemorySSA/Definitions.cpp.o" "gcc" "lib/CMakeFiles/dgdda.dir/MemorySSA/Definitions.cpp.o.d"
+  "/root/repo/lib/MemorySSA/MemorySSA.cpp" "lib/CMakeFiles/dgdda.dir/MemorySSA/MemorySSA.cpp.o" "gcc" "lib/CMakeFiles/dgdda.dir/MemorySSA/MemorySSA.cpp.o.d"
+  "/root/repo/lib/MemorySSA/ModRef.cpp" "lib/CMakeFiles/dgdda.dir/MemorySSA/ModRef.cpp.o" "gcc" "lib/CMakeFiles/dgdda.dir/MemorySSA/ModRef.cpp.o.d"
+  "/root/repo/lib/MemorySSA/Summaries.cpp" "lib/CMakeFiles/dgdda.dir/MemorySSA/Summaries.cpp.o" "gcc" "lib/CMakeFiles/dgdda.dir/MemorySSA/Summaries.cpp.o.d"
+  "/root/repo/lib/ReadWriteGraph/ReadWriteGraph.cpp" "lib/CMakeFiles/dgdda.dir/ReadWriteGraph/ReadWriteGraph.cpp.o" "gcc" "lib/CMakeFiles/dgdda.dir/ReadWriteGraph/ReadWriteGraph.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_shared_build/lib/CMakeFiles/dganalysis.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
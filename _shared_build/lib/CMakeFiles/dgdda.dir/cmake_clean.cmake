@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dgdda.dir/MemorySSA/Definitions.cpp.o"
+  "CMakeFiles/dgdda.dir/MemorySSA/Definitions.cpp.o.d"
+  "CMakeFiles/dgdda.dir/MemorySSA/MemorySSA.cpp.o"
+  "CMakeFiles/dgdda.dir/MemorySSA/MemorySSA.cpp.o.d"
+  "CMakeFiles/dgdda.dir/MemorySSA/ModRef.cpp.o"
+  "CMakeFiles/dgdda.dir/MemorySSA/ModRef.cpp.o.d"
+  "CMakeFiles/dgdda.dir/MemorySSA/Summaries.cpp.o"
+  "CMakeFiles/dgdda.dir/MemorySSA/Summaries.cpp.o.d"
+  "CMakeFiles/dgdda.dir/ReadWriteGraph/ReadWriteGraph.cpp.o"
+  "CMakeFiles/dgdda.dir/ReadWriteGraph/ReadWriteGraph.cpp.o.d"
+  "libdgdda.pdb"
+  "libdgdda.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dgdda.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,31 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/llvm/ControlDependence/CDCache.cpp" "lib/CMakeFiles/dgllvmcda.dir/llvm/ControlDependence/CDCache.cpp.o" "gcc" "lib/CMakeFiles/dgllvmcda.dir/llvm/ControlDependence/CDCache.cpp.o.d"
+  "/root/repo/lib/llvm/ControlDependence/ControlDependence.cpp" "lib/CMakeFiles/dgllvmcda.dir/llvm/ControlDependence/ControlDependence.cpp.o" "gcc" "lib/CMakeFiles/dgllvmcda.dir/llvm/ControlDependence/ControlDependence.cpp.o.d"
+  "/root/repo/lib/llvm/ControlDependence/InterproceduralCD.cpp" "lib/CMakeFiles/dgllvmcda.dir/llvm/ControlDependence/InterproceduralCD.cpp.o" "gcc" "lib/CMakeFiles/dgllvmcda.dir/llvm/ControlDependence/InterproceduralCD.cpp.o.d"
+  "/root/repo/lib/llvm/ControlDependence/SCD.cpp" "lib/CMakeFiles/dgllvmcda.dir/llvm/ControlDependence/SCD.cpp.o" "gcc" "lib/CMakeFiles/dgllvmcda.dir/llvm/ControlDependence/SCD.cpp.o.d"
+  "/root/repo/lib/llvm/ControlDependence/legacy/Block.cpp" "lib/CMakeFiles/dgllvmcda.dir/llvm/ControlDependence/legacy/Block.cpp.o" "gcc" "lib/CMakeFiles/dgllvmcda.dir/llvm/ControlDependence/legacy/Block.cpp.o.d"
+  "/root/repo/lib/llvm/ControlDependence/legacy/Function.cpp" "lib/CMakeFiles/dgllvmcda.dir/llvm/ControlDependence/legacy/Function.cpp.o" "gcc" "lib/CMakeFiles/dgllvmcda.dir/llvm/ControlDependence/legacy/Function.cpp.o.d"
+  "/root/repo/lib/llvm/ControlDependence/legacy/GraphBuilder.cpp" "lib/CMakeFiles/dgllvmcda.dir/llvm/ControlDependence/legacy/GraphBuilder.cpp.o" "gcc" "lib/CMakeFiles/dgllvmcda.dir/llvm/ControlDependence/legacy/GraphBuilder.cpp.o.d"
+  "/root/repo/lib/llvm/ControlDependence/legacy/NTSCD.cpp" "lib/CMakeFiles/dgllvmcda.dir/llvm/ControlDependence/legacy/NTSCD.cpp.o" "gcc" "lib/CMakeFiles/dgllvmcda.dir/llvm/ControlDependence/legacy/NTSCD.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_shared_build/lib/CMakeFiles/dgcda.dir/DependInfo.cmake"
+  "/root/repo/_shared_build/lib/CMakeFiles/dgllvmforkjoin.dir/DependInfo.cmake"
+  "/root/repo/_shared_build/lib/CMakeFiles/dgllvmpta.dir/DependInfo.cmake"
+  "/root/repo/_shared_build/lib/CMakeFiles/dgpta.dir/DependInfo.cmake"
+  "/root/repo/_shared_build/lib/CMakeFiles/dganalysis.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
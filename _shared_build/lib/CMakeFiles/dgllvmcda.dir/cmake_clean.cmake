@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dgllvmcda.dir/llvm/ControlDependence/CDCache.cpp.o"
+  "CMakeFiles/dgllvmcda.dir/llvm/ControlDependence/CDCache.cpp.o.d"
+  "CMakeFiles/dgllvmcda.dir/llvm/ControlDependence/ControlDependence.cpp.o"
+  "CMakeFiles/dgllvmcda.dir/llvm/ControlDependence/ControlDependence.cpp.o.d"
+  "CMakeFiles/dgllvmcda.dir/llvm/ControlDependence/InterproceduralCD.cpp.o"
+  "CMakeFiles/dgllvmcda.dir/llvm/ControlDependence/InterproceduralCD.cpp.o.d"
+  "CMakeFiles/dgllvmcda.dir/llvm/ControlDependence/SCD.cpp.o"
+  "CMakeFiles/dgllvmcda.dir/llvm/ControlDependence/SCD.cpp.o.d"
+  "CMakeFiles/dgllvmcda.dir/llvm/ControlDependence/legacy/Block.cpp.o"
+  "CMakeFiles/dgllvmcda.dir/llvm/ControlDependence/legacy/Block.cpp.o.d"
+  "CMakeFiles/dgllvmcda.dir/llvm/ControlDependence/legacy/Function.cpp.o"
+  "CMakeFiles/dgllvmcda.dir/llvm/ControlDependence/legacy/Function.cpp.o.d"
+  "CMakeFiles/dgllvmcda.dir/llvm/ControlDependence/legacy/GraphBuilder.cpp.o"
+  "CMakeFiles/dgllvmcda.dir/llvm/ControlDependence/legacy/GraphBuilder.cpp.o.d"
+  "CMakeFiles/dgllvmcda.dir/llvm/ControlDependence/legacy/NTSCD.cpp.o"
+  "CMakeFiles/dgllvmcda.dir/llvm/ControlDependence/legacy/NTSCD.cpp.o.d"
+  "libdgllvmcda.pdb"
+  "libdgllvmcda.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dgllvmcda.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dgllvmdda.dir/llvm/DataDependenceAnalysis/LLVMDataDependenceAnalysis.cpp.o"
+  "CMakeFiles/dgllvmdda.dir/llvm/DataDependenceAnalysis/LLVMDataDependenceAnalysis.cpp.o.d"
+  "CMakeFiles/dgllvmdda.dir/llvm/ForkJoin/ForkJoin.cpp.o"
+  "CMakeFiles/dgllvmdda.dir/llvm/ForkJoin/ForkJoin.cpp.o.d"
+  "CMakeFiles/dgllvmdda.dir/llvm/ReadWriteGraph/Calls.cpp.o"
+  "CMakeFiles/dgllvmdda.dir/llvm/ReadWriteGraph/Calls.cpp.o.d"
+  "CMakeFiles/dgllvmdda.dir/llvm/ReadWriteGraph/Instructions.cpp.o"
+  "CMakeFiles/dgllvmdda.dir/llvm/ReadWriteGraph/Instructions.cpp.o.d"
+  "CMakeFiles/dgllvmdda.dir/llvm/ReadWriteGraph/LLVMReadWriteGraphBuilder.cpp.o"
+  "CMakeFiles/dgllvmdda.dir/llvm/ReadWriteGraph/LLVMReadWriteGraphBuilder.cpp.o.d"
+  "libdgllvmdda.pdb"
+  "libdgllvmdda.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dgllvmdda.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,32 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/llvm/DefUse/DefUse.cpp" "lib/CMakeFiles/dgllvmdg.dir/llvm/DefUse/DefUse.cpp.o" "gcc" "lib/CMakeFiles/dgllvmdg.dir/llvm/DefUse/DefUse.cpp.o.d"
+  "/root/repo/lib/llvm/Dominators/PostDominators.cpp" "lib/CMakeFiles/dgllvmdg.dir/llvm/Dominators/PostDominators.cpp.o" "gcc" "lib/CMakeFiles/dgllvmdg.dir/llvm/Dominators/PostDominators.cpp.o.d"
+  "/root/repo/lib/llvm/LLVMDGVerifier.cpp" "lib/CMakeFiles/dgllvmdg.dir/llvm/LLVMDGVerifier.cpp.o" "gcc" "lib/CMakeFiles/dgllvmdg.dir/llvm/LLVMDGVerifier.cpp.o.d"
+  "/root/repo/lib/llvm/LLVMDependenceGraph.cpp" "lib/CMakeFiles/dgllvmdg.dir/llvm/LLVMDependenceGraph.cpp.o" "gcc" "lib/CMakeFiles/dgllvmdg.dir/llvm/LLVMDependenceGraph.cpp.o.d"
+  "/root/repo/lib/llvm/LLVMNode.cpp" "lib/CMakeFiles/dgllvmdg.dir/llvm/LLVMNode.cpp.o" "gcc" "lib/CMakeFiles/dgllvmdg.dir/llvm/LLVMNode.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_shared_build/lib/CMakeFiles/dgllvmdda.dir/DependInfo.cmake"
+  "/root/repo/_shared_build/lib/CMakeFiles/dgllvmthreadregions.dir/DependInfo.cmake"
+  "/root/repo/_shared_build/lib/CMakeFiles/dgllvmcda.dir/DependInfo.cmake"
+  "/root/repo/_shared_build/lib/CMakeFiles/dgdda.dir/DependInfo.cmake"
+  "/root/repo/_shared_build/lib/CMakeFiles/dgllvmforkjoin.dir/DependInfo.cmake"
+  "/root/repo/_shared_build/lib/CMakeFiles/dgllvmpta.dir/DependInfo.cmake"
+  "/root/repo/_shared_build/lib/CMakeFiles/dgpta.dir/DependInfo.cmake"
+  "/root/repo/_shared_build/lib/CMakeFiles/dganalysis.dir/DependInfo.cmake"
+  "/root/repo/_shared_build/lib/CMakeFiles/dgcda.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
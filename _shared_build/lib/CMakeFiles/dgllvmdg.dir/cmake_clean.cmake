@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dgllvmdg.dir/llvm/DefUse/DefUse.cpp.o"
+  "CMakeFiles/dgllvmdg.dir/llvm/DefUse/DefUse.cpp.o.d"
+  "CMakeFiles/dgllvmdg.dir/llvm/Dominators/PostDominators.cpp.o"
+  "CMakeFiles/dgllvmdg.dir/llvm/Dominators/PostDominators.cpp.o.d"
+  "CMakeFiles/dgllvmdg.dir/llvm/LLVMDGVerifier.cpp.o"
+  "CMakeFiles/dgllvmdg.dir/llvm/LLVMDGVerifier.cpp.o.d"
+  "CMakeFiles/dgllvmdg.dir/llvm/LLVMDependenceGraph.cpp.o"
+  "CMakeFiles/dgllvmdg.dir/llvm/LLVMDependenceGraph.cpp.o.d"
+  "CMakeFiles/dgllvmdg.dir/llvm/LLVMNode.cpp.o"
+  "CMakeFiles/dgllvmdg.dir/llvm/LLVMNode.cpp.o.d"
+  "libdgllvmdg.pdb"
+  "libdgllvmdg.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dgllvmdg.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
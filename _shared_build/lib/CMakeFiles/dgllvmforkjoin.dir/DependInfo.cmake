@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/llvm/ForkJoin/ForkJoin.cpp" "lib/CMakeFiles/dgllvmforkjoin.dir/llvm/ForkJoin/ForkJoin.cpp.o" "gcc" "lib/CMakeFiles/dgllvmforkjoin.dir/llvm/ForkJoin/ForkJoin.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_shared_build/lib/CMakeFiles/dgllvmpta.dir/DependInfo.cmake"
+  "/root/repo/_shared_build/lib/CMakeFiles/dgpta.dir/DependInfo.cmake"
+  "/root/repo/_shared_build/lib/CMakeFiles/dganalysis.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dgllvmforkjoin.dir/llvm/ForkJoin/ForkJoin.cpp.o"
+  "CMakeFiles/dgllvmforkjoin.dir/llvm/ForkJoin/ForkJoin.cpp.o.d"
+  "libdgllvmforkjoin.pdb"
+  "libdgllvmforkjoin.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dgllvmforkjoin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,33 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/llvm/PointerAnalysis/Block.cpp" "lib/CMakeFiles/dgllvmpta.dir/llvm/PointerAnalysis/Block.cpp.o" "gcc" "lib/CMakeFiles/dgllvmpta.dir/llvm/PointerAnalysis/Block.cpp.o.d"
+  "/root/repo/lib/llvm/PointerAnalysis/Calls.cpp" "lib/CMakeFiles/dgllvmpta.dir/llvm/PointerAnalysis/Calls.cpp.o" "gcc" "lib/CMakeFiles/dgllvmpta.dir/llvm/PointerAnalysis/Calls.cpp.o.d"
+  "/root/repo/lib/llvm/PointerAnalysis/Constants.cpp" "lib/CMakeFiles/dgllvmpta.dir/llvm/PointerAnalysis/Constants.cpp.o" "gcc" "lib/CMakeFiles/dgllvmpta.dir/llvm/PointerAnalysis/Constants.cpp.o.d"
+  "/root/repo/lib/llvm/PointerAnalysis/Globals.cpp" "lib/CMakeFiles/dgllvmpta.dir/llvm/PointerAnalysis/Globals.cpp.o" "gcc" "lib/CMakeFiles/dgllvmpta.dir/llvm/PointerAnalysis/Globals.cpp.o.d"
+  "/root/repo/lib/llvm/PointerAnalysis/Instructions.cpp" "lib/CMakeFiles/dgllvmpta.dir/llvm/PointerAnalysis/Instructions.cpp.o" "gcc" "lib/CMakeFiles/dgllvmpta.dir/llvm/PointerAnalysis/Instructions.cpp.o.d"
+  "/root/repo/lib/llvm/PointerAnalysis/Interprocedural.cpp" "lib/CMakeFiles/dgllvmpta.dir/llvm/PointerAnalysis/Interprocedural.cpp.o" "gcc" "lib/CMakeFiles/dgllvmpta.dir/llvm/PointerAnalysis/Interprocedural.cpp.o.d"
+  "/root/repo/lib/llvm/PointerAnalysis/PointerAnalysis.cpp" "lib/CMakeFiles/dgllvmpta.dir/llvm/PointerAnalysis/PointerAnalysis.cpp.o" "gcc" "lib/CMakeFiles/dgllvmpta.dir/llvm/PointerAnalysis/PointerAnalysis.cpp.o.d"
+  "/root/repo/lib/llvm/PointerAnalysis/PointerGraph.cpp" "lib/CMakeFiles/dgllvmpta.dir/llvm/PointerAnalysis/PointerGraph.cpp.o" "gcc" "lib/CMakeFiles/dgllvmpta.dir/llvm/PointerAnalysis/PointerGraph.cpp.o.d"
+  "/root/repo/lib/llvm/PointerAnalysis/PointerGraphValidator.cpp" "lib/CMakeFiles/dgllvmpta.dir/llvm/PointerAnalysis/PointerGraphValidator.cpp.o" "gcc" "lib/CMakeFiles/dgllvmpta.dir/llvm/PointerAnalysis/PointerGraphValidator.cpp.o.d"
+  "/root/repo/lib/llvm/PointerAnalysis/StoredPointerAnalysis.cpp" "lib/CMakeFiles/dgllvmpta.dir/llvm/PointerAnalysis/StoredPointerAnalysis.cpp.o" "gcc" "lib/CMakeFiles/dgllvmpta.dir/llvm/PointerAnalysis/StoredPointerAnalysis.cpp.o.d"
+  "/root/repo/lib/llvm/PointerAnalysis/Structure.cpp" "lib/CMakeFiles/dgllvmpta.dir/llvm/PointerAnalysis/Structure.cpp.o" "gcc" "lib/CMakeFiles/dgllvmpta.dir/llvm/PointerAnalysis/Structure.cpp.o.d"
+  "/root/repo/lib/llvm/PointerAnalysis/Threads.cpp" "lib/CMakeFiles/dgllvmpta.dir/llvm/PointerAnalysis/Threads.cpp.o" "gcc" "lib/CMakeFiles/dgllvmpta.dir/llvm/PointerAnalysis/Threads.cpp.o.d"
+  "/root/repo/lib/llvm/PointerAnalysis/Update.cpp" "lib/CMakeFiles/dgllvmpta.dir/llvm/PointerAnalysis/Update.cpp.o" "gcc" "lib/CMakeFiles/dgllvmpta.dir/llvm/PointerAnalysis/Update.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_shared_build/lib/CMakeFiles/dgpta.dir/DependInfo.cmake"
+  "/root/repo/_shared_build/lib/CMakeFiles/dganalysis.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
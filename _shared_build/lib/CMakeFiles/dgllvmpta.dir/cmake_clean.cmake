@@ -0,0 +1,35 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dgllvmpta.dir/llvm/PointerAnalysis/Block.cpp.o"
+  "CMakeFiles/dgllvmpta.dir/llvm/PointerAnalysis/Block.cpp.o.d"
+  "CMakeFiles/dgllvmpta.dir/llvm/PointerAnalysis/Calls.cpp.o"
+  "CMakeFiles/dgllvmpta.dir/llvm/PointerAnalysis/Calls.cpp.o.d"
+  "CMakeFiles/dgllvmpta.dir/llvm/PointerAnalysis/Constants.cpp.o"
+  "CMakeFiles/dgllvmpta.dir/llvm/PointerAnalysis/Constants.cpp.o.d"
+  "CMakeFiles/dgllvmpta.dir/llvm/PointerAnalysis/Globals.cpp.o"
+  "CMakeFiles/dgllvmpta.dir/llvm/PointerAnalysis/Globals.cpp.o.d"
+  "CMakeFiles/dgllvmpta.dir/llvm/PointerAnalysis/Instructions.cpp.o"
+  "CMakeFiles/dgllvmpta.dir/llvm/PointerAnalysis/Instructions.cpp.o.d"
+  "CMakeFiles/dgllvmpta.dir/llvm/PointerAnalysis/Interprocedural.cpp.o"
+  "CMakeFiles/dgllvmpta.dir/llvm/PointerAnalysis/Interprocedural.cpp.o.d"
+  "CMakeFiles/dgllvmpta.dir/llvm/PointerAnalysis/PointerAnalysis.cpp.o"
+  "CMakeFiles/dgllvmpta.dir/llvm/PointerAnalysis/PointerAnalysis.cpp.o.d"
+  "CMakeFiles/dgllvmpta.dir/llvm/PointerAnalysis/PointerGraph.cpp.o"
+  "CMakeFiles/dgllvmpta.dir/llvm/PointerAnalysis/PointerGraph.cpp.o.d"
+  "CMakeFiles/dgllvmpta.dir/llvm/PointerAnalysis/PointerGraphValidator.cpp.o"
+  "CMakeFiles/dgllvmpta.dir/llvm/PointerAnalysis/PointerGraphValidator.cpp.o.d"
+  "CMakeFiles/dgllvmpta.dir/llvm/PointerAnalysis/StoredPointerAnalysis.cpp.o"
+  "CMakeFiles/dgllvmpta.dir/llvm/PointerAnalysis/StoredPointerAnalysis.cpp.o.d"
+  "CMakeFiles/dgllvmpta.dir/llvm/PointerAnalysis/Structure.cpp.o"
+  "CMakeFiles/dgllvmpta.dir/llvm/PointerAnalysis/Structure.cpp.o.d"
+  "CMakeFiles/dgllvmpta.dir/llvm/PointerAnalysis/Threads.cpp.o"
+  "CMakeFiles/dgllvmpta.dir/llvm/PointerAnalysis/Threads.cpp.o.d"
+  "CMakeFiles/dgllvmpta.dir/llvm/PointerAnalysis/Update.cpp.o"
+  "CMakeFiles/dgllvmpta.dir/llvm/PointerAnalysis/Update.cpp.o.d"
+  "libdgllvmpta.pdb"
+  "libdgllvmpta.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dgllvmpta.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
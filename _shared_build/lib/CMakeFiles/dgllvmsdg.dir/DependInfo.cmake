@@ -0,0 +1,27 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/llvm/SystemDependenceGraph/Dependencies.cpp" "lib/CMakeFiles/dgllvmsdg.dir/llvm/SystemDependenceGraph/Dependencies.cpp.o" "gcc" "lib/CMakeFiles/dgllvmsdg.dir/llvm/SystemDependenceGraph/Dependencies.cpp.o.d"
+  "/root/repo/lib/llvm/SystemDependenceGraph/SystemDependenceGraph.cpp" "lib/CMakeFiles/dgllvmsdg.dir/llvm/SystemDependenceGraph/SystemDependenceGraph.cpp.o" "gcc" "lib/CMakeFiles/dgllvmsdg.dir/llvm/SystemDependenceGraph/SystemDependenceGraph.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_shared_build/lib/CMakeFiles/dgsdg.dir/DependInfo.cmake"
+  "/root/repo/_shared_build/lib/CMakeFiles/dgllvmdda.dir/DependInfo.cmake"
+  "/root/repo/_shared_build/lib/CMakeFiles/dgdda.dir/DependInfo.cmake"
+  "/root/repo/_shared_build/lib/CMakeFiles/dgllvmforkjoin.dir/DependInfo.cmake"
+  "/root/repo/_shared_build/lib/CMakeFiles/dgllvmpta.dir/DependInfo.cmake"
+  "/root/repo/_shared_build/lib/CMakeFiles/dgpta.dir/DependInfo.cmake"
+  "/root/repo/_shared_build/lib/CMakeFiles/dganalysis.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
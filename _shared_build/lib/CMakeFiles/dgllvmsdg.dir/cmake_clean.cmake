@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dgllvmsdg.dir/llvm/SystemDependenceGraph/Dependencies.cpp.o"
+  "CMakeFiles/dgllvmsdg.dir/llvm/SystemDependenceGraph/Dependencies.cpp.o.d"
+  "CMakeFiles/dgllvmsdg.dir/llvm/SystemDependenceGraph/SystemDependenceGraph.cpp.o"
+  "CMakeFiles/dgllvmsdg.dir/llvm/SystemDependenceGraph/SystemDependenceGraph.cpp.o.d"
+  "libdgllvmsdg.pdb"
+  "libdgllvmsdg.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dgllvmsdg.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
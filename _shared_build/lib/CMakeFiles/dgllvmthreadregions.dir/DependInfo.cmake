@@ -0,0 +1,43 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/llvm/ThreadRegions/Graphs/BlockGraph.cpp" "lib/CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Graphs/BlockGraph.cpp.o" "gcc" "lib/CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Graphs/BlockGraph.cpp.o.d"
+  "/root/repo/lib/llvm/ThreadRegions/Graphs/ControlFlowGraph.cpp" "lib/CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Graphs/ControlFlowGraph.cpp.o" "gcc" "lib/CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Graphs/ControlFlowGraph.cpp.o.d"
+  "/root/repo/lib/llvm/ThreadRegions/Graphs/CriticalSectionsBuilder.cpp" "lib/CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Graphs/CriticalSectionsBuilder.cpp.o" "gcc" "lib/CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Graphs/CriticalSectionsBuilder.cpp.o.d"
+  "/root/repo/lib/llvm/ThreadRegions/Graphs/FunctionGraph.cpp" "lib/CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Graphs/FunctionGraph.cpp.o" "gcc" "lib/CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Graphs/FunctionGraph.cpp.o.d"
+  "/root/repo/lib/llvm/ThreadRegions/Graphs/GraphBuilder.cpp" "lib/CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Graphs/GraphBuilder.cpp.o" "gcc" "lib/CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Graphs/GraphBuilder.cpp.o.d"
+  "/root/repo/lib/llvm/ThreadRegions/Graphs/ThreadRegionsBuilder.cpp" "lib/CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Graphs/ThreadRegionsBuilder.cpp.o" "gcc" "lib/CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Graphs/ThreadRegionsBuilder.cpp.o.d"
+  "/root/repo/lib/llvm/ThreadRegions/MayHappenInParallel.cpp" "lib/CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/MayHappenInParallel.cpp.o" "gcc" "lib/CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/MayHappenInParallel.cpp.o.d"
+  "/root/repo/lib/llvm/ThreadRegions/Nodes/CallFuncPtrNode.cpp" "lib/CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Nodes/CallFuncPtrNode.cpp.o" "gcc" "lib/CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Nodes/CallFuncPtrNode.cpp.o.d"
+  "/root/repo/lib/llvm/ThreadRegions/Nodes/CallNode.cpp" "lib/CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Nodes/CallNode.cpp.o" "gcc" "lib/CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Nodes/CallNode.cpp.o.d"
+  "/root/repo/lib/llvm/ThreadRegions/Nodes/CallReturnNode.cpp" "lib/CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Nodes/CallReturnNode.cpp.o" "gcc" "lib/CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Nodes/CallReturnNode.cpp.o.d"
+  "/root/repo/lib/llvm/ThreadRegions/Nodes/EntryNode.cpp" "lib/CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Nodes/EntryNode.cpp.o" "gcc" "lib/CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Nodes/EntryNode.cpp.o.d"
+  "/root/repo/lib/llvm/ThreadRegions/Nodes/ExitNode.cpp" "lib/CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Nodes/ExitNode.cpp.o" "gcc" "lib/CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Nodes/ExitNode.cpp.o.d"
+  "/root/repo/lib/llvm/ThreadRegions/Nodes/ForkNode.cpp" "lib/CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Nodes/ForkNode.cpp.o" "gcc" "lib/CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Nodes/ForkNode.cpp.o.d"
+  "/root/repo/lib/llvm/ThreadRegions/Nodes/GeneralNode.cpp" "lib/CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Nodes/GeneralNode.cpp.o" "gcc" "lib/CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Nodes/GeneralNode.cpp.o.d"
+  "/root/repo/lib/llvm/ThreadRegions/Nodes/JoinNode.cpp" "lib/CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Nodes/JoinNode.cpp.o" "gcc" "lib/CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Nodes/JoinNode.cpp.o.d"
+  "/root/repo/lib/llvm/ThreadRegions/Nodes/LockNode.cpp" "lib/CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Nodes/LockNode.cpp.o" "gcc" "lib/CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Nodes/LockNode.cpp.o.d"
+  "/root/repo/lib/llvm/ThreadRegions/Nodes/Node.cpp" "lib/CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Nodes/Node.cpp.o" "gcc" "lib/CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Nodes/Node.cpp.o.d"
+  "/root/repo/lib/llvm/ThreadRegions/Nodes/NodeIterator.cpp" "lib/CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Nodes/NodeIterator.cpp.o" "gcc" "lib/CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Nodes/NodeIterator.cpp.o.d"
+  "/root/repo/lib/llvm/ThreadRegions/Nodes/ReturnNode.cpp" "lib/CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Nodes/ReturnNode.cpp.o" "gcc" "lib/CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Nodes/ReturnNode.cpp.o.d"
+  "/root/repo/lib/llvm/ThreadRegions/Nodes/UnlockNode.cpp" "lib/CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Nodes/UnlockNode.cpp.o" "gcc" "lib/CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Nodes/UnlockNode.cpp.o.d"
+  "/root/repo/lib/llvm/ThreadRegions/ThreadRegion.cpp" "lib/CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/ThreadRegion.cpp.o" "gcc" "lib/CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/ThreadRegion.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_shared_build/lib/CMakeFiles/dgllvmforkjoin.dir/DependInfo.cmake"
+  "/root/repo/_shared_build/lib/CMakeFiles/dgllvmpta.dir/DependInfo.cmake"
+  "/root/repo/_shared_build/lib/CMakeFiles/dgpta.dir/DependInfo.cmake"
+  "/root/repo/_shared_build/lib/CMakeFiles/dganalysis.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
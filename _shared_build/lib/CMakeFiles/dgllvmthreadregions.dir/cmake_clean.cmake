@@ -0,0 +1,51 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Graphs/BlockGraph.cpp.o"
+  "CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Graphs/BlockGraph.cpp.o.d"
+  "CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Graphs/ControlFlowGraph.cpp.o"
+  "CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Graphs/ControlFlowGraph.cpp.o.d"
+  "CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Graphs/CriticalSectionsBuilder.cpp.o"
+  "CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Graphs/CriticalSectionsBuilder.cpp.o.d"
+  "CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Graphs/FunctionGraph.cpp.o"
+  "CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Graphs/FunctionGraph.cpp.o.d"
+  "CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Graphs/GraphBuilder.cpp.o"
+  "CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Graphs/GraphBuilder.cpp.o.d"
+  "CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Graphs/ThreadRegionsBuilder.cpp.o"
+  "CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Graphs/ThreadRegionsBuilder.cpp.o.d"
+  "CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/MayHappenInParallel.cpp.o"
+  "CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/MayHappenInParallel.cpp.o.d"
+  "CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Nodes/CallFuncPtrNode.cpp.o"
+  "CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Nodes/CallFuncPtrNode.cpp.o.d"
+  "CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Nodes/CallNode.cpp.o"
+  "CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Nodes/CallNode.cpp.o.d"
+  "CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Nodes/CallReturnNode.cpp.o"
+  "CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Nodes/CallReturnNode.cpp.o.d"
+  "CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Nodes/EntryNode.cpp.o"
+  "CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Nodes/EntryNode.cpp.o.d"
+  "CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Nodes/ExitNode.cpp.o"
+  "CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Nodes/ExitNode.cpp.o.d"
+  "CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Nodes/ForkNode.cpp.o"
+  "CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Nodes/ForkNode.cpp.o.d"
+  "CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Nodes/GeneralNode.cpp.o"
+  "CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Nodes/GeneralNode.cpp.o.d"
+  "CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Nodes/JoinNode.cpp.o"
+  "CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Nodes/JoinNode.cpp.o.d"
+  "CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Nodes/LockNode.cpp.o"
+  "CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Nodes/LockNode.cpp.o.d"
+  "CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Nodes/Node.cpp.o"
+  "CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Nodes/Node.cpp.o.d"
+  "CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Nodes/NodeIterator.cpp.o"
+  "CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Nodes/NodeIterator.cpp.o.d"
+  "CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Nodes/ReturnNode.cpp.o"
+  "CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Nodes/ReturnNode.cpp.o.d"
+  "CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Nodes/UnlockNode.cpp.o"
+  "CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/Nodes/UnlockNode.cpp.o.d"
+  "CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/ThreadRegion.cpp.o"
+  "CMakeFiles/dgllvmthreadregions.dir/llvm/ThreadRegions/ThreadRegion.cpp.o.d"
+  "libdgllvmthreadregions.pdb"
+  "libdgllvmthreadregions.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dgllvmthreadregions.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
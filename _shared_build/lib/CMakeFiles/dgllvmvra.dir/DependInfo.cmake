@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/llvm/ValueRelations/GraphBuilder.cpp" "lib/CMakeFiles/dgllvmvra.dir/llvm/ValueRelations/GraphBuilder.cpp.o" "gcc" "lib/CMakeFiles/dgllvmvra.dir/llvm/ValueRelations/GraphBuilder.cpp.o.d"
+  "/root/repo/lib/llvm/ValueRelations/GraphElements.cpp" "lib/CMakeFiles/dgllvmvra.dir/llvm/ValueRelations/GraphElements.cpp.o" "gcc" "lib/CMakeFiles/dgllvmvra.dir/llvm/ValueRelations/GraphElements.cpp.o.d"
+  "/root/repo/lib/llvm/ValueRelations/RelationsAnalyzer.cpp" "lib/CMakeFiles/dgllvmvra.dir/llvm/ValueRelations/RelationsAnalyzer.cpp.o" "gcc" "lib/CMakeFiles/dgllvmvra.dir/llvm/ValueRelations/RelationsAnalyzer.cpp.o.d"
+  "/root/repo/lib/llvm/ValueRelations/StructureAnalyzer.cpp" "lib/CMakeFiles/dgllvmvra.dir/llvm/ValueRelations/StructureAnalyzer.cpp.o" "gcc" "lib/CMakeFiles/dgllvmvra.dir/llvm/ValueRelations/StructureAnalyzer.cpp.o.d"
+  "/root/repo/lib/llvm/ValueRelations/ValueRelations.cpp" "lib/CMakeFiles/dgllvmvra.dir/llvm/ValueRelations/ValueRelations.cpp.o" "gcc" "lib/CMakeFiles/dgllvmvra.dir/llvm/ValueRelations/ValueRelations.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_shared_build/lib/CMakeFiles/dgvra.dir/DependInfo.cmake"
+  "/root/repo/_shared_build/lib/CMakeFiles/dganalysis.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
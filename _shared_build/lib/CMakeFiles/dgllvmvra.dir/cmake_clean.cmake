@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dgllvmvra.dir/llvm/ValueRelations/GraphBuilder.cpp.o"
+  "CMakeFiles/dgllvmvra.dir/llvm/ValueRelations/GraphBuilder.cpp.o.d"
+  "CMakeFiles/dgllvmvra.dir/llvm/ValueRelations/GraphElements.cpp.o"
+  "CMakeFiles/dgllvmvra.dir/llvm/ValueRelations/GraphElements.cpp.o.d"
+  "CMakeFiles/dgllvmvra.dir/llvm/ValueRelations/RelationsAnalyzer.cpp.o"
+  "CMakeFiles/dgllvmvra.dir/llvm/ValueRelations/RelationsAnalyzer.cpp.o.d"
+  "CMakeFiles/dgllvmvra.dir/llvm/ValueRelations/StructureAnalyzer.cpp.o"
+  "CMakeFiles/dgllvmvra.dir/llvm/ValueRelations/StructureAnalyzer.cpp.o.d"
+  "CMakeFiles/dgllvmvra.dir/llvm/ValueRelations/ValueRelations.cpp.o"
+  "CMakeFiles/dgllvmvra.dir/llvm/ValueRelations/ValueRelations.cpp.o.d"
+  "libdgllvmvra.pdb"
+  "libdgllvmvra.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dgllvmvra.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/PointerAnalysis/Pointer.cpp" "lib/CMakeFiles/dgpta.dir/PointerAnalysis/Pointer.cpp.o" "gcc" "lib/CMakeFiles/dgpta.dir/PointerAnalysis/Pointer.cpp.o.d"
+  "/root/repo/lib/PointerAnalysis/PointerAnalysis.cpp" "lib/CMakeFiles/dgpta.dir/PointerAnalysis/PointerAnalysis.cpp.o" "gcc" "lib/CMakeFiles/dgpta.dir/PointerAnalysis/PointerAnalysis.cpp.o.d"
+  "/root/repo/lib/PointerAnalysis/PointerAnalysisFI.cpp" "lib/CMakeFiles/dgpta.dir/PointerAnalysis/PointerAnalysisFI.cpp.o" "gcc" "lib/CMakeFiles/dgpta.dir/PointerAnalysis/PointerAnalysisFI.cpp.o.d"
+  "/root/repo/lib/PointerAnalysis/PointerAnalysisPFS.cpp" "lib/CMakeFiles/dgpta.dir/PointerAnalysis/PointerAnalysisPFS.cpp.o" "gcc" "lib/CMakeFiles/dgpta.dir/PointerAnalysis/PointerAnalysisPFS.cpp.o.d"
+  "/root/repo/lib/PointerAnalysis/PointerAnalysisSFS.cpp" "lib/CMakeFiles/dgpta.dir/PointerAnalysis/PointerAnalysisSFS.cpp.o" "gcc" "lib/CMakeFiles/dgpta.dir/PointerAnalysis/PointerAnalysisSFS.cpp.o.d"
+  "/root/repo/lib/PointerAnalysis/PointerGraph.cpp" "lib/CMakeFiles/dgpta.dir/PointerAnalysis/PointerGraph.cpp.o" "gcc" "lib/CMakeFiles/dgpta.dir/PointerAnalysis/PointerGraph.cpp.o.d"
+  "/root/repo/lib/PointerAnalysis/PointerGraphOptimizations.cpp" "lib/CMakeFiles/dgpta.dir/PointerAnalysis/PointerGraphOptimizations.cpp.o" "gcc" "lib/CMakeFiles/dgpta.dir/PointerAnalysis/PointerGraphOptimizations.cpp.o.d"
+  "/root/repo/lib/PointerAnalysis/PointerGraphTopoOrder.cpp" "lib/CMakeFiles/dgpta.dir/PointerAnalysis/PointerGraphTopoOrder.cpp.o" "gcc" "lib/CMakeFiles/dgpta.dir/PointerAnalysis/PointerGraphTopoOrder.cpp.o.d"
+  "/root/repo/lib/PointerAnalysis/PointerGraphValidator.cpp" "lib/CMakeFiles/dgpta.dir/PointerAnalysis/PointerGraphValidator.cpp.o" "gcc" "lib/CMakeFiles/dgpta.dir/PointerAnalysis/PointerGraphValidator.cpp.o.d"
+  "/root/repo/lib/PointerAnalysis/PointsToSet.cpp" "lib/CMakeFiles/dgpta.dir/PointerAnalysis/PointsToSet.cpp.o" "gcc" "lib/CMakeFiles/dgpta.dir/PointerAnalysis/PointsToSet.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_shared_build/lib/CMakeFiles/dganalysis.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,29 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dgpta.dir/PointerAnalysis/Pointer.cpp.o"
+  "CMakeFiles/dgpta.dir/PointerAnalysis/Pointer.cpp.o.d"
+  "CMakeFiles/dgpta.dir/PointerAnalysis/PointerAnalysis.cpp.o"
+  "CMakeFiles/dgpta.dir/PointerAnalysis/PointerAnalysis.cpp.o.d"
+  "CMakeFiles/dgpta.dir/PointerAnalysis/PointerAnalysisFI.cpp.o"
+  "CMakeFiles/dgpta.dir/PointerAnalysis/PointerAnalysisFI.cpp.o.d"
+  "CMakeFiles/dgpta.dir/PointerAnalysis/PointerAnalysisPFS.cpp.o"
+  "CMakeFiles/dgpta.dir/PointerAnalysis/PointerAnalysisPFS.cpp.o.d"
+  "CMakeFiles/dgpta.dir/PointerAnalysis/PointerAnalysisSFS.cpp.o"
+  "CMakeFiles/dgpta.dir/PointerAnalysis/PointerAnalysisSFS.cpp.o.d"
+  "CMakeFiles/dgpta.dir/PointerAnalysis/PointerGraph.cpp.o"
+  "CMakeFiles/dgpta.dir/PointerAnalysis/PointerGraph.cpp.o.d"
+  "CMakeFiles/dgpta.dir/PointerAnalysis/PointerGraphOptimizations.cpp.o"
+  "CMakeFiles/dgpta.dir/PointerAnalysis/PointerGraphOptimizations.cpp.o.d"
+  "CMakeFiles/dgpta.dir/PointerAnalysis/PointerGraphTopoOrder.cpp.o"
+  "CMakeFiles/dgpta.dir/PointerAnalysis/PointerGraphTopoOrder.cpp.o.d"
+  "CMakeFiles/dgpta.dir/PointerAnalysis/PointerGraphValidator.cpp.o"
+  "CMakeFiles/dgpta.dir/PointerAnalysis/PointerGraphValidator.cpp.o.d"
+  "CMakeFiles/dgpta.dir/PointerAnalysis/PointsToSet.cpp.o"
+  "CMakeFiles/dgpta.dir/PointerAnalysis/PointsToSet.cpp.o.d"
+  "libdgpta.pdb"
+  "libdgpta.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dgpta.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
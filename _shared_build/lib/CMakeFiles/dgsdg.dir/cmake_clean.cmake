@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dgsdg.dir/SystemDependenceGraph/DependenceGraph.cpp.o"
+  "CMakeFiles/dgsdg.dir/SystemDependenceGraph/DependenceGraph.cpp.o.d"
+  "libdgsdg.pdb"
+  "libdgsdg.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dgsdg.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dgvra.dir/ValueRelations/Relations.cpp.o"
+  "CMakeFiles/dgvra.dir/ValueRelations/Relations.cpp.o.d"
+  "libdgvra.pdb"
+  "libdgvra.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dgvra.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/adt-test.dir/adt-test.cpp.o"
+  "CMakeFiles/adt-test.dir/adt-test.cpp.o.d"
+  "adt-test"
+  "adt-test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/adt-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bitvector-test.dir/bitvector-test.cpp.o"
+  "CMakeFiles/bitvector-test.dir/bitvector-test.cpp.o.d"
+  "bitvector-test"
+  "bitvector-test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bitvector-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
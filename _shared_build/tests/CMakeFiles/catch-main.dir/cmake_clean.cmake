@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/catch-main.dir/catch-main.cpp.o"
+  "CMakeFiles/catch-main.dir/catch-main.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/catch-main.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
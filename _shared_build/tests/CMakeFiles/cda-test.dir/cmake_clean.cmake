@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cda-test.dir/cda-test.cpp.o"
+  "CMakeFiles/cda-test.dir/cda-test.cpp.o.d"
+  "cda-test"
+  "cda-test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cda-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
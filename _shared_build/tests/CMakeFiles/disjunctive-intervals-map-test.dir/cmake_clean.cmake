@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/disjunctive-intervals-map-test.dir/disjunctive-intervals-map-test.cpp.o"
+  "CMakeFiles/disjunctive-intervals-map-test.dir/disjunctive-intervals-map-test.cpp.o.d"
+  "disjunctive-intervals-map-test"
+  "disjunctive-intervals-map-test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/disjunctive-intervals-map-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
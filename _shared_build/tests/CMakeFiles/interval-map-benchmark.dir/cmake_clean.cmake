@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/interval-map-benchmark.dir/interval-map-benchmark.cpp.o"
+  "CMakeFiles/interval-map-benchmark.dir/interval-map-benchmark.cpp.o.d"
+  "interval-map-benchmark"
+  "interval-map-benchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/interval-map-benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
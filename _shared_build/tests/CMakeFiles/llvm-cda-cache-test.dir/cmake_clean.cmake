@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/llvm-cda-cache-test.dir/llvm-cda-cache-test.cpp.o"
+  "CMakeFiles/llvm-cda-cache-test.dir/llvm-cda-cache-test.cpp.o.d"
+  "llvm-cda-cache-test"
+  "llvm-cda-cache-test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/llvm-cda-cache-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
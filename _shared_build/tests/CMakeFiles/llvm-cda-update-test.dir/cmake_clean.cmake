@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/llvm-cda-update-test.dir/llvm-cda-update-test.cpp.o"
+  "CMakeFiles/llvm-cda-update-test.dir/llvm-cda-update-test.cpp.o.d"
+  "llvm-cda-update-test"
+  "llvm-cda-update-test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/llvm-cda-update-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
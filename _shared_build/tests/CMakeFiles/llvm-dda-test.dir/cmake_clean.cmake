@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/llvm-dda-test.dir/llvm-dda-test.cpp.o"
+  "CMakeFiles/llvm-dda-test.dir/llvm-dda-test.cpp.o.d"
+  "llvm-dda-test"
+  "llvm-dda-test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/llvm-dda-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/llvm-dg-test.dir/llvm-dg-test.cpp.o"
+  "CMakeFiles/llvm-dg-test.dir/llvm-dg-test.cpp.o.d"
+  "llvm-dg-test"
+  "llvm-dg-test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/llvm-dg-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
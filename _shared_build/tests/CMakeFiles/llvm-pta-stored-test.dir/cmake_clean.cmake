@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/llvm-pta-stored-test.dir/llvm-pta-stored-test.cpp.o"
+  "CMakeFiles/llvm-pta-stored-test.dir/llvm-pta-stored-test.cpp.o.d"
+  "llvm-pta-stored-test"
+  "llvm-pta-stored-test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/llvm-pta-stored-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/llvm-pta-update-test.dir/llvm-pta-update-test.cpp.o"
+  "CMakeFiles/llvm-pta-update-test.dir/llvm-pta-update-test.cpp.o.d"
+  "llvm-pta-update-test"
+  "llvm-pta-update-test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/llvm-pta-update-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
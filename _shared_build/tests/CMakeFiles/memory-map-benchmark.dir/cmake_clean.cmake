@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/memory-map-benchmark.dir/memory-map-benchmark.cpp.o"
+  "CMakeFiles/memory-map-benchmark.dir/memory-map-benchmark.cpp.o.d"
+  "memory-map-benchmark"
+  "memory-map-benchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/memory-map-benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nodes-walk-test.dir/nodes-walk-test.cpp.o"
+  "CMakeFiles/nodes-walk-test.dir/nodes-walk-test.cpp.o.d"
+  "nodes-walk-test"
+  "nodes-walk-test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nodes-walk-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/numbers-set-test.dir/numbers-set-test.cpp.o"
+  "CMakeFiles/numbers-set-test.dir/numbers-set-test.cpp.o.d"
+  "numbers-set-test"
+  "numbers-set-test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/numbers-set-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/points-to-set-test.dir/points-to-set-test.cpp.o"
+  "CMakeFiles/points-to-set-test.dir/points-to-set-test.cpp.o.d"
+  "points-to-set-test"
+  "points-to-set-test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/points-to-set-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
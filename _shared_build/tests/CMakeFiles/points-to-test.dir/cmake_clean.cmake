@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/points-to-test.dir/points-to-test.cpp.o"
+  "CMakeFiles/points-to-test.dir/points-to-test.cpp.o.d"
+  "points-to-test"
+  "points-to-test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/points-to-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptset-benchmark.dir/ptset-benchmark.cpp.o"
+  "CMakeFiles/ptset-benchmark.dir/ptset-benchmark.cpp.o.d"
+  "ptset-benchmark"
+  "ptset-benchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ptset-benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
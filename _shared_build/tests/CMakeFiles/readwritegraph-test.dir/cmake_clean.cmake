@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/readwritegraph-test.dir/readwritegraph-test.cpp.o"
+  "CMakeFiles/readwritegraph-test.dir/readwritegraph-test.cpp.o.d"
+  "readwritegraph-test"
+  "readwritegraph-test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/readwritegraph-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
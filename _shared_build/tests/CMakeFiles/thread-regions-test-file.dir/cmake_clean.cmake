@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/thread-regions-test-file"
+  "pthread_exit.ll"
+  "simple.ll"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/thread-regions-test-file.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/thread-regions-test.dir/thread-regions-test.cpp.o"
+  "CMakeFiles/thread-regions-test.dir/thread-regions-test.cpp.o.d"
+  "thread-regions-test"
+  "thread-regions-test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/thread-regions-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/value-relations-test.dir/value-relations-test.cpp.o"
+  "CMakeFiles/value-relations-test.dir/value-relations-test.cpp.o.d"
+  "value-relations-test"
+  "value-relations-test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/value-relations-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
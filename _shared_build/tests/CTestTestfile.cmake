@@ -0,0 +1,45 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests
+# Build directory: /root/repo/_shared_build/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(cmd-arguments-test "/root/repo/tests/cmd-args.py")
+set_tests_properties(cmd-arguments-test PROPERTIES  WORKING_DIRECTORY "/root/repo/_shared_build/tools" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;109;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(dda-export-test "/root/repo/tests/dda-export-test.py")
+set_tests_properties(dda-export-test PROPERTIES  WORKING_DIRECTORY "/root/repo/_shared_build/tools" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;116;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(points-to-test "points-to-test")
+set_tests_properties(points-to-test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;53;add_test;/root/repo/tests/CMakeLists.txt;123;add_catch_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(readwritegraph-test "readwritegraph-test")
+set_tests_properties(readwritegraph-test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;53;add_test;/root/repo/tests/CMakeLists.txt;129;add_catch_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(adt-test "adt-test")
+set_tests_properties(adt-test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;53;add_test;/root/repo/tests/CMakeLists.txt;135;add_catch_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(bitvector-test "bitvector-test")
+set_tests_properties(bitvector-test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;53;add_test;/root/repo/tests/CMakeLists.txt;141;add_catch_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(numbers-set-test "numbers-set-test")
+set_tests_properties(numbers-set-test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;53;add_test;/root/repo/tests/CMakeLists.txt;146;add_catch_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(points-to-set-test "points-to-set-test")
+set_tests_properties(points-to-set-test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;53;add_test;/root/repo/tests/CMakeLists.txt;151;add_catch_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(disjunctive-intervals-map-test "disjunctive-intervals-map-test")
+set_tests_properties(disjunctive-intervals-map-test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;53;add_test;/root/repo/tests/CMakeLists.txt;157;add_catch_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(nodes-walk-test "nodes-walk-test")
+set_tests_properties(nodes-walk-test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;53;add_test;/root/repo/tests/CMakeLists.txt;163;add_catch_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(cda-test "cda-test")
+set_tests_properties(cda-test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;53;add_test;/root/repo/tests/CMakeLists.txt;168;add_catch_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(thread-regions-test "thread-regions-test")
+set_tests_properties(thread-regions-test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;53;add_test;/root/repo/tests/CMakeLists.txt;190;add_catch_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(llvm-dg-test "llvm-dg-test")
+set_tests_properties(llvm-dg-test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;53;add_test;/root/repo/tests/CMakeLists.txt;204;add_catch_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(llvm-pta-update-test "llvm-pta-update-test")
+set_tests_properties(llvm-pta-update-test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;53;add_test;/root/repo/tests/CMakeLists.txt;211;add_catch_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(llvm-pta-stored-test "llvm-pta-stored-test")
+set_tests_properties(llvm-pta-stored-test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;53;add_test;/root/repo/tests/CMakeLists.txt;218;add_catch_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(llvm-cda-cache-test "llvm-cda-cache-test")
+set_tests_properties(llvm-cda-cache-test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;53;add_test;/root/repo/tests/CMakeLists.txt;225;add_catch_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(llvm-cda-update-test "llvm-cda-update-test")
+set_tests_properties(llvm-cda-update-test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;53;add_test;/root/repo/tests/CMakeLists.txt;232;add_catch_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(llvm-dda-test "llvm-dda-test")
+set_tests_properties(llvm-dda-test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;53;add_test;/root/repo/tests/CMakeLists.txt;239;add_catch_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(value-relations-test "value-relations-test")
+set_tests_properties(value-relations-test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;53;add_test;/root/repo/tests/CMakeLists.txt;264;add_catch_test;/root/repo/tests/CMakeLists.txt;0;")
+subdirs("slicing")
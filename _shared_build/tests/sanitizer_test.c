@@ -0,0 +1 @@
+int main(int argc, char* argv[]) {}
\ No newline at end of file
@@ -0,0 +1,330 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/slicing
+# Build directory: /root/repo/_shared_build/tests/slicing
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(test1 "/root/repo/tests/slicing/test-runner-debug.py" "test1")
+set_tests_properties(test1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;4;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(test2 "/root/repo/tests/slicing/test-runner-debug.py" "test2")
+set_tests_properties(test2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;5;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(test3 "/root/repo/tests/slicing/test-runner-debug.py" "test3")
+set_tests_properties(test3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;6;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(test4 "/root/repo/tests/slicing/test-runner-debug.py" "test4")
+set_tests_properties(test4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;7;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(test5 "/root/repo/tests/slicing/test-runner-debug.py" "test5")
+set_tests_properties(test5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;8;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(test6 "/root/repo/tests/slicing/test-runner-debug.py" "test6")
+set_tests_properties(test6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;9;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(test7 "/root/repo/tests/slicing/test-runner-debug.py" "test7")
+set_tests_properties(test7 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;10;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(test8 "/root/repo/tests/slicing/test-runner-debug.py" "test8")
+set_tests_properties(test8 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;11;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(test22 "/root/repo/tests/slicing/test-runner-debug.py" "test22")
+set_tests_properties(test22 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;12;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(test222 "/root/repo/tests/slicing/test-runner-debug.py" "test222")
+set_tests_properties(test222 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;13;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(recursive1 "/root/repo/tests/slicing/test-runner-debug.py" "recursive1")
+set_tests_properties(recursive1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;14;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(recursive2 "/root/repo/tests/slicing/test-runner-debug.py" "recursive2")
+set_tests_properties(recursive2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;15;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(recursive3 "/root/repo/tests/slicing/test-runner-debug.py" "recursive3")
+set_tests_properties(recursive3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;16;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(recursive4 "/root/repo/tests/slicing/test-runner-debug.py" "recursive4")
+set_tests_properties(recursive4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;17;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(recursive5 "/root/repo/tests/slicing/test-runner-debug.py" "recursive5")
+set_tests_properties(recursive5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;18;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(interprocedural1 "/root/repo/tests/slicing/test-runner-debug.py" "interprocedural1")
+set_tests_properties(interprocedural1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;19;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(interprocedural2 "/root/repo/tests/slicing/test-runner-debug.py" "interprocedural2")
+set_tests_properties(interprocedural2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;20;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(interprocedural3 "/root/repo/tests/slicing/test-runner-debug.py" "interprocedural3")
+set_tests_properties(interprocedural3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;21;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(interprocedural4 "/root/repo/tests/slicing/test-runner-debug.py" "interprocedural4")
+set_tests_properties(interprocedural4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;22;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(interprocedural5 "/root/repo/tests/slicing/test-runner-debug.py" "interprocedural5")
+set_tests_properties(interprocedural5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;23;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(interprocedural6 "/root/repo/tests/slicing/test-runner-debug.py" "interprocedural6")
+set_tests_properties(interprocedural6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;24;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(interprocedural7 "/root/repo/tests/slicing/test-runner-debug.py" "interprocedural7")
+set_tests_properties(interprocedural7 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;25;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(interprocedural8 "/root/repo/tests/slicing/test-runner-debug.py" "interprocedural8")
+set_tests_properties(interprocedural8 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;26;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(interprocedural9 "/root/repo/tests/slicing/test-runner-debug.py" "interprocedural9")
+set_tests_properties(interprocedural9 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;27;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(funcptr1 "/root/repo/tests/slicing/test-runner-debug.py" "funcptr1")
+set_tests_properties(funcptr1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;28;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(funcptr2 "/root/repo/tests/slicing/test-runner-debug.py" "funcptr2")
+set_tests_properties(funcptr2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;29;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(funcptr3 "/root/repo/tests/slicing/test-runner-debug.py" "funcptr3")
+set_tests_properties(funcptr3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;30;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(funcptr4 "/root/repo/tests/slicing/test-runner-debug.py" "funcptr4")
+set_tests_properties(funcptr4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;31;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(funcptr5 "/root/repo/tests/slicing/test-runner-debug.py" "funcptr5")
+set_tests_properties(funcptr5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;32;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(funcptr6 "/root/repo/tests/slicing/test-runner-debug.py" "funcptr6")
+set_tests_properties(funcptr6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;33;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(funcptr7 "/root/repo/tests/slicing/test-runner-debug.py" "funcptr7")
+set_tests_properties(funcptr7 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;34;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(funcptr8 "/root/repo/tests/slicing/test-runner-debug.py" "funcptr8")
+set_tests_properties(funcptr8 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;35;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(funcptr9 "/root/repo/tests/slicing/test-runner-debug.py" "funcptr9")
+set_tests_properties(funcptr9 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;36;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(funcptr10 "/root/repo/tests/slicing/test-runner-debug.py" "funcptr10")
+set_tests_properties(funcptr10 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;37;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(funcptr11 "/root/repo/tests/slicing/test-runner-debug.py" "funcptr11")
+set_tests_properties(funcptr11 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;38;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(funcptr12 "/root/repo/tests/slicing/test-runner-debug.py" "funcptr12")
+set_tests_properties(funcptr12 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;39;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(funcptr13 "/root/repo/tests/slicing/test-runner-debug.py" "funcptr13")
+set_tests_properties(funcptr13 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;40;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(funcptr14 "/root/repo/tests/slicing/test-runner-debug.py" "funcptr14")
+set_tests_properties(funcptr14 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;41;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(funcptr15 "/root/repo/tests/slicing/test-runner-debug.py" "funcptr15")
+set_tests_properties(funcptr15 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;42;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(funcptr16 "/root/repo/tests/slicing/test-runner-debug.py" "funcptr16")
+set_tests_properties(funcptr16 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;43;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(funcptr-regression1 "/root/repo/tests/slicing/test-runner-debug.py" "funcptr-regression1")
+set_tests_properties(funcptr-regression1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;44;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(funcarray1 "/root/repo/tests/slicing/test-runner-debug.py" "funcarray1")
+set_tests_properties(funcarray1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;45;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(funcarray2 "/root/repo/tests/slicing/test-runner-debug.py" "funcarray2")
+set_tests_properties(funcarray2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;46;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(funcarray3 "/root/repo/tests/slicing/test-runner-debug.py" "funcarray3")
+set_tests_properties(funcarray3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;47;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(unknownptr1 "/root/repo/tests/slicing/test-runner-debug.py" "unknownptr1")
+set_tests_properties(unknownptr1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;48;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(unknownptr2 "/root/repo/tests/slicing/test-runner-debug.py" "unknownptr2")
+set_tests_properties(unknownptr2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;49;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(unknownptr3 "/root/repo/tests/slicing/test-runner-debug.py" "unknownptr3")
+set_tests_properties(unknownptr3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;50;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(unknownptr4 "/root/repo/tests/slicing/test-runner-debug.py" "unknownptr4")
+set_tests_properties(unknownptr4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;51;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(unknownptr5 "/root/repo/tests/slicing/test-runner-debug.py" "unknownptr5")
+set_tests_properties(unknownptr5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;52;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(unknownptr6 "/root/repo/tests/slicing/test-runner-debug.py" "unknownptr6")
+set_tests_properties(unknownptr6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;53;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(unknownptr7 "/root/repo/tests/slicing/test-runner-debug.py" "unknownptr7")
+set_tests_properties(unknownptr7 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;54;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(unknownptr8 "/root/repo/tests/slicing/test-runner-debug.py" "unknownptr8")
+set_tests_properties(unknownptr8 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;55;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(unknownptr9 "/root/repo/tests/slicing/test-runner-debug.py" "unknownptr9")
+set_tests_properties(unknownptr9 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;56;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(unknownptr10 "/root/repo/tests/slicing/test-runner-debug.py" "unknownptr10")
+set_tests_properties(unknownptr10 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;57;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(unknownptr11 "/root/repo/tests/slicing/test-runner-debug.py" "unknownptr11")
+set_tests_properties(unknownptr11 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;58;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(pointers1 "/root/repo/tests/slicing/test-runner-debug.py" "pointers1")
+set_tests_properties(pointers1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;59;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(pointers2 "/root/repo/tests/slicing/test-runner-debug.py" "pointers2")
+set_tests_properties(pointers2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;60;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(pointers3 "/root/repo/tests/slicing/test-runner-debug.py" "pointers3")
+set_tests_properties(pointers3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;61;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(pointers4 "/root/repo/tests/slicing/test-runner-debug.py" "pointers4")
+set_tests_properties(pointers4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;62;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(pointers5 "/root/repo/tests/slicing/test-runner-debug.py" "pointers5")
+set_tests_properties(pointers5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;63;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(pointers6 "/root/repo/tests/slicing/test-runner-debug.py" "pointers6")
+set_tests_properties(pointers6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;64;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(pointers7 "/root/repo/tests/slicing/test-runner-debug.py" "pointers7")
+set_tests_properties(pointers7 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;65;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(ptrarray1 "/root/repo/tests/slicing/test-runner-debug.py" "ptrarray1")
+set_tests_properties(ptrarray1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;66;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(ptrarray2 "/root/repo/tests/slicing/test-runner-debug.py" "ptrarray2")
+set_tests_properties(ptrarray2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;67;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(phi1 "/root/repo/tests/slicing/test-runner-debug.py" "phi1")
+set_tests_properties(phi1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;68;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(phi2 "/root/repo/tests/slicing/test-runner-debug.py" "phi2")
+set_tests_properties(phi2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;69;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(phi3 "/root/repo/tests/slicing/test-runner-debug.py" "phi3")
+set_tests_properties(phi3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;70;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(phi4 "/root/repo/tests/slicing/test-runner-debug.py" "phi4")
+set_tests_properties(phi4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;71;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(phi1-nophi "/root/repo/tests/slicing/test-runner-debug.py" "phi1-nophi")
+set_tests_properties(phi1-nophi PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;72;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(phi2-nophi "/root/repo/tests/slicing/test-runner-debug.py" "phi2-nophi")
+set_tests_properties(phi2-nophi PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;73;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(phi3-nophi "/root/repo/tests/slicing/test-runner-debug.py" "phi3-nophi")
+set_tests_properties(phi3-nophi PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;74;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(phi4-nophi "/root/repo/tests/slicing/test-runner-debug.py" "phi4-nophi")
+set_tests_properties(phi4-nophi PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;75;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(global1 "/root/repo/tests/slicing/test-runner-debug.py" "global1")
+set_tests_properties(global1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;76;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(global2 "/root/repo/tests/slicing/test-runner-debug.py" "global2")
+set_tests_properties(global2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;77;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(global3 "/root/repo/tests/slicing/test-runner-debug.py" "global3")
+set_tests_properties(global3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;78;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(global4 "/root/repo/tests/slicing/test-runner-debug.py" "global4")
+set_tests_properties(global4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;79;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(global5 "/root/repo/tests/slicing/test-runner-debug.py" "global5")
+set_tests_properties(global5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;80;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(global6 "/root/repo/tests/slicing/test-runner-debug.py" "global6")
+set_tests_properties(global6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;81;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(global7 "/root/repo/tests/slicing/test-runner-debug.py" "global7")
+set_tests_properties(global7 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;82;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(global8 "/root/repo/tests/slicing/test-runner-debug.py" "global8")
+set_tests_properties(global8 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;83;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(global9 "/root/repo/tests/slicing/test-runner-debug.py" "global9")
+set_tests_properties(global9 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;84;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(global10 "/root/repo/tests/slicing/test-runner-debug.py" "global10")
+set_tests_properties(global10 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;85;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(ptrtoint1 "/root/repo/tests/slicing/test-runner-debug.py" "ptrtoint1")
+set_tests_properties(ptrtoint1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;86;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(ptrtoint2 "/root/repo/tests/slicing/test-runner-debug.py" "ptrtoint2")
+set_tests_properties(ptrtoint2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;87;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(ptrtoint3 "/root/repo/tests/slicing/test-runner-debug.py" "ptrtoint3")
+set_tests_properties(ptrtoint3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;88;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(ptrtoint4 "/root/repo/tests/slicing/test-runner-debug.py" "ptrtoint4")
+set_tests_properties(ptrtoint4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;89;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(ptrtoint5 "/root/repo/tests/slicing/test-runner-debug.py" "ptrtoint5")
+set_tests_properties(ptrtoint5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;90;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(ptrtoint6 "/root/repo/tests/slicing/test-runner-debug.py" "ptrtoint6")
+set_tests_properties(ptrtoint6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;91;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(ptrtoint7 "/root/repo/tests/slicing/test-runner-debug.py" "ptrtoint7")
+set_tests_properties(ptrtoint7 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;92;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(llvmmemcpy "/root/repo/tests/slicing/test-runner-debug.py" "llvmmemcpy")
+set_tests_properties(llvmmemcpy PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;93;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(llvmmemcpy2 "/root/repo/tests/slicing/test-runner-debug.py" "llvmmemcpy2")
+set_tests_properties(llvmmemcpy2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;94;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(memset1 "/root/repo/tests/slicing/test-runner-debug.py" "memset1")
+set_tests_properties(memset1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;95;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(memcpy1 "/root/repo/tests/slicing/test-runner-debug.py" "memcpy1")
+set_tests_properties(memcpy1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;96;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(memcpy2 "/root/repo/tests/slicing/test-runner-debug.py" "memcpy2")
+set_tests_properties(memcpy2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;97;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(memcpy3 "/root/repo/tests/slicing/test-runner-debug.py" "memcpy3")
+set_tests_properties(memcpy3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;98;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(memcpy4 "/root/repo/tests/slicing/test-runner-debug.py" "memcpy4")
+set_tests_properties(memcpy4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;99;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(memcpy5 "/root/repo/tests/slicing/test-runner-debug.py" "memcpy5")
+set_tests_properties(memcpy5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;100;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(memcpy6 "/root/repo/tests/slicing/test-runner-debug.py" "memcpy6")
+set_tests_properties(memcpy6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;101;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(bitcast1 "/root/repo/tests/slicing/test-runner-debug.py" "bitcast1")
+set_tests_properties(bitcast1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;102;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(bitcast2 "/root/repo/tests/slicing/test-runner-debug.py" "bitcast2")
+set_tests_properties(bitcast2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;103;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(bitcast3 "/root/repo/tests/slicing/test-runner-debug.py" "bitcast3")
+set_tests_properties(bitcast3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;104;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(bitcast4 "/root/repo/tests/slicing/test-runner-debug.py" "bitcast4")
+set_tests_properties(bitcast4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;105;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(bitcast5 "/root/repo/tests/slicing/test-runner-debug.py" "bitcast5")
+set_tests_properties(bitcast5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;106;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(loop1 "/root/repo/tests/slicing/test-runner-debug.py" "loop1")
+set_tests_properties(loop1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;107;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(loop2 "/root/repo/tests/slicing/test-runner-debug.py" "loop2")
+set_tests_properties(loop2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;108;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(loop3 "/root/repo/tests/slicing/test-runner-debug.py" "loop3")
+set_tests_properties(loop3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;109;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(loop4 "/root/repo/tests/slicing/test-runner-debug.py" "loop4")
+set_tests_properties(loop4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;110;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(loop5 "/root/repo/tests/slicing/test-runner-debug.py" "loop5")
+set_tests_properties(loop5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;111;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(list1 "/root/repo/tests/slicing/test-runner-debug.py" "list1")
+set_tests_properties(list1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;112;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(list2 "/root/repo/tests/slicing/test-runner-debug.py" "list2")
+set_tests_properties(list2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;113;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(list3 "/root/repo/tests/slicing/test-runner-debug.py" "list3")
+set_tests_properties(list3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;114;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(list4 "/root/repo/tests/slicing/test-runner-debug.py" "list4")
+set_tests_properties(list4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;115;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(list5 "/root/repo/tests/slicing/test-runner-debug.py" "list5")
+set_tests_properties(list5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;116;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(list6 "/root/repo/tests/slicing/test-runner-debug.py" "list6")
+set_tests_properties(list6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;117;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(list7 "/root/repo/tests/slicing/test-runner-debug.py" "list7")
+set_tests_properties(list7 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;118;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(list8 "/root/repo/tests/slicing/test-runner-debug.py" "list8")
+set_tests_properties(list8 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;119;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(list9 "/root/repo/tests/slicing/test-runner-debug.py" "list9")
+set_tests_properties(list9 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;120;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(dynalloc1 "/root/repo/tests/slicing/test-runner-debug.py" "dynalloc1")
+set_tests_properties(dynalloc1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;121;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(dynalloc2 "/root/repo/tests/slicing/test-runner-debug.py" "dynalloc2")
+set_tests_properties(dynalloc2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;122;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(dynalloc3 "/root/repo/tests/slicing/test-runner-debug.py" "dynalloc3")
+set_tests_properties(dynalloc3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;123;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(dynalloc4 "/root/repo/tests/slicing/test-runner-debug.py" "dynalloc4")
+set_tests_properties(dynalloc4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;124;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(dynalloc5 "/root/repo/tests/slicing/test-runner-debug.py" "dynalloc5")
+set_tests_properties(dynalloc5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;125;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(dynalloc6 "/root/repo/tests/slicing/test-runner-debug.py" "dynalloc6")
+set_tests_properties(dynalloc6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;126;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(dynalloc7 "/root/repo/tests/slicing/test-runner-debug.py" "dynalloc7")
+set_tests_properties(dynalloc7 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;127;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(realloc1 "/root/repo/tests/slicing/test-runner-debug.py" "realloc1")
+set_tests_properties(realloc1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;128;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(realloc2 "/root/repo/tests/slicing/test-runner-debug.py" "realloc2")
+set_tests_properties(realloc2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;129;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(cyclic-realloc "/root/repo/tests/slicing/test-runner-debug.py" "cyclic-realloc")
+set_tests_properties(cyclic-realloc PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;130;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(switch1 "/root/repo/tests/slicing/test-runner-debug.py" "switch1")
+set_tests_properties(switch1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;131;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(switch2 "/root/repo/tests/slicing/test-runner-debug.py" "switch2")
+set_tests_properties(switch2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;132;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(vararg1 "/root/repo/tests/slicing/test-runner-debug.py" "vararg1")
+set_tests_properties(vararg1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;133;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(vararg2 "/root/repo/tests/slicing/test-runner-debug.py" "vararg2")
+set_tests_properties(vararg2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;134;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(vararg3 "/root/repo/tests/slicing/test-runner-debug.py" "vararg3")
+set_tests_properties(vararg3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;135;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(vararg4 "/root/repo/tests/slicing/test-runner-debug.py" "vararg4")
+set_tests_properties(vararg4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;136;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(negoffset1 "/root/repo/tests/slicing/test-runner-debug.py" "negoffset1")
+set_tests_properties(negoffset1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;137;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(negoffset2 "/root/repo/tests/slicing/test-runner-debug.py" "negoffset2")
+set_tests_properties(negoffset2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;138;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(negoffset3 "/root/repo/tests/slicing/test-runner-debug.py" "negoffset3")
+set_tests_properties(negoffset3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;139;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(sum1 "/root/repo/tests/slicing/test-runner-debug.py" "sum1")
+set_tests_properties(sum1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;140;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(sum2 "/root/repo/tests/slicing/test-runner-debug.py" "sum2")
+set_tests_properties(sum2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;141;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(sum3 "/root/repo/tests/slicing/test-runner-debug.py" "sum3")
+set_tests_properties(sum3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;142;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(control-regression1 "/root/repo/tests/slicing/test-runner-debug.py" "control-regression1")
+set_tests_properties(control-regression1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;143;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(pta_fs_regression1 "/root/repo/tests/slicing/test-runner-debug.py" "pta_fs_regression1")
+set_tests_properties(pta_fs_regression1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;144;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(pta_fs_regression2 "/root/repo/tests/slicing/test-runner-debug.py" "pta_fs_regression2")
+set_tests_properties(pta_fs_regression2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;145;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(pta_regression2 "/root/repo/tests/slicing/test-runner-debug.py" "pta_regression2")
+set_tests_properties(pta_regression2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;146;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(pta_regression3 "/root/repo/tests/slicing/test-runner-debug.py" "pta_regression3")
+set_tests_properties(pta_regression3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;147;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(alias_of_return "/root/repo/tests/slicing/test-runner-debug.py" "alias_of_return")
+set_tests_properties(alias_of_return PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;148;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(regression1 "/root/repo/tests/slicing/test-runner-debug.py" "regression1")
+set_tests_properties(regression1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;149;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(fptoui "/root/repo/tests/slicing/test-runner-debug.py" "fptoui")
+set_tests_properties(fptoui PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;150;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(malloc-redef "/root/repo/tests/slicing/test-runner-debug.py" "malloc-redef")
+set_tests_properties(malloc-redef PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;151;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(globalptr1 "/root/repo/tests/slicing/test-runner-debug.py" "globalptr1")
+set_tests_properties(globalptr1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;152;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(globalptr2 "/root/repo/tests/slicing/test-runner-debug.py" "globalptr2")
+set_tests_properties(globalptr2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;153;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(globalptr3 "/root/repo/tests/slicing/test-runner-debug.py" "globalptr3")
+set_tests_properties(globalptr3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;154;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(globalptr4 "/root/repo/tests/slicing/test-runner-debug.py" "globalptr4")
+set_tests_properties(globalptr4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;155;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(pta-inv-infinite-loop "/root/repo/tests/slicing/test-runner-debug.py" "pta-inv-infinite-loop")
+set_tests_properties(pta-inv-infinite-loop PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;158;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(undefcall1 "/root/repo/tests/slicing/test-runner-debug.py" "undefcall1")
+set_tests_properties(undefcall1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;159;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(undefcall2 "/root/repo/tests/slicing/test-runner-debug.py" "undefcall2")
+set_tests_properties(undefcall2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;160;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(unknown-interproc "/root/repo/tests/slicing/test-runner-debug.py" "unknown-interproc")
+set_tests_properties(unknown-interproc PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;161;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(unknown-interproc2 "/root/repo/tests/slicing/test-runner-debug.py" "unknown-interproc2")
+set_tests_properties(unknown-interproc2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;162;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(unknown-interproc2-a "/root/repo/tests/slicing/test-runner-debug.py" "unknown-interproc2-a")
+set_tests_properties(unknown-interproc2-a PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;163;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(unknown-interproc3 "/root/repo/tests/slicing/test-runner-debug.py" "unknown-interproc3")
+set_tests_properties(unknown-interproc3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;164;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(atomic1 "/root/repo/tests/slicing/test-runner-debug.py" "atomic1")
+set_tests_properties(atomic1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;165;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(atomic2 "/root/repo/tests/slicing/test-runner-debug.py" "atomic2")
+set_tests_properties(atomic2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;166;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
+add_test(atomic3 "/root/repo/tests/slicing/test-runner-debug.py" "atomic3")
+set_tests_properties(atomic3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/slicing/CMakeLists.txt;167;add_test;/root/repo/tests/slicing/CMakeLists.txt;0;")
@@ -0,0 +1,33 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tools/llvm-slicer-crit.cpp" "tools/CMakeFiles/dgllvmslicer.dir/llvm-slicer-crit.cpp.o" "gcc" "tools/CMakeFiles/dgllvmslicer.dir/llvm-slicer-crit.cpp.o.d"
+  "/root/repo/tools/llvm-slicer-metadata.cpp" "tools/CMakeFiles/dgllvmslicer.dir/llvm-slicer-metadata.cpp.o" "gcc" "tools/CMakeFiles/dgllvmslicer.dir/llvm-slicer-metadata.cpp.o.d"
+  "/root/repo/tools/llvm-slicer-opts.cpp" "tools/CMakeFiles/dgllvmslicer.dir/llvm-slicer-opts.cpp.o" "gcc" "tools/CMakeFiles/dgllvmslicer.dir/llvm-slicer-opts.cpp.o.d"
+  "/root/repo/tools/llvm-slicer-preprocess.cpp" "tools/CMakeFiles/dgllvmslicer.dir/llvm-slicer-preprocess.cpp.o" "gcc" "tools/CMakeFiles/dgllvmslicer.dir/llvm-slicer-preprocess.cpp.o.d"
+  "/root/repo/tools/llvm-slicer-utils.cpp" "tools/CMakeFiles/dgllvmslicer.dir/llvm-slicer-utils.cpp.o" "gcc" "tools/CMakeFiles/dgllvmslicer.dir/llvm-slicer-utils.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_shared_build/lib/CMakeFiles/dgllvmdg.dir/DependInfo.cmake"
+  "/root/repo/_shared_build/lib/CMakeFiles/dgllvmdda.dir/DependInfo.cmake"
+  "/root/repo/_shared_build/lib/CMakeFiles/dgdda.dir/DependInfo.cmake"
+  "/root/repo/_shared_build/lib/CMakeFiles/dgllvmthreadregions.dir/DependInfo.cmake"
+  "/root/repo/_shared_build/lib/CMakeFiles/dgllvmcda.dir/DependInfo.cmake"
+  "/root/repo/_shared_build/lib/CMakeFiles/dgllvmforkjoin.dir/DependInfo.cmake"
+  "/root/repo/_shared_build/lib/CMakeFiles/dgllvmpta.dir/DependInfo.cmake"
+  "/root/repo/_shared_build/lib/CMakeFiles/dgpta.dir/DependInfo.cmake"
+  "/root/repo/_shared_build/lib/CMakeFiles/dganalysis.dir/DependInfo.cmake"
+  "/root/repo/_shared_build/lib/CMakeFiles/dgcda.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dgllvmslicer.dir/llvm-slicer-crit.cpp.o"
+  "CMakeFiles/dgllvmslicer.dir/llvm-slicer-crit.cpp.o.d"
+  "CMakeFiles/dgllvmslicer.dir/llvm-slicer-metadata.cpp.o"
+  "CMakeFiles/dgllvmslicer.dir/llvm-slicer-metadata.cpp.o.d"
+  "CMakeFiles/dgllvmslicer.dir/llvm-slicer-opts.cpp.o"
+  "CMakeFiles/dgllvmslicer.dir/llvm-slicer-opts.cpp.o.d"
+  "CMakeFiles/dgllvmslicer.dir/llvm-slicer-preprocess.cpp.o"
+  "CMakeFiles/dgllvmslicer.dir/llvm-slicer-preprocess.cpp.o.d"
+  "CMakeFiles/dgllvmslicer.dir/llvm-slicer-utils.cpp.o"
+  "CMakeFiles/dgllvmslicer.dir/llvm-slicer-utils.cpp.o.d"
+  "libdgllvmslicer.pdb"
+  "libdgllvmslicer.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dgllvmslicer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
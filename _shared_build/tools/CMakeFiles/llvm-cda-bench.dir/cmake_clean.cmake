@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/llvm-cda-bench.dir/llvm-cda-bench.cpp.o"
+  "CMakeFiles/llvm-cda-bench.dir/llvm-cda-bench.cpp.o.d"
+  "llvm-cda-bench"
+  "llvm-cda-bench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/llvm-cda-bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
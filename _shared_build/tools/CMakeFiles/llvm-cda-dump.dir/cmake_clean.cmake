@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/llvm-cda-dump.dir/llvm-cda-dump.cpp.o"
+  "CMakeFiles/llvm-cda-dump.dir/llvm-cda-dump.cpp.o.d"
+  "llvm-cda-dump"
+  "llvm-cda-dump.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/llvm-cda-dump.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/llvm-cda-stress.dir/llvm-cda-stress.cpp.o"
+  "CMakeFiles/llvm-cda-stress.dir/llvm-cda-stress.cpp.o.d"
+  "llvm-cda-stress"
+  "llvm-cda-stress.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/llvm-cda-stress.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
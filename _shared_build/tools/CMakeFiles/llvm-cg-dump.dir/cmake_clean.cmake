@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/llvm-cg-dump.dir/llvm-cg-dump.cpp.o"
+  "CMakeFiles/llvm-cg-dump.dir/llvm-cg-dump.cpp.o.d"
+  "llvm-cg-dump"
+  "llvm-cg-dump.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/llvm-cg-dump.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/llvm-dda-dump.dir/llvm-dda-dump.cpp.o"
+  "CMakeFiles/llvm-dda-dump.dir/llvm-dda-dump.cpp.o.d"
+  "llvm-dda-dump"
+  "llvm-dda-dump.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/llvm-dda-dump.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
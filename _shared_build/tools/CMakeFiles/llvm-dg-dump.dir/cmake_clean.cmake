@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/llvm-dg-dump.dir/llvm-dg-dump.cpp.o"
+  "CMakeFiles/llvm-dg-dump.dir/llvm-dg-dump.cpp.o.d"
+  "llvm-dg-dump"
+  "llvm-dg-dump.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/llvm-dg-dump.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/llvm-ntscd-dump.dir/llvm-ntscd-dump.cpp.o"
+  "CMakeFiles/llvm-ntscd-dump.dir/llvm-ntscd-dump.cpp.o.d"
+  "llvm-ntscd-dump"
+  "llvm-ntscd-dump.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/llvm-ntscd-dump.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
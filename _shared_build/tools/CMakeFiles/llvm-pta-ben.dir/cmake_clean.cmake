@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/llvm-pta-ben.dir/llvm-pta-ben.cpp.o"
+  "CMakeFiles/llvm-pta-ben.dir/llvm-pta-ben.cpp.o.d"
+  "llvm-pta-ben"
+  "llvm-pta-ben.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/llvm-pta-ben.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/llvm-pta-compare.dir/llvm-pta-compare.cpp.o"
+  "CMakeFiles/llvm-pta-compare.dir/llvm-pta-compare.cpp.o.d"
+  "llvm-pta-compare"
+  "llvm-pta-compare.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/llvm-pta-compare.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
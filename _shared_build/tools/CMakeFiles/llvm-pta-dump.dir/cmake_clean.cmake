@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/llvm-pta-dump.dir/llvm-pta-dump.cpp.o"
+  "CMakeFiles/llvm-pta-dump.dir/llvm-pta-dump.cpp.o.d"
+  "llvm-pta-dump"
+  "llvm-pta-dump.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/llvm-pta-dump.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/llvm-sdg-dump.dir/llvm-sdg-dump.cpp.o"
+  "CMakeFiles/llvm-sdg-dump.dir/llvm-sdg-dump.cpp.o.d"
+  "llvm-sdg-dump"
+  "llvm-sdg-dump.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/llvm-sdg-dump.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
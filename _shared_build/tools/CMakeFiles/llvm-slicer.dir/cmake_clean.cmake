@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/llvm-slicer.dir/llvm-slicer.cpp.o"
+  "CMakeFiles/llvm-slicer.dir/llvm-slicer.cpp.o.d"
+  "llvm-slicer"
+  "llvm-slicer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/llvm-slicer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
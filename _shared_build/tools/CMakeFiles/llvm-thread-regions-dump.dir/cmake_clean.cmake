@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/llvm-thread-regions-dump.dir/llvm-thread-regions-dump.cpp.o"
+  "CMakeFiles/llvm-thread-regions-dump.dir/llvm-thread-regions-dump.cpp.o.d"
+  "llvm-thread-regions-dump"
+  "llvm-thread-regions-dump.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/llvm-thread-regions-dump.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
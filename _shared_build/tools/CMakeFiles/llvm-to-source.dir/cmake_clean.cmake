@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/llvm-to-source.dir/llvm-to-source.cpp.o"
+  "CMakeFiles/llvm-to-source.dir/llvm-to-source.cpp.o.d"
+  "llvm-to-source"
+  "llvm-to-source.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/llvm-to-source.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/llvm-vr-dump.dir/llvm-vr-dump.cpp.o"
+  "CMakeFiles/llvm-vr-dump.dir/llvm-vr-dump.cpp.o.d"
+  "llvm-vr-dump"
+  "llvm-vr-dump.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/llvm-vr-dump.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
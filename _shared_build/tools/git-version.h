@@ -0,0 +1,4 @@
+#ifndef DG_GIT_VERSION
+#define DG_GIT_VERSION
+#define GIT_VERSION "c47d2dd"
+#endif // DG_GIT_VERSION
@@ -0,0 +1,108 @@
+#ifndef DG_ADT_ARENA_H_
+#define DG_ADT_ARENA_H_
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace dg {
+namespace ADT {
+
+///
+// Bump allocator. The memory is taken from big chunks and it is released
+// all at once when the arena is destroyed. Objects created by 'create'
+// are destroyed at that moment too (in the reverse order of creation),
+// so the owner of the arena does not need to keep (unique) pointers
+// to the objects just to be able to delete them.
+//
+// The arena is not thread-safe.
+class Arena {
+    // a destructor of a non-trivially destructible object,
+    // these records are allocated in the arena too
+    struct Finalizer {
+        void (*destroy)(void *);
+        void *object;
+        Finalizer *prev;
+    };
+
+    std::vector<char *> _chunks;
+    char *_cur{nullptr};
+    char *_end{nullptr};
+    Finalizer *_finalizers{nullptr};
+    const size_t _chunkSize;
+    size_t _capacity{0};
+
+    template <typename T>
+    static void destroyObject(void *obj) {
+        static_cast<T *>(obj)->~T();
+    }
+
+    void newChunk(size_t size) {
+        size = std::max(size, _chunkSize);
+        auto *chunk = static_cast<char *>(std::malloc(size));
+        if (!chunk)
+            std::abort();
+        _chunks.push_back(chunk);
+        _capacity += size;
+        _cur = chunk;
+        _end = chunk + size;
+    }
+
+  public:
+    Arena(size_t chunkSize = 64 * 1024) : _chunkSize(chunkSize) {}
+    Arena(const Arena &) = delete;
+    Arena &operator=(const Arena &) = delete;
+
+    ~Arena() {
+        for (auto *f = _finalizers; f; f = f->prev)
+            f->destroy(f->object);
+        for (auto *chunk : _chunks)
+            std::free(chunk);
+    }
+
+    void *allocate(size_t size, size_t align = alignof(std::max_align_t)) {
+        assert(align > 0 && (align & (align - 1)) == 0 &&
+               "Alignment must be a power of two");
+        auto addr = reinterpret_cast<uintptr_t>(_cur);
+        auto padding = (align - (addr & (align - 1))) & (align - 1);
+        if (!_cur || size + padding > static_cast<size_t>(_end - _cur)) {
+            // new chunks are aligned to max_align_t
+            newChunk(size + align);
+            addr = reinterpret_cast<uintptr_t>(_cur);
+            padding = (align - (addr & (align - 1))) & (align - 1);
+        }
+
+        auto *mem = _cur + padding;
+        _cur = mem + size;
+        assert(_cur <= _end);
+        return mem;
+    }
+
+    // Create an object in the arena. The object is destroyed
+    // when the arena is destroyed.
+    template <typename T, typename... Args>
+    T *create(Args &&...args) {
+        auto *obj = new (allocate(sizeof(T), alignof(T)))
+                T(std::forward<Args>(args)...);
+        if (!std::is_trivially_destructible<T>::value) {
+            auto *fin = new (allocate(sizeof(Finalizer), alignof(Finalizer)))
+                    Finalizer{&destroyObject<T>, obj, _finalizers};
+            _finalizers = fin;
+        }
+        return obj;
+    }
+
+    // the number of bytes taken from the system
+    size_t capacity() const { return _capacity; }
+};
+
+} // namespace ADT
+} // namespace dg
+
+#endif // DG_ADT_ARENA_H_
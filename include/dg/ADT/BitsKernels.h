@@ -0,0 +1,220 @@
+#ifndef DG_BITS_KERNELS_H_
+#define DG_BITS_KERNELS_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#if (defined(__x86_64__) || defined(__i386__)) &&                              \
+        (defined(__GNUC__) || defined(__clang__))
+#define DG_HAVE_X86_BITS_KERNELS
+#include <immintrin.h>
+#endif
+
+namespace dg {
+namespace ADT {
+namespace kernels {
+
+///
+// Operations on arrays of 64-bit words used by bitvectors.
+// The SIMD variants are compiled for the given instruction set
+// regardless of the compiler flags and the best variant supported
+// by the CPU is chosen at runtime.
+
+enum class ISA { SCALAR, SSE41, AVX2 };
+
+// dst |= src, returns true if some bit of dst changed
+inline bool orWordsScalar(uint64_t *dst, const uint64_t *src, size_t n) {
+    uint64_t changed = 0;
+    for (size_t i = 0; i < n; ++i) {
+        changed |= src[i] & ~dst[i];
+        dst[i] |= src[i];
+    }
+    return changed != 0;
+}
+
+// dst &= src, returns true if some bit of dst changed
+inline bool andWordsScalar(uint64_t *dst, const uint64_t *src, size_t n) {
+    uint64_t changed = 0;
+    for (size_t i = 0; i < n; ++i) {
+        changed |= dst[i] & ~src[i];
+        dst[i] &= src[i];
+    }
+    return changed != 0;
+}
+
+// would dst |= src change dst?
+inline bool hasNewBitsScalar(const uint64_t *dst, const uint64_t *src,
+                             size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        if (src[i] & ~dst[i])
+            return true;
+    }
+    return false;
+}
+
+#ifdef DG_HAVE_X86_BITS_KERNELS
+__attribute__((target("avx2"))) inline bool
+orWordsAVX2(uint64_t *dst, const uint64_t *src, size_t n) {
+    __m256i changed = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        auto *d = reinterpret_cast<__m256i *>(dst + i);
+        __m256i D = _mm256_loadu_si256(d);
+        __m256i S = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i *>(src + i));
+        changed = _mm256_or_si256(changed, _mm256_andnot_si256(D, S));
+        _mm256_storeu_si256(d, _mm256_or_si256(D, S));
+    }
+    bool tail = orWordsScalar(dst + i, src + i, n - i);
+    return tail || !_mm256_testz_si256(changed, changed);
+}
+
+__attribute__((target("avx2"))) inline bool
+andWordsAVX2(uint64_t *dst, const uint64_t *src, size_t n) {
+    __m256i changed = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        auto *d = reinterpret_cast<__m256i *>(dst + i);
+        __m256i D = _mm256_loadu_si256(d);
+        __m256i S = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i *>(src + i));
+        changed = _mm256_or_si256(changed, _mm256_andnot_si256(S, D));
+        _mm256_storeu_si256(d, _mm256_and_si256(D, S));
+    }
+    bool tail = andWordsScalar(dst + i, src + i, n - i);
+    return tail || !_mm256_testz_si256(changed, changed);
+}
+
+__attribute__((target("avx2"))) inline bool
+hasNewBitsAVX2(const uint64_t *dst, const uint64_t *src, size_t n) {
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256i D = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i *>(dst + i));
+        __m256i S = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i *>(src + i));
+        // testc returns 1 iff (~D & S) == 0
+        if (!_mm256_testc_si256(D, S))
+            return true;
+    }
+    return hasNewBitsScalar(dst + i, src + i, n - i);
+}
+
+__attribute__((target("sse4.1"))) inline bool
+orWordsSSE41(uint64_t *dst, const uint64_t *src, size_t n) {
+    __m128i changed = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        auto *d = reinterpret_cast<__m128i *>(dst + i);
+        __m128i D = _mm_loadu_si128(d);
+        __m128i S =
+                _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+        changed = _mm_or_si128(changed, _mm_andnot_si128(D, S));
+        _mm_storeu_si128(d, _mm_or_si128(D, S));
+    }
+    bool tail = orWordsScalar(dst + i, src + i, n - i);
+    return tail || !_mm_testz_si128(changed, changed);
+}
+
+__attribute__((target("sse4.1"))) inline bool
+andWordsSSE41(uint64_t *dst, const uint64_t *src, size_t n) {
+    __m128i changed = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        auto *d = reinterpret_cast<__m128i *>(dst + i);
+        __m128i D = _mm_loadu_si128(d);
+        __m128i S =
+                _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+        changed = _mm_or_si128(changed, _mm_andnot_si128(S, D));
+        _mm_storeu_si128(d, _mm_and_si128(D, S));
+    }
+    bool tail = andWordsScalar(dst + i, src + i, n - i);
+    return tail || !_mm_testz_si128(changed, changed);
+}
+
+__attribute__((target("sse4.1"))) inline bool
+hasNewBitsSSE41(const uint64_t *dst, const uint64_t *src, size_t n) {
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        __m128i D = _mm_loadu_si128(reinterpret_cast<const __m128i *>(dst + i));
+        __m128i S = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+        // testc returns 1 iff (~D & S) == 0
+        if (!_mm_testc_si128(D, S))
+            return true;
+    }
+    return hasNewBitsScalar(dst + i, src + i, n - i);
+}
+#endif // DG_HAVE_X86_BITS_KERNELS
+
+inline bool isSupported(ISA isa) {
+#ifdef DG_HAVE_X86_BITS_KERNELS
+    __builtin_cpu_init();
+    switch (isa) {
+    case ISA::AVX2:
+        return __builtin_cpu_supports("avx2");
+    case ISA::SSE41:
+        return __builtin_cpu_supports("sse4.1");
+    case ISA::SCALAR:
+        return true;
+    }
+    return false;
+#else
+    return isa == ISA::SCALAR;
+#endif
+}
+
+// the best instruction set supported by this CPU
+inline ISA getISA() {
+    static const ISA isa = isSupported(ISA::AVX2)    ? ISA::AVX2
+                           : isSupported(ISA::SSE41) ? ISA::SSE41
+                                                     : ISA::SCALAR;
+    return isa;
+}
+
+inline bool orWords(uint64_t *dst, const uint64_t *src, size_t n,
+                    ISA isa = getISA()) {
+    switch (isa) {
+#ifdef DG_HAVE_X86_BITS_KERNELS
+    case ISA::AVX2:
+        return orWordsAVX2(dst, src, n);
+    case ISA::SSE41:
+        return orWordsSSE41(dst, src, n);
+#endif
+    default:
+        return orWordsScalar(dst, src, n);
+    }
+}
+
+inline bool andWords(uint64_t *dst, const uint64_t *src, size_t n,
+                     ISA isa = getISA()) {
+    switch (isa) {
+#ifdef DG_HAVE_X86_BITS_KERNELS
+    case ISA::AVX2:
+        return andWordsAVX2(dst, src, n);
+    case ISA::SSE41:
+        return andWordsSSE41(dst, src, n);
+#endif
+    default:
+        return andWordsScalar(dst, src, n);
+    }
+}
+
+inline bool hasNewBits(const uint64_t *dst, const uint64_t *src, size_t n,
+                       ISA isa = getISA()) {
+    switch (isa) {
+#ifdef DG_HAVE_X86_BITS_KERNELS
+    case ISA::AVX2:
+        return hasNewBitsAVX2(dst, src, n);
+    case ISA::SSE41:
+        return hasNewBitsSSE41(dst, src, n);
+#endif
+    default:
+        return hasNewBitsScalar(dst, src, n);
+    }
+}
+
+} // namespace kernels
+} // namespace ADT
+} // namespace dg
+
+#endif // DG_BITS_KERNELS_H_
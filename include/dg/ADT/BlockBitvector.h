@@ -0,0 +1,361 @@
+#ifndef DG_BLOCK_BITVECTOR_H_
+#define DG_BLOCK_BITVECTOR_H_
+
+#include <algorithm>
+#include <bitset>
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+#include "BitsKernels.h"
+
+namespace dg {
+namespace ADT {
+
+///
+// Sparse bitvector that stores the bits in blocks of WORDS_IN_BLOCK
+// 64-bit words. The blocks are kept sorted in a contiguous array,
+// so the union, intersection and inclusion are merges of two sorted
+// arrays where the runs of blocks present in both bitvectors
+// are processed at once by the SIMD kernels from BitsKernels.h.
+//
+// The bitvector never contains a block with all bits unset.
+class BlockSparseBitvector {
+  public:
+    using IndexT = uint64_t;
+    static const size_t WORDS_IN_BLOCK = 4;
+    static const size_t BITS_IN_WORD = 64;
+    static const size_t BITS_IN_BLOCK = WORDS_IN_BLOCK * BITS_IN_WORD;
+
+  private:
+    // sorted indices of the first bits of the blocks
+    std::vector<IndexT> _bases;
+    // WORDS_IN_BLOCK words for each block from _bases
+    std::vector<uint64_t> _words;
+
+    static IndexT _base(IndexT i) { return i - (i % BITS_IN_BLOCK); }
+
+    static uint64_t _mask(IndexT i) {
+        return uint64_t{1} << ((i % BITS_IN_BLOCK) % BITS_IN_WORD);
+    }
+
+    static size_t _wordIdx(IndexT i) {
+        return (i % BITS_IN_BLOCK) / BITS_IN_WORD;
+    }
+
+    // the position of the block with the given base
+    // or the position where it should be inserted
+    size_t _find(IndexT base) const {
+        return std::lower_bound(_bases.begin(), _bases.end(), base) -
+               _bases.begin();
+    }
+
+    bool _hasBlock(size_t b, IndexT base) const {
+        return b < _bases.size() && _bases[b] == base;
+    }
+
+    uint64_t *_block(size_t b) { return _words.data() + b * WORDS_IN_BLOCK; }
+    const uint64_t *_block(size_t b) const {
+        return _words.data() + b * WORDS_IN_BLOCK;
+    }
+
+    bool _isZero(size_t b) const {
+        const uint64_t *W = _block(b);
+        return std::all_of(W, W + WORDS_IN_BLOCK,
+                           [](uint64_t w) { return w == 0; });
+    }
+
+    void _eraseBlock(size_t b) {
+        _bases.erase(_bases.begin() + b);
+        auto it = _words.begin() + b * WORDS_IN_BLOCK;
+        _words.erase(it, it + WORDS_IN_BLOCK);
+    }
+
+    // the number of blocks starting at i in this bitvector and at j
+    // in 'rhs' that have the same bases
+    size_t _run(size_t i, const BlockSparseBitvector &rhs, size_t j) const {
+        size_t k = 0;
+        while (i + k < _bases.size() && j + k < rhs._bases.size() &&
+               _bases[i + k] == rhs._bases[j + k])
+            ++k;
+        return k;
+    }
+
+    void _append(const BlockSparseBitvector &from, size_t b, size_t num) {
+        _bases.insert(_bases.end(), from._bases.begin() + b,
+                      from._bases.begin() + b + num);
+        _words.insert(_words.end(), from._block(b),
+                      from._block(b) + num * WORDS_IN_BLOCK);
+    }
+
+    // union with 'rhs' that has some blocks that we do not have
+    void _mergeWithNewBlocks(const BlockSparseBitvector &rhs) {
+        BlockSparseBitvector tmp;
+        tmp._bases.reserve(_bases.size() + rhs._bases.size());
+        tmp._words.reserve(_words.size() + rhs._words.size());
+
+        size_t i = 0, j = 0;
+        while (i < _bases.size() || j < rhs._bases.size()) {
+            if (j == rhs._bases.size() ||
+                (i < _bases.size() && _bases[i] < rhs._bases[j])) {
+                tmp._append(*this, i++, 1);
+            } else if (i == _bases.size() || rhs._bases[j] < _bases[i]) {
+                tmp._append(rhs, j++, 1);
+            } else {
+                auto k = _run(i, rhs, j);
+                auto start = tmp._bases.size();
+                tmp._append(*this, i, k);
+                kernels::orWords(tmp._block(start), rhs._block(j),
+                                 k * WORDS_IN_BLOCK);
+                i += k;
+                j += k;
+            }
+        }
+
+        swap(tmp);
+    }
+
+  public:
+    BlockSparseBitvector() = default;
+    BlockSparseBitvector(IndexT i) { set(i); } // singleton ctor
+
+    BlockSparseBitvector(const BlockSparseBitvector &) = default;
+    BlockSparseBitvector(BlockSparseBitvector &&) = default;
+    BlockSparseBitvector &operator=(const BlockSparseBitvector &) = default;
+    BlockSparseBitvector &operator=(BlockSparseBitvector &&) = default;
+
+    void reset() {
+        _bases.clear();
+        _words.clear();
+    }
+
+    bool empty() const { return _bases.empty(); }
+
+    void swap(BlockSparseBitvector &oth) {
+        _bases.swap(oth._bases);
+        _words.swap(oth._words);
+    }
+
+    // reserve space for n set bits (in the worst case,
+    // every bit is in a different block)
+    void reserve(size_t n) {
+        _bases.reserve(n);
+        _words.reserve(n * WORDS_IN_BLOCK);
+    }
+
+    bool get(IndexT i) const {
+        auto base = _base(i);
+        auto b = _find(base);
+        if (!_hasBlock(b, base))
+            return false;
+
+        return _block(b)[_wordIdx(i)] & _mask(i);
+    }
+
+    // returns the previous value of the i-th bit
+    bool set(IndexT i) {
+        auto base = _base(i);
+        auto b = _find(base);
+        if (!_hasBlock(b, base)) {
+            _bases.insert(_bases.begin() + b, base);
+            _words.insert(_words.begin() + b * WORDS_IN_BLOCK, WORDS_IN_BLOCK,
+                          0);
+        }
+
+        uint64_t &W = _block(b)[_wordIdx(i)];
+        bool prev = W & _mask(i);
+        W |= _mask(i);
+        return prev;
+    }
+
+    // union operation, returns true if this bitvector changed
+    bool set(const BlockSparseBitvector &rhs) {
+        if (rhs.empty())
+            return false;
+
+        // do we have all the blocks of rhs? Then we can
+        // just merge the words in place.
+        if (!std::includes(_bases.begin(), _bases.end(), rhs._bases.begin(),
+                           rhs._bases.end())) {
+            _mergeWithNewBlocks(rhs);
+            return true;
+        }
+
+        bool changed = false;
+        size_t i = 0;
+        size_t j = 0;
+        while (j < rhs._bases.size()) {
+            i = std::lower_bound(_bases.begin() + i, _bases.end(),
+                                 rhs._bases[j]) -
+                _bases.begin();
+            assert(_hasBlock(i, rhs._bases[j]));
+            auto k = _run(i, rhs, j);
+            changed |= kernels::orWords(_block(i), rhs._block(j),
+                                        k * WORDS_IN_BLOCK);
+            i += k;
+            j += k;
+        }
+
+        return changed;
+    }
+
+    // intersection, returns true if this bitvector changed
+    bool intersect(const BlockSparseBitvector &rhs) {
+        BlockSparseBitvector tmp;
+        bool changed = false;
+        size_t i = 0;
+        size_t j = 0;
+        while (i < _bases.size() && j < rhs._bases.size()) {
+            if (_bases[i] < rhs._bases[j]) {
+                changed = true;
+                ++i;
+            } else if (rhs._bases[j] < _bases[i]) {
+                ++j;
+            } else {
+                auto k = _run(i, rhs, j);
+                auto start = tmp._bases.size();
+                tmp._append(*this, i, k);
+                changed |= kernels::andWords(tmp._block(start), rhs._block(j),
+                                             k * WORDS_IN_BLOCK);
+                i += k;
+                j += k;
+            }
+        }
+        changed |= i < _bases.size();
+
+        // remove the blocks that became empty
+        for (size_t b = tmp._bases.size(); b > 0; --b) {
+            if (tmp._isZero(b - 1))
+                tmp._eraseBlock(b - 1);
+        }
+
+        swap(tmp);
+        return changed;
+    }
+
+    // is every bit of 'rhs' set in this bitvector too?
+    // (i.e., would the union with 'rhs' leave this bitvector unchanged?)
+    bool includes(const BlockSparseBitvector &rhs) const {
+        size_t i = 0;
+        size_t j = 0;
+        while (j < rhs._bases.size()) {
+            i = std::lower_bound(_bases.begin() + i, _bases.end(),
+                                 rhs._bases[j]) -
+                _bases.begin();
+            // we do not have this (non-empty) block
+            if (!_hasBlock(i, rhs._bases[j]))
+                return false;
+            auto k = _run(i, rhs, j);
+            if (kernels::hasNewBits(_block(i), rhs._block(j),
+                                    k * WORDS_IN_BLOCK))
+                return false;
+            i += k;
+            j += k;
+        }
+        return true;
+    }
+
+    // returns the previous value of the i-th bit
+    bool unset(IndexT i) {
+        auto base = _base(i);
+        auto b = _find(base);
+        if (!_hasBlock(b, base))
+            return false;
+
+        uint64_t &W = _block(b)[_wordIdx(i)];
+        bool prev = W & _mask(i);
+        W &= ~_mask(i);
+        if (_isZero(b))
+            _eraseBlock(b);
+
+        assert(get(i) == 0 && "Failed removing");
+        return prev;
+    }
+
+    size_t size() const {
+        size_t num = 0;
+        for (uint64_t w : _words)
+            num += std::bitset<BITS_IN_WORD>(w).count();
+        return num;
+    }
+
+    bool operator==(const BlockSparseBitvector &rhs) const {
+        return _bases == rhs._bases && _words == rhs._words;
+    }
+
+    bool operator!=(const BlockSparseBitvector &rhs) const {
+        return !operator==(rhs);
+    }
+
+    class const_iterator {
+        const BlockSparseBitvector *bv{nullptr};
+        size_t block{0};
+        size_t pos{0};
+
+        const_iterator(const BlockSparseBitvector &b, bool end = false)
+                : bv(&b), block(end ? b._bases.size() : 0) {
+            // set-up the initial position
+            if (!end)
+                _findClosestBit();
+        }
+
+        // move to the closest set bit (including the current position)
+        void _findClosestBit() {
+            while (block < bv->_bases.size()) {
+                const uint64_t *W = bv->_block(block);
+                while (pos < BITS_IN_BLOCK) {
+                    auto w = W[pos / BITS_IN_WORD] >> (pos % BITS_IN_WORD);
+                    if (w == 0) {
+                        // skip the rest of the word
+                        pos += BITS_IN_WORD - (pos % BITS_IN_WORD);
+                        continue;
+                    }
+                    while (!(w & 0x1)) {
+                        w >>= 1;
+                        ++pos;
+                    }
+                    return;
+                }
+                ++block;
+                pos = 0;
+            }
+        }
+
+      public:
+        const_iterator() = default;
+        const_iterator &operator++() {
+            assert(block < bv->_bases.size() && "operator++ called on end");
+            ++pos;
+            _findClosestBit();
+            return *this;
+        }
+
+        const_iterator operator++(int) {
+            auto tmp = *this;
+            operator++();
+            return tmp;
+        }
+
+        IndexT operator*() const { return bv->_bases[block] + pos; }
+
+        bool operator==(const const_iterator &rhs) const {
+            return block == rhs.block && pos == rhs.pos;
+        }
+
+        bool operator!=(const const_iterator &rhs) const {
+            return !operator==(rhs);
+        }
+
+        friend class BlockSparseBitvector;
+    };
+
+    const_iterator begin() const { return const_iterator(*this); }
+    const_iterator end() const { return const_iterator(*this, true /* end */); }
+
+    friend class const_iterator;
+};
+
+} // namespace ADT
+} // namespace dg
+
+#endif // DG_BLOCK_BITVECTOR_H_
@@ -131,12 +131,8 @@ class DisjunctiveIntervalMap {
         if (_mapping.empty())
             return false;
 
-        auto ge = _find_ge(I);
-        if (ge == _mapping.end()) {
-            auto last = _get_last();
-            return last->first.end >= I.start;
-        }
-        return ge->first.start <= I.end;
+        // the interval that starts before I may overlap it too
+        return le(I) != end();
     }
 
     bool overlaps(IntervalValueT start, IntervalValueT end) const {
@@ -158,9 +154,9 @@ class DisjunctiveIntervalMap {
         if (ge->first.start > I.start) {
             if (ge == _mapping.begin())
                 return false;
-            auto prev = ge;
-            --prev;
-            if (prev->first.end != ge->first.start - 1)
+            // the previous interval must cover the start of I
+            --ge;
+            if (ge->first.end < I.start)
                 return false;
         }
 
@@ -268,6 +264,11 @@ class DisjunctiveIntervalMap {
         }
 
         while (true) {
+            // the rest of I lies before this interval
+            if (it->first.start > I.end) {
+                ret.push_back(cur);
+                break;
+            }
             assert(cur.start <= it->first.start);
             if (cur.start != it->first.start && cur.start < it->first.start) {
                 assert(it->first.start != 0 && "Underflow");
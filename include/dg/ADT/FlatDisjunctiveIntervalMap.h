@@ -0,0 +1,426 @@
+#ifndef DG_FLAT_DISJUNCTIVE_INTERVAL_MAP_H_
+#define DG_FLAT_DISJUNCTIVE_INTERVAL_MAP_H_
+
+#include <algorithm>
+#include <cassert>
+#include <set>
+#include <utility>
+#include <vector>
+
+#ifndef NDEBUG
+#include <iostream>
+#endif
+
+#include "dg/ADT/DisjunctiveIntervalMap.h"
+#include "dg/Offset.h"
+
+namespace dg {
+namespace ADT {
+
+///
+// Sorted set of values that keeps up to N values inline
+// (in the object) and allocates memory only for bigger sets.
+template <typename T, unsigned N = 2>
+class SmallSortedSet {
+    // number of values, if it is greater than N,
+    // all the values are stored in _large
+    size_t _size{0};
+    T _inline[N]{};
+    std::vector<T> _large;
+
+    T *_data() { return _size > N ? _large.data() : _inline; }
+    const T *_data() const { return _size > N ? _large.data() : _inline; }
+
+  public:
+    using const_iterator = const T *;
+    using iterator = const_iterator;
+
+    SmallSortedSet() = default;
+    SmallSortedSet(std::initializer_list<T> vals) {
+        for (const auto &v : vals)
+            insert(v);
+    }
+
+    const_iterator begin() const { return _data(); }
+    const_iterator end() const { return _data() + _size; }
+
+    size_t size() const { return _size; }
+    bool empty() const { return _size == 0; }
+
+    const_iterator find(const T &val) const {
+        auto it = std::lower_bound(begin(), end(), val);
+        if (it != end() && *it == val)
+            return it;
+        return end();
+    }
+
+    size_t count(const T &val) const { return find(val) == end() ? 0 : 1; }
+
+    std::pair<const_iterator, bool> insert(const T &val) {
+        auto pos = static_cast<size_t>(std::lower_bound(begin(), end(), val) -
+                                       begin());
+        if (pos < _size && _data()[pos] == val)
+            return {begin() + pos, false};
+
+        if (_size < N) {
+            std::move_backward(_inline + pos, _inline + _size,
+                               _inline + _size + 1);
+            _inline[pos] = val;
+        } else {
+            if (_size == N) {
+                // move the values to the heap
+                _large.reserve(2 * N);
+                _large.assign(_inline, _inline + N);
+            }
+            _large.insert(_large.begin() + pos, val);
+        }
+        ++_size;
+        return {begin() + pos, true};
+    }
+
+    void clear() {
+        _size = 0;
+        _large.clear();
+    }
+
+    bool operator==(const SmallSortedSet &rhs) const {
+        return _size == rhs._size && std::equal(begin(), end(), rhs.begin());
+    }
+
+    bool operator!=(const SmallSortedSet &rhs) const {
+        return !operator==(rhs);
+    }
+};
+
+///
+// Mapping of disjunctive discrete intervals of values to sets of ValueT
+// with the same interface as DisjunctiveIntervalMap. The intervals are
+// stored in a sorted vector and small sets of values are stored inline,
+// so small maps (the usual case) need just one allocation.
+template <typename ValueT, typename IntervalValueT = Offset>
+class FlatDisjunctiveIntervalMap {
+  public:
+    using IntervalT = DiscreteInterval<IntervalValueT>;
+    using ValuesT = SmallSortedSet<ValueT>;
+    using MappingT = std::vector<std::pair<IntervalT, ValuesT>>;
+    using iterator = typename MappingT::iterator;
+    using const_iterator = typename MappingT::const_iterator;
+
+    ///
+    // Return true if the mapping is updated anyhow
+    // (intervals split, value added).
+    bool add(const IntervalValueT start, const IntervalValueT end,
+             const ValueT &val) {
+        return add(IntervalT(start, end), val);
+    }
+
+    bool add(const IntervalT &I, const ValueT &val) {
+        return _add(I, val, false);
+    }
+
+    template <typename ContT>
+    bool add(const IntervalT &I, const ContT &vals) {
+        bool changed = false;
+        for (const ValueT &val : vals) {
+            changed |= _add(I, val, false);
+        }
+        return changed;
+    }
+
+    bool update(const IntervalValueT start, const IntervalValueT end,
+                const ValueT &val) {
+        return update(IntervalT(start, end), val);
+    }
+
+    bool update(const IntervalT &I, const ValueT &val) {
+        return _add(I, val, true);
+    }
+
+    template <typename ContT>
+    bool update(const IntervalT &I, const ContT &vals) {
+        bool changed = false;
+        for (const ValueT &val : vals) {
+            changed |= _add(I, val, true);
+        }
+        return changed;
+    }
+
+    // add the value 'val' to all intervals
+    bool addAll(const ValueT &val) {
+        bool changed = false;
+        for (auto &it : _mapping) {
+            changed |= it.second.insert(val).second;
+        }
+        return changed;
+    }
+
+    // return true if some intervals from the map
+    // has a overlap with I
+    bool overlaps(const IntervalT &I) const { return le(I) != end(); }
+
+    bool overlaps(IntervalValueT start, IntervalValueT end) const {
+        return overlaps(IntervalT(start, end));
+    }
+
+    // return true if the map has an entry for
+    // each single byte from the interval I
+    bool overlapsFull(const IntervalT &I) const {
+        auto it = le(I);
+        if (it == end() || it->first.start > I.start)
+            return false;
+
+        while (it->first.end < I.end) {
+            auto last_end = it->first.end;
+            ++it;
+            if (it == end() || it->first.start != last_end + 1)
+                return false;
+        }
+        return true;
+    }
+
+    bool overlapsFull(IntervalValueT start, IntervalValueT end) const {
+        return overlapsFull(IntervalT(start, end));
+    }
+
+    FlatDisjunctiveIntervalMap
+    intersection(const FlatDisjunctiveIntervalMap &rhs) const {
+        FlatDisjunctiveIntervalMap tmp;
+        auto it = _mapping.begin();
+        auto rhsit = rhs._mapping.begin();
+        while (it != _mapping.end() && rhsit != rhs._mapping.end()) {
+            if (it->first.end < rhsit->first.start) {
+                ++it;
+                continue;
+            }
+            if (rhsit->first.end < it->first.start) {
+                ++rhsit;
+                continue;
+            }
+
+            IntervalT I{std::max(it->first.start, rhsit->first.start),
+                        std::min(it->first.end, rhsit->first.end)};
+            for (const auto &val : it->second) {
+                if (rhsit->second.count(val) > 0)
+                    tmp.add(I, val);
+            }
+            // move the interval that ends first
+            if (it->first.end < rhsit->first.end)
+                ++it;
+            else
+                ++rhsit;
+        }
+        return tmp;
+    }
+
+    ///
+    // Gather all values that are covered by the interval I
+    std::set<ValueT> gather(IntervalValueT start, IntervalValueT end) const {
+        return gather(IntervalT(start, end));
+    }
+
+    std::set<ValueT> gather(const IntervalT &I) const {
+        std::set<ValueT> ret;
+        for (auto it = le(I); it != end() && it->first.start <= I.end; ++it) {
+            ret.insert(it->second.begin(), it->second.end());
+        }
+        return ret;
+    }
+
+    std::vector<IntervalT> uncovered(IntervalValueT start,
+                                     IntervalValueT end) const {
+        return uncovered(IntervalT(start, end));
+    }
+
+    std::vector<IntervalT> uncovered(const IntervalT &I) const {
+        std::vector<IntervalT> ret;
+        auto cur = I.start;
+        for (auto it = le(I); it != end() && it->first.start <= I.end; ++it) {
+            if (cur < it->first.start) {
+                ret.emplace_back(cur, it->first.start - 1);
+            }
+            if (it->first.end >= I.end)
+                return ret;
+            cur = it->first.end + 1;
+        }
+        ret.emplace_back(cur, I.end);
+        return ret;
+    }
+
+    bool empty() const { return _mapping.empty(); }
+    size_t size() const { return _mapping.size(); }
+
+    iterator begin() { return _mapping.begin(); }
+    const_iterator begin() const { return _mapping.begin(); }
+    iterator end() { return _mapping.end(); }
+    const_iterator end() const { return _mapping.end(); }
+
+    bool operator==(const FlatDisjunctiveIntervalMap &rhs) const {
+        return _mapping == rhs._mapping;
+    }
+
+    // return the iterator to an element that is the first
+    // that overlaps the interval I or end() if there is
+    // no such interval
+    iterator le(const IntervalT &I) {
+        auto it = _find_end_ge(I.start);
+        if (it != end() && it->first.start > I.end)
+            return end();
+        return it;
+    }
+
+    const_iterator le(const IntervalT &I) const {
+        auto it = _find_end_ge(I.start);
+        if (it != end() && it->first.start > I.end)
+            return end();
+        return it;
+    }
+
+    iterator le(const IntervalValueT start, const IntervalValueT end) {
+        return le(IntervalT(start, end));
+    }
+
+    const_iterator le(const IntervalValueT start,
+                      const IntervalValueT end) const {
+        return le(IntervalT(start, end));
+    }
+
+#ifndef NDEBUG
+    friend std::ostream &
+    operator<<(std::ostream &os,
+               const FlatDisjunctiveIntervalMap<ValueT, IntervalValueT> &map) {
+        os << "{";
+        for (const auto &pair : map) {
+            if (pair.second.empty())
+                continue;
+
+            os << "{ ";
+            os << pair.first.start << "-" << pair.first.end;
+            os << ": " << *pair.second.begin();
+            os << " }, ";
+        }
+        os << "}";
+        return os;
+    }
+
+    void dump() const { std::cout << *this << "\n"; }
+#endif
+
+  private:
+    // the first interval that ends at 'start' or later
+    // (the intervals are disjunctive, so also the ends are sorted)
+    iterator _find_end_ge(IntervalValueT start) {
+        return std::lower_bound(_mapping.begin(), _mapping.end(), start,
+                                [](const typename MappingT::value_type &elem,
+                                   IntervalValueT val) {
+                                    return elem.first.end < val;
+                                });
+    }
+
+    const_iterator _find_end_ge(IntervalValueT start) const {
+        return std::lower_bound(_mapping.begin(), _mapping.end(), start,
+                                [](const typename MappingT::value_type &elem,
+                                   IntervalValueT val) {
+                                    return elem.first.end < val;
+                                });
+    }
+
+    static bool _addValue(ValuesT &values, const ValueT &val, bool update) {
+        if (update) {
+            if (values.size() == 1 && values.count(val) > 0)
+                return false;
+
+            values.clear();
+            values.insert(val);
+            return true;
+        }
+
+        return values.insert(val).second;
+    }
+
+    // If the boolean 'update' is set to true, the value
+    // is not added, but rewritten
+    bool _add(const IntervalT &I, const ValueT &val, bool update = false) {
+        auto first = _find_end_ge(I.start);
+
+        // no overlapping interval, just insert the new one
+        if (first == _mapping.end() || first->first.start > I.end) {
+            _mapping.emplace(first, I, ValuesT{val});
+            return true;
+        }
+
+        // fast path -- the interval is already in the map
+        if (first->first == I) {
+            return _addValue(first->second, val, update);
+        }
+
+        // Replace the overlapping intervals [first, last) by the intervals
+        // split on the borders of I, with the gaps in I filled.
+        auto last = first;
+        while (last != _mapping.end() && last->first.start <= I.end)
+            ++last;
+
+        // reuse the memory for the new intervals among the calls
+        static thread_local MappingT replacement;
+        replacement.clear();
+        bool changed = false;
+        auto cur = I.start;
+        for (auto it = first; it != last; ++it) {
+            const auto &interval = it->first;
+            if (interval.start < I.start) {
+                // the part left to I keeps the original values
+                replacement.emplace_back(IntervalT(interval.start, I.start - 1),
+                                         it->second);
+                changed = true;
+            } else if (cur < interval.start) {
+                // the gap in front of this interval
+                replacement.emplace_back(IntervalT(cur, interval.start - 1),
+                                         ValuesT{val});
+                changed = true;
+            }
+
+            IntervalT overlap{std::max(interval.start, I.start),
+                              std::min(interval.end, I.end)};
+            replacement.emplace_back(overlap, it->second);
+            changed |= _addValue(replacement.back().second, val, update);
+
+            if (interval.end > I.end) {
+                // the part right to I keeps the original values
+                replacement.emplace_back(IntervalT(I.end + 1, interval.end),
+                                         std::move(it->second));
+                changed = true;
+            }
+            cur = overlap.end + 1;
+        }
+
+        // the rest of I after the last interval
+        if (replacement.back().first.end < I.end) {
+            replacement.emplace_back(IntervalT(cur, I.end), ValuesT{val});
+            changed = true;
+        }
+
+        // replace the old intervals
+        auto pos = _mapping.erase(first, last);
+        _mapping.insert(pos, std::make_move_iterator(replacement.begin()),
+                        std::make_move_iterator(replacement.end()));
+
+        _check();
+        return changed;
+    }
+
+    void _check() const {
+#ifndef NDEBUG
+        // check that the keys are disjunctive and sorted
+        for (size_t i = 1; i < _mapping.size(); ++i) {
+            assert(_mapping[i - 1].first.start <= _mapping[i - 1].first.end);
+            assert(_mapping[i - 1].first.end < _mapping[i].first.start);
+        }
+#endif // NDEBUG
+    }
+
+    MappingT _mapping;
+};
+
+} // namespace ADT
+} // namespace dg
+
+#endif // DG_FLAT_DISJUNCTIVE_INTERVAL_MAP_H_
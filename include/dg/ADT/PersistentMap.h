@@ -0,0 +1,279 @@
+#ifndef DG_ADT_PERSISTENT_MAP_H_
+#define DG_ADT_PERSISTENT_MAP_H_
+
+#include <cassert>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace dg {
+namespace ADT {
+
+///
+// Persistent (functional) map with structural sharing.
+//
+// The map is a hash array mapped trie (in the CHAMP layout): every node
+// has 32 slots indexed by 5 bits of the hash of the key and keeps
+// its key-value pairs and its children in two arrays that are compressed
+// by bitmaps. The nodes are immutable, so copying the map is O(1)
+// and the copies share all the nodes. Changing the map copies only
+// the nodes on the path from the root to the changed entry.
+//
+// Maps that were created from each other share the unchanged subtrees,
+// forEachDifferent() uses this to skip them when comparing the maps.
+//
+// The map does not support removing elements.
+template <typename KeyT, typename ValueT, typename HashT = std::hash<KeyT>>
+class PersistentMap {
+    static const unsigned BITS = 5;
+    static const unsigned MASK = (1U << BITS) - 1;
+    // when we run out of bits of the hash,
+    // the node is a list of colliding entries
+    static const unsigned HASH_BITS = sizeof(size_t) * 8;
+
+    struct Node {
+        uint32_t datamap{0};
+        uint32_t nodemap{0};
+        std::vector<std::pair<KeyT, ValueT>> data;
+        std::vector<std::shared_ptr<const Node>> children;
+    };
+
+    using NodePtr = std::shared_ptr<const Node>;
+
+    NodePtr _root;
+    size_t _size{0};
+
+    static size_t hash(const KeyT &key) { return HashT()(key); }
+
+    static uint32_t bit(size_t h, unsigned shift) {
+        return 1U << ((h >> shift) & MASK);
+    }
+
+    static unsigned index(uint32_t map, uint32_t b) {
+        return __builtin_popcount(map & (b - 1));
+    }
+
+    static const ValueT *findRec(const Node *node, const KeyT &key, size_t h,
+                                 unsigned shift) {
+        while (node) {
+            if (shift >= HASH_BITS) {
+                for (const auto &e : node->data) {
+                    if (e.first == key)
+                        return &e.second;
+                }
+                return nullptr;
+            }
+
+            auto b = bit(h, shift);
+            if (node->datamap & b) {
+                const auto &e = node->data[index(node->datamap, b)];
+                return e.first == key ? &e.second : nullptr;
+            }
+            if (!(node->nodemap & b))
+                return nullptr;
+
+            node = node->children[index(node->nodemap, b)].get();
+            shift += BITS;
+        }
+
+        return nullptr;
+    }
+
+    // create a node with two entries that have different keys
+    static NodePtr makeNode(const KeyT &k1, const ValueT &v1, size_t h1,
+                            const KeyT &k2, const ValueT &v2, size_t h2,
+                            unsigned shift) {
+        auto *node = new Node();
+        if (shift >= HASH_BITS) {
+            node->data.emplace_back(k1, v1);
+            node->data.emplace_back(k2, v2);
+            return NodePtr(node);
+        }
+
+        auto b1 = bit(h1, shift);
+        auto b2 = bit(h2, shift);
+        if (b1 == b2) {
+            node->nodemap = b1;
+            node->children.push_back(
+                    makeNode(k1, v1, h1, k2, v2, h2, shift + BITS));
+        } else {
+            node->datamap = b1 | b2;
+            if (b1 < b2) {
+                node->data.emplace_back(k1, v1);
+                node->data.emplace_back(k2, v2);
+            } else {
+                node->data.emplace_back(k2, v2);
+                node->data.emplace_back(k1, v1);
+            }
+        }
+
+        return NodePtr(node);
+    }
+
+    // Return the copy of 'node' with the key set to the value
+    // or nullptr if the value is already there.
+    static NodePtr setRec(const Node *node, const KeyT &key,
+                          const ValueT &value, size_t h, unsigned shift,
+                          bool &inserted) {
+        if (shift >= HASH_BITS) {
+            for (size_t i = 0; i < node->data.size(); ++i) {
+                if (node->data[i].first == key) {
+                    if (node->data[i].second == value)
+                        return nullptr;
+                    auto *copy = new Node(*node);
+                    copy->data[i].second = value;
+                    return NodePtr(copy);
+                }
+            }
+
+            auto *copy = new Node(*node);
+            copy->data.emplace_back(key, value);
+            inserted = true;
+            return NodePtr(copy);
+        }
+
+        auto b = bit(h, shift);
+        if (node->datamap & b) {
+            auto idx = index(node->datamap, b);
+            const auto &e = node->data[idx];
+            if (e.first == key) {
+                if (e.second == value)
+                    return nullptr;
+                auto *copy = new Node(*node);
+                copy->data[idx].second = value;
+                return NodePtr(copy);
+            }
+
+            // move the entry into a new child node
+            auto child = makeNode(e.first, e.second, hash(e.first), key, value,
+                                  h, shift + BITS);
+            auto *copy = new Node(*node);
+            copy->data.erase(copy->data.begin() + idx);
+            copy->datamap ^= b;
+            copy->nodemap |= b;
+            copy->children.insert(copy->children.begin() +
+                                          index(copy->nodemap, b),
+                                  std::move(child));
+            inserted = true;
+            return NodePtr(copy);
+        }
+
+        if (node->nodemap & b) {
+            auto idx = index(node->nodemap, b);
+            auto child = setRec(node->children[idx].get(), key, value, h,
+                                shift + BITS, inserted);
+            if (!child)
+                return nullptr;
+            auto *copy = new Node(*node);
+            copy->children[idx] = std::move(child);
+            return NodePtr(copy);
+        }
+
+        auto *copy = new Node(*node);
+        copy->datamap |= b;
+        copy->data.insert(copy->data.begin() + index(copy->datamap, b),
+                          std::make_pair(key, value));
+        inserted = true;
+        return NodePtr(copy);
+    }
+
+    template <typename FunT>
+    static void forEachRec(const Node *node, FunT &fun) {
+        for (const auto &e : node->data)
+            fun(e.first, e.second);
+        for (const auto &child : node->children)
+            forEachRec(child.get(), fun);
+    }
+
+    // call fun on the entries from 'theirs' that differ from 'mine'
+    template <typename FunT>
+    static void diffRec(const Node *mine, const Node *theirs, unsigned shift,
+                        FunT &fun) {
+        if (mine == theirs)
+            return;
+
+        auto report = [&fun, mine, shift](const KeyT &k, const ValueT &v) {
+            const ValueT *my = findRec(mine, k, hash(k), shift);
+            if (!my || !(*my == v))
+                fun(k, v, my);
+        };
+
+        if (!mine || shift >= HASH_BITS) {
+            forEachRec(theirs, report);
+            return;
+        }
+
+        for (unsigned i = 0; i <= MASK; ++i) {
+            uint32_t b = 1U << i;
+            if (theirs->datamap & b) {
+                report(theirs->data[index(theirs->datamap, b)].first,
+                       theirs->data[index(theirs->datamap, b)].second);
+            } else if (theirs->nodemap & b) {
+                const Node *child =
+                        theirs->children[index(theirs->nodemap, b)].get();
+                if (mine->nodemap & b) {
+                    diffRec(mine->children[index(mine->nodemap, b)].get(),
+                            child, shift + BITS, fun);
+                } else {
+                    forEachRec(child, report);
+                }
+            }
+        }
+    }
+
+  public:
+    PersistentMap() = default;
+
+    size_t size() const { return _size; }
+    bool empty() const { return _size == 0; }
+
+    const ValueT *find(const KeyT &key) const {
+        return findRec(_root.get(), key, hash(key), 0);
+    }
+
+    // Set the value of the key. Return true if the map changed.
+    bool set(const KeyT &key, const ValueT &value) {
+        const Node empty{};
+        bool inserted = false;
+        auto newRoot = setRec(_root ? _root.get() : &empty, key, value,
+                              hash(key), 0, inserted);
+        if (!newRoot)
+            return false;
+
+        _root = std::move(newRoot);
+        if (inserted)
+            ++_size;
+        return true;
+    }
+
+    // do the maps share all the data?
+    bool same(const PersistentMap &rhs) const { return _root == rhs._root; }
+
+    // Call fun(key, value) for every entry of the map.
+    template <typename FunT>
+    void forEach(FunT fun) const {
+        if (_root)
+            forEachRec(_root.get(), fun);
+    }
+
+    // Call fun(key, value, myvalue) for every entry (key, value) from 'rhs'
+    // that is not in this map with the same value. 'myvalue' is
+    // the pointer to the value of the key in this map or nullptr.
+    // The subtrees shared by the maps are skipped. The callback may
+    // modify this map, the walk goes over the map from before the call.
+    template <typename FunT>
+    void forEachDifferent(const PersistentMap &rhs, FunT fun) const {
+        if (!rhs._root)
+            return;
+        // keep the nodes alive even if the callback changes this map
+        NodePtr mine = _root;
+        diffRec(mine.get(), rhs._root.get(), 0, fun);
+    }
+};
+
+} // namespace ADT
+} // namespace dg
+
+#endif // DG_ADT_PERSISTENT_MAP_H_
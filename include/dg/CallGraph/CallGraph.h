@@ -1,6 +1,7 @@
 #ifndef DG_GENERIC_CALLGRAPH_H_
 #define DG_GENERIC_CALLGRAPH_H_
 
+#include <algorithm>
 #include <map>
 #include <vector>
 
@@ -44,6 +45,16 @@ class GenericCallGraph {
             return true;
         }
 
+        bool removeCall(FuncNode *x) {
+            auto it = std::find(_calls.begin(), _calls.end(), x);
+            if (it == _calls.end())
+                return false;
+            _calls.erase(it);
+            x->_callers.erase(std::find(x->_callers.begin(),
+                                        x->_callers.end(), this));
+            return true;
+        }
+
         const std::vector<FuncNode *> &getCalls() const { return _calls; }
         // alias for getCalls()
         const std::vector<FuncNode *> &successors() const { return getCalls(); }
@@ -78,6 +89,26 @@ class GenericCallGraph {
         return A->addCall(B);
     }
 
+    // remove all calls from the function 'a'
+    void removeCalls(const ValueT &a) {
+        auto *A = get(a);
+        if (!A)
+            return;
+        while (!A->getCalls().empty())
+            A->removeCall(A->getCalls().back());
+    }
+
+    // remove the function 'a' together with its calls
+    void remove(const ValueT &a) {
+        auto *A = get(a);
+        if (!A)
+            return;
+        removeCalls(a);
+        while (!A->getCallers().empty())
+            A->getCallers().back()->removeCall(A);
+        _mapping.erase(a);
+    }
+
     const FuncNode *get(const ValueT &v) const {
         auto it = _mapping.find(v);
         if (it == _mapping.end()) {
@@ -14,6 +14,7 @@ struct ControlDependenceAnalysisOptions : AnalysisOptions {
         NTSCD_RANGANATH,      // fixed version of Ranganath's alg.
         NTSCD_RANGANATH_ORIG, // original (wrong) version of Ranaganath's alg.
         NTSCD,
+        NTSCD_FAST, // NTSCD computed without coloring for every node
         DOD_RANGANATH,
         DOD,
         DODNTSCD, // DOD + NTSCD
@@ -24,9 +25,15 @@ struct ControlDependenceAnalysisOptions : AnalysisOptions {
     // (raising e.g., from calls to exit() which terminates the program)
     bool interprocedural{true};
 
+    // The number of threads used by the algorithms that compute
+    // the dependencies for every node (or predicate) of a function
+    // independently (NTSCD, NTSCD2, DOD, and DOD+NTSCD).
+    unsigned computeThreads{1};
+
     bool standardCD() const { return algorithm == CDAlgorithm::STANDARD; }
     bool ntscdCD() const { return algorithm == CDAlgorithm::NTSCD; }
     bool ntscd2CD() const { return algorithm == CDAlgorithm::NTSCD2; }
+    bool ntscdFastCD() const { return algorithm == CDAlgorithm::NTSCD_FAST; }
     bool ntscdRanganathCD() const {
         return algorithm == CDAlgorithm::NTSCD_RANGANATH;
     }
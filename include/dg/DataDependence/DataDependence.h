@@ -59,6 +59,19 @@ class DataDependenceAnalysis {
         return _impl->getDefinitions(use);
     }
 
+    // return reaching definitions of the use, or an over-approximation
+    // of them if the search exceeds the budget
+    DefinitionsQueryResult
+    getDefinitions(RWNode *use, const DefinitionsQueryBudget &budget) {
+        return _impl->getDefinitions(use, budget);
+    }
+
+    DefinitionsQueryResult
+    getDefinitions(RWNode *where, RWNode *mem, const Offset &off,
+                   const Offset &len, const DefinitionsQueryBudget &budget) {
+        return _impl->getDefinitions(where, mem, off, len, budget);
+    }
+
     const DataDependenceAnalysisOptions &getOptions() const { return _options; }
 
     DataDependenceAnalysisImpl *getImpl() { return _impl.get(); }
@@ -3,6 +3,7 @@
 
 #include <cassert>
 #include <utility>
+#include <vector>
 
 #include "dg/DataDependence/DataDependenceAnalysisOptions.h"
 #include "dg/Offset.h"
@@ -13,6 +14,31 @@
 namespace dg {
 namespace dda {
 
+///
+// Limits of a single demand-driven query for definitions.
+// Zero means no limit.
+struct DefinitionsQueryBudget {
+    // the maximal number of nodes visited by the search
+    size_t maxNodes{0};
+    // the maximal time of the search in milliseconds
+    unsigned maxTime{0};
+
+    DefinitionsQueryBudget() = default;
+    DefinitionsQueryBudget(size_t nodes, unsigned time = 0)
+            : maxNodes(nodes), maxTime(time) {}
+
+    bool unlimited() const { return maxNodes == 0 && maxTime == 0; }
+};
+
+struct DefinitionsQueryResult {
+    std::vector<RWNode *> definitions;
+    // If the budget was exhausted before finding all the definitions,
+    // 'exact' is false and 'definitions' contain the definitions found
+    // so far and UNKNOWN_MEMORY (i.e., the use may read the value
+    // written by any node).
+    bool exact{true};
+};
+
 // here the types are for type-checking (optional - user can do it
 // when building the graph) and for later optimizations
 
@@ -52,6 +78,20 @@ class DataDependenceAnalysisImpl {
     // return reaching definitions of a node that represents
     // the given use
     virtual std::vector<RWNode *> getDefinitions(RWNode *use) = 0;
+
+    // return reaching definitions of the use, but do not spend more
+    // than 'budget' on the search
+    virtual DefinitionsQueryResult
+    getDefinitions(RWNode *use, const DefinitionsQueryBudget & /*budget*/) {
+        return {getDefinitions(use), true};
+    }
+
+    virtual DefinitionsQueryResult
+    getDefinitions(RWNode *where, RWNode *mem, const Offset &off,
+                   const Offset &len,
+                   const DefinitionsQueryBudget & /*budget*/) {
+        return {getDefinitions(where, mem, off, len), true};
+    }
 };
 
 } // namespace dda
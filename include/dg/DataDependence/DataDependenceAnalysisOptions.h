@@ -128,6 +128,38 @@ struct DataDependenceAnalysisOptions : AnalysisOptions {
         return *this;
     }
 
+    // Compute the definitions of all uses already in run()
+    // using this number of threads. 0 means that the definitions
+    // are computed on demand, 1 that they are computed eagerly
+    // but sequentially.
+    unsigned eagerThreads{0};
+
+    DataDependenceAnalysisOptions &setEagerThreads(unsigned n) {
+        eagerThreads = n;
+        return *this;
+    }
+
+    // Compute the summaries of all procedures already in run(),
+    // bottom-up over the call graph (using eagerThreads threads).
+    // The search for definitions then never continues into called
+    // procedures.
+    bool summaries{false};
+
+    DataDependenceAnalysisOptions &setSummaries(bool b) {
+        summaries = b;
+        return *this;
+    }
+
+    // Track the memory that is always overwritten as a whole (e.g., local
+    // variables whose address is not taken) only by its last definition
+    // instead of by the intervals of bytes.
+    bool scalarObjects{false};
+
+    DataDependenceAnalysisOptions &setScalarObjects(bool b) {
+        scalarObjects = b;
+        return *this;
+    }
+
     std::map<const std::string, FunctionModel> functionModels;
 
     const FunctionModel *getFunctionModel(const std::string &name) const {
@@ -2,6 +2,7 @@
 #define DG_MEMORY_SSA_DEFINITIONS_H_
 
 #include <set>
+#include <unordered_map>
 #include <vector>
 
 #include "dg/MemorySSA/DefinitionsMap.h"
@@ -28,10 +29,23 @@ struct Definitions {
     // writes to unknown memory in this block
     std::vector<RWNode *> unknownWrites;
 
+    // Definitions of scalar memory (see RWNode::isScalar()) that bypass
+    // the maps above. The memory is always overwritten as a whole, so it is
+    // enough to remember its last definition and the number of writes
+    // to unknown memory that preceded it (the later ones define it too).
+    // The memory is also killed by this block.
+    struct ScalarDefinition {
+        RWNode *node;
+        Offset len;
+        size_t unknownWritesNum;
+    };
+    std::unordered_map<RWNode *, ScalarDefinition> scalars;
+
     void swap(Definitions &rhs) {
         definitions.swap(rhs.definitions);
         kills.swap(rhs.kills);
         unknownWrites.swap(rhs.unknownWrites);
+        scalars.swap(rhs.scalars);
     }
 
     void addUnknownWrite(RWNode *n) { unknownWrites.push_back(n); }
@@ -45,6 +59,9 @@ struct Definitions {
     ///
     std::set<RWNode *> get(const DefSite &ds) {
         auto retval = definitions.get(ds);
+        if (!scalars.empty()) {
+            addScalarDefinitions(ds, retval);
+        }
         if (retval.empty()) {
             retval.insert(unknownWrites.begin(), unknownWrites.end());
         }
@@ -61,9 +78,20 @@ struct Definitions {
 
     auto uncovered(const DefSite &ds) const
             -> decltype(kills.undefinedIntervals(ds)) {
-        return kills.undefinedIntervals(ds);
+        auto ret = kills.undefinedIntervals(ds);
+        if (!scalars.empty()) {
+            removeKilledScalar(ds.target, ret);
+        }
+        return ret;
     }
 
+    // the nodes that define the scalar memory at the end of the block
+    std::vector<RWNode *>
+    getScalarDefinitions(const ScalarDefinition &sd) const;
+    // move the definitions of scalar memory to the maps of intervals
+    // (for the code that works with the maps directly)
+    void expandScalars();
+
     // for on-demand analysis
     // once isProcessed is true, the Defiitions contain
     // summarized all the information that one needs
@@ -74,6 +102,12 @@ struct Definitions {
 #ifndef NDEBUG
     void dump() const;
 #endif
+
+  private:
+    void addScalarDefinitions(const DefSite &ds,
+                              std::set<RWNode *> &defs) const;
+    using IntervalsT = std::vector<DefinitionsMap<RWNode>::IntervalT>;
+    void removeKilledScalar(const RWNode *target, IntervalsT &intervals) const;
 };
 
 } // namespace dda
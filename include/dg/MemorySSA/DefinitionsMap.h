@@ -9,6 +9,7 @@
 #endif
 
 #include "dg/ADT/DisjunctiveIntervalMap.h"
+#include "dg/ADT/FlatDisjunctiveIntervalMap.h"
 #include "dg/Offset.h"
 #include "dg/ReadWriteGraph/DefSite.h"
 
@@ -24,7 +25,11 @@ class ReachingDefinitionsAnalysis;
 template <typename NodeT = RWNode>
 class DefinitionsMap {
   public:
+#if defined(FLAT_INTERVAL_MAPS)
+    using OffsetsT = ADT::FlatDisjunctiveIntervalMap<NodeT *>;
+#else
     using OffsetsT = ADT::DisjunctiveIntervalMap<NodeT *>;
+#endif
     using IntervalT = typename OffsetsT::IntervalT;
 
   private:
@@ -1,7 +1,12 @@
 #ifndef DG_MEMORY_SSA_H_
 #define DG_MEMORY_SSA_H_
 
+#include <atomic>
 #include <cassert>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <set>
 #include <unordered_map>
 #include <vector>
@@ -25,7 +30,8 @@ namespace dda {
 
 class MemorySSATransformation : public DataDependenceAnalysisImpl {
     class BBlockInfo {
-        Definitions definitions{};
+        // created when a query reaches the block for the first time
+        std::unique_ptr<Definitions> definitions;
         RWNodeCall *call{nullptr};
 
       public:
@@ -34,8 +40,13 @@ class MemorySSATransformation : public DataDependenceAnalysisImpl {
         RWNodeCall *getCall() { return call; }
         const RWNodeCall *getCall() const { return call; }
 
-        Definitions &getDefinitions() { return definitions; }
-        const Definitions &getDefinitions() const { return definitions; }
+        Definitions &getDefinitions() {
+            if (!definitions)
+                definitions.reset(new Definitions());
+            return *definitions;
+        }
+        // nullptr if no query reached the block yet
+        const Definitions *getDefinitions() const { return definitions.get(); }
     };
 
     class SubgraphInfo {
@@ -78,6 +89,10 @@ class MemorySSATransformation : public DataDependenceAnalysisImpl {
         // effects of the procedure
         ModRefInfo modref;
 
+        // the summary contains the outputs for all the memory
+        // that the procedure may define
+        bool summarized{false};
+
         SubgraphInfo(RWSubgraph *s);
 
         friend class MemorySSATransformation;
@@ -96,6 +111,11 @@ class MemorySSATransformation : public DataDependenceAnalysisImpl {
 
     void initialize();
 
+    // mark the memory that is always overwritten as a whole as scalar
+    // (if options.scalarObjects is set)
+    void findScalars();
+    std::unordered_map<RWNode *, Offset> _scalar_sizes;
+
     ////
     // LVN
     ///
@@ -188,8 +208,33 @@ class MemorySSATransformation : public DataDependenceAnalysisImpl {
                                        const DefSite &ds, RWNode *calledValue);
 
     void computeModRef(RWSubgraph *subg, SubgraphInfo &si);
+    // compute modref of procedures that form an SCC in the call graph
+    // (the modref of the procedures that they call must be computed already)
+    void computeModRef(const std::vector<RWSubgraph *> &scc);
+
+    ///
+    // Summaries computed bottom-up over the call graph. The SCCs of the
+    // call graph are grouped into levels such that the SCCs from one level
+    // call only the SCCs from lower levels, so the SCCs from one level
+    // can be summarized in parallel.
+    std::vector<std::vector<std::vector<RWSubgraph *>>> getCallGraphLevels();
+    void computeSummary(RWSubgraph *subg);
+    // are all the procedures called by C summarized?
+    bool isSummarized(RWNodeCall *C);
+    // set while summarizing procedures in parallel, the search
+    // for definitions in callers is postponed at that time
+    bool _summarizing{false};
     bool callMayDefineTarget(RWNodeCall *C, RWNode *target);
 
+    ///
+    // Parallel eager computation of definitions. The definitions of uses
+    // whose search cannot leave the subgraph are computed concurrently
+    // (one subgraph is processed by one thread), the rest is left
+    // for the sequential search.
+    void computeIntraproceduralDefinitions(unsigned threads);
+    bool isIntraproceduralUse(RWNode *use,
+                              const std::vector<RWNodeCall *> &calls);
+
     RWNode *createPhi(const DefSite &ds, RWNodeType type = RWNodeType::PHI);
     RWNode *createPhi(Definitions &D, const DefSite &ds,
                       RWNodeType type = RWNodeType::PHI);
@@ -199,13 +244,89 @@ class MemorySSATransformation : public DataDependenceAnalysisImpl {
     RWNode *insertUse(RWNode *where, RWNode *mem, const Offset &off,
                       const Offset &len);
 
+    ///
+    // Budget of the running demand-driven query (nullptr if the query
+    // is not limited). When the budget is exhausted, the search for
+    // operands of new phi nodes is postponed until a query needs them.
+    class QueryBudget {
+        const DefinitionsQueryBudget &budget;
+        size_t visited{0};
+        std::chrono::steady_clock::time_point start;
+
+      public:
+        QueryBudget(const DefinitionsQueryBudget &b)
+                : budget(b), start(std::chrono::steady_clock::now()) {}
+
+        void visit(size_t n = 1) { visited += n; }
+        bool exhausted() const {
+            if (budget.maxNodes > 0 && visited >= budget.maxNodes)
+                return true;
+            if (budget.maxTime > 0) {
+                auto elapsed = std::chrono::steady_clock::now() - start;
+                return std::chrono::duration_cast<std::chrono::milliseconds>(
+                               elapsed)
+                               .count() >= budget.maxTime;
+            }
+            return false;
+        }
+    };
+
+    QueryBudget *_budget{nullptr};
+    std::unordered_map<RWNode *, std::function<void()>> _pending_phis;
+
+    // search the operands of the phi node now or postpone it
+    // if the budget of the query is exhausted
+    template <typename SearchT>
+    void searchPhiOperands(RWNode *phi, SearchT search) {
+        if (_budget) {
+            if (_budget->exhausted()) {
+                _pending_phis.emplace(phi, std::move(search));
+                return;
+            }
+            _budget->visit();
+        }
+        search();
+    }
+
+    void completePendingPhi(RWNode *phi);
+    void completePendingPhis();
+    std::vector<RWNode *> getPendingPhis(RWNode *use) const;
+    DefinitionsQueryResult getDefinitionsWithBudget(RWNode *use);
+
     std::vector<RWNode *> _phis;
+    // guards creating nodes in the graph (and _phis, _pending_phis)
+    // when the definitions are computed in parallel
+    std::mutex _nodes_lock;
+
+    ///
+    // Non-phi definitions that reach the phi nodes (IDs of the nodes,
+    // sorted). All phi nodes from one SCC of the phi graph share the set.
+    // Creating new phi nodes may add edges into the phi graph,
+    // so the cache is valid only while the number of phis is the same.
+    using NonPhiDefsT = std::vector<unsigned>;
+    std::unordered_map<const RWNode *, std::shared_ptr<const NonPhiDefsT>>
+            _nonphi_defs;
+    size_t _nonphi_defs_phis{0};
+
+    struct PhiSCCState;
+    const NonPhiDefsT &getNonPhiDefs(RWNode *phi);
+    void collapsePhis(RWNode *phi, PhiSCCState &state);
+    std::vector<RWNode *> gatherNonPhisDefs(RWNode *use);
     dg::ADT::QueueLIFO<RWNode> _queue;
     std::unordered_map<const RWSubgraph *, SubgraphInfo> _subgraphs_info;
 
+    size_t _bblocks_num{0};
+    // (blocks may be processed in parallel)
+    std::atomic<size_t> _lvn_bblocks{0};
+
     Definitions &getBBlockDefinitions(RWBBlock *b, const DefSite *ds = nullptr);
 
     SubgraphInfo &getSubgraphInfo(const RWSubgraph *s) {
+        // do not use operator[] for existing infos,
+        // the lookup must be safe to call from more threads
+        auto it = _subgraphs_info.find(s);
+        if (it != _subgraphs_info.end())
+            return it->second;
         return _subgraphs_info[s];
     }
     const SubgraphInfo *getSubgraphInfo(const RWSubgraph *s) const {
@@ -240,9 +361,15 @@ class MemorySSATransformation : public DataDependenceAnalysisImpl {
 
     // compute definitions for all uses at once
     // (otherwise the definitions are computed on demand
-    // when calling getDefinitions())
+    // when calling getDefinitions()). Uses options.eagerThreads threads.
     void computeAllDefinitions();
 
+    // compute modref and summaries of all procedures bottom-up over the
+    // call graph using options.eagerThreads threads (at least one). After
+    // that, the search for definitions never continues into called
+    // procedures.
+    void computeSummaries();
+
     // return the reaching definitions of ('mem', 'off', 'len')
     // at the location 'where'
     std::vector<RWNode *> getDefinitions(RWNode *where, RWNode *mem,
@@ -251,11 +378,37 @@ class MemorySSATransformation : public DataDependenceAnalysisImpl {
 
     std::vector<RWNode *> getDefinitions(RWNode *use) override;
 
+    // Return the reaching definitions of the use, but stop searching
+    // when the budget is exhausted. The search that was not finished
+    // is resumed by later queries that need it.
+    DefinitionsQueryResult
+    getDefinitions(RWNode *use, const DefinitionsQueryBudget &budget) override;
+
+    DefinitionsQueryResult
+    getDefinitions(RWNode *where, RWNode *mem, const Offset &off,
+                   const Offset &len,
+                   const DefinitionsQueryBudget &budget) override;
+
+    ///
+    // Forget the definitions found for the use (they are searched again
+    // if the use is queried again) and the cached non-phi definitions
+    // of phi nodes. Clients that query many uses one by one and do not
+    // need the answers afterwards use these to keep the memory from
+    // growing with the number of answers. The phi nodes are kept,
+    // they are shared by all the queries.
+    void releaseDefinitions(RWNode *use);
+    void releaseCachedDefinitions();
+
     const Definitions *getDefinitions(RWBBlock *b) const {
         const auto *bi = getBBlockInfo(b);
-        return bi ? &bi->getDefinitions() : nullptr;
+        return bi ? bi->getDefinitions() : nullptr;
     }
 
+    // the number of basic blocks in the graph and the number of blocks
+    // that LVN was performed for (the rest was not needed by any query)
+    size_t getBBlocksNum() const { return _bblocks_num; }
+    size_t getLvnBBlocksNum() const { return _lvn_bblocks; }
+
     const SubgraphInfo::Summary *getSummary(const RWSubgraph *s) const {
         const auto *si = getSubgraphInfo(s);
         if (!si)
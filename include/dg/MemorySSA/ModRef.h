@@ -1,9 +1,17 @@
 #ifndef DG_MOD_REF_H_
 #define DG_MOD_REF_H_
 
+#include <algorithm>
+#include <cassert>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
 #include "dg/Offset.h"
 
-#include "dg/MemorySSA/DefinitionsMap.h"
+#include "dg/ADT/BlockBitvector.h"
+
+#include "dg/ReadWriteGraph/DefSite.h"
 #include "dg/ReadWriteGraph/RWNode.h"
 
 namespace dg {
@@ -15,80 +23,150 @@ class ModRefInfo {
     // to distinguish between empty and non-computed modref information
     bool _initialized{false};
 
-  public:
-    // the set of memory that is defined in this procedure
-    // and is external to the subgraph or is local but its address is taken
-    // In other words, memory whose definitions can be "visible"
-    // outside the procedure.
-    // FIXME: we should keep only sets of DefSites
-    DefinitionsMap<RWNode> maydef;
-    // external or local address-taken memory that can be
-    // used inside the procedure
-    // FIXME: we should keep only sets of DefSites
-    DefinitionsMap<RWNode> mayref;
-    // memory that must be defined in this procedure
-    // (on every path through the procedure)
-    DefinitionsMap<RWNode> mustdef;
+    // The memory objects that may be defined. The objects are numbered
+    // by the IDs of their nodes (the nodes of the graph are numbered
+    // densely, UNKNOWN_MEMORY has the ID 0), so checking and joining
+    // the sets are operations on words of bits.
+    ADT::BlockSparseBitvector _maydefTargets;
+
+    // bytes [start, end] of a memory object
+    struct Interval {
+        Offset start;
+        Offset end;
+    };
+
+    // The bytes of memory objects (other than the unknown memory) that
+    // may be defined. Most of the objects are defined in one interval
+    // of bytes, only the objects defined in more disjoint intervals
+    // have the list of the intervals (and are not in _maydefInterval).
+    std::unordered_map<RWNode *, Interval> _maydefInterval;
+    std::unordered_map<RWNode *, std::vector<Interval>> _maydefIntervals;
+    // the nodes that may write to unknown memory
+    std::set<RWNode *> _unknownDefs;
+
+    static ADT::BlockSparseBitvector::IndexT targetID(const RWNode *target) {
+        assert((target->getID() > 0 || target->isUnknown()) &&
+               "Memory object without ID");
+        return target->getID();
+    }
 
-    void addMayDef(const DefSite &ds, RWNode *def) {
-        // FIXME: do not store def, it is useless. Just takes memory...
-        maydef.add(ds, def);
+    // can the intervals be joined into one? (Offset::UNKNOWN is greater
+    // than any other offset and adding to it yields Offset::UNKNOWN)
+    static bool joinable(const Interval &a, const Interval &b) {
+        return a.start <= b.end + 1 && b.start <= a.end + 1;
     }
 
-    template <typename C>
-    void addMayDef(const C &c, RWNode *def) {
-        for (auto &ds : c) {
-            maydef.add(ds, def);
+    // add 'I' to the sorted list of disjoint intervals
+    static void addInterval(std::vector<Interval> &intervals, Interval I) {
+        auto it = intervals.begin();
+        while (it != intervals.end() && !joinable(*it, I) &&
+               it->start < I.start)
+            ++it;
+        // join all the intervals that overlap with or are adjacent to I
+        auto to = it;
+        while (to != intervals.end() && joinable(*to, I)) {
+            I.start = std::min(I.start, to->start);
+            I.end = std::max(I.end, to->end);
+            ++to;
         }
+        it = intervals.erase(it, to);
+        intervals.insert(it, I);
     }
 
-    void addMayRef(const DefSite &ds, RWNode *ref) {
-        // FIXME: do not store ref, it is useless. Just takes memory...
-        mayref.add(ds, ref);
-    }
+    void addMayDef(RWNode *target, const Interval &I) {
+        auto it = _maydefIntervals.find(target);
+        if (it != _maydefIntervals.end()) {
+            addInterval(it->second, I);
+            return;
+        }
 
-    template <typename C>
-    void addMayRef(const C &c, RWNode *ref) {
-        for (auto &ds : c) {
-            mayref.add(ds, ref);
+        auto single = _maydefInterval.find(target);
+        if (single == _maydefInterval.end()) {
+            _maydefInterval.emplace(target, I);
+            return;
+        }
+
+        std::vector<Interval> intervals{single->second};
+        addInterval(intervals, I);
+        if (intervals.size() == 1) {
+            single->second = intervals[0];
+        } else {
+            _maydefInterval.erase(single);
+            _maydefIntervals.emplace(target, std::move(intervals));
         }
     }
 
-    void addMustDef(const DefSite &ds, RWNode *def) {
-        // FIXME: do not store def, it is useless. Just takes memory...
-        mustdef.add(ds, def);
+  public:
+    ///
+    // Add the memory that is defined in this procedure by 'def'
+    // and is external to the subgraph or is local but its address is
+    // taken. In other words, memory whose definitions can be "visible"
+    // outside the procedure.
+    void addMayDef(const DefSite &ds, RWNode *def) {
+        _maydefTargets.set(targetID(ds.target));
+        if (ds.target->isUnknown()) {
+            _unknownDefs.insert(def);
+            return;
+        }
+
+        const auto I = ds.getInterval();
+        addMayDef(ds.target, Interval{I.first, I.second});
     }
 
     template <typename C>
-    void addMustDef(const C &c, RWNode *def) {
+    void addMayDef(const C &c, RWNode *def) {
         for (auto &ds : c) {
-            mustdef.add(ds, def);
+            addMayDef(ds, def);
         }
     }
 
     void add(const ModRefInfo &oth) {
-        maydef.add(oth.maydef);
-        mayref.add(oth.mayref);
-        mustdef.add(oth.mustdef);
+        // skip joining the intervals if there is nothing to join
+        if (oth._maydefTargets.empty())
+            return;
+
+        _maydefTargets.set(oth._maydefTargets);
+        for (const auto &it : oth._maydefInterval)
+            addMayDef(it.first, it.second);
+        for (const auto &it : oth._maydefIntervals) {
+            for (const auto &I : it.second)
+                addMayDef(it.first, I);
+        }
+        _unknownDefs.insert(oth._unknownDefs.begin(), oth._unknownDefs.end());
     }
 
     ///
     // Check whether the procedure may define 'n' (ignoring writes
     // to unknown memory, \see mayDefineOrUnknown())
-    bool mayDefine(RWNode *n) const { return maydef.definesTarget(n); }
+    bool mayDefine(const RWNode *n) const {
+        return _maydefTargets.get(targetID(n));
+    }
     bool mayDefineUnknown() const { return mayDefine(UNKNOWN_MEMORY); }
 
     ///
     // Check whether the procedure may define 'n', taking into
     // account also writes to unknown memory
-    bool mayDefineOrUnknown(RWNode *n) const {
+    bool mayDefineOrUnknown(const RWNode *n) const {
         return mayDefine(n) or mayDefineUnknown();
     }
 
-    auto getMayDef(RWNode *n) -> decltype(maydef.get(n)) {
-        return maydef.get(n);
+    ///
+    // Call 'fun' on every DefSite that may be defined by the procedure
+    // (without the unknown memory, \see getUnknownDefs())
+    template <typename FunT>
+    void forEachMayDef(FunT fun) const {
+        for (const auto &it : _maydefInterval)
+            fun(DefSite{it.first, it.second.start,
+                        it.second.end - it.second.start + 1});
+        for (const auto &it : _maydefIntervals) {
+            for (const auto &I : it.second)
+                fun(DefSite{it.first, I.start, I.end - I.start + 1});
+        }
     }
 
+    // the nodes that may write to unknown memory
+    const std::set<RWNode *> &getUnknownDefs() const { return _unknownDefs; }
+
     void setInitialized() { _initialized = true; }
     bool isInitialized() const { return _initialized; }
 };
@@ -26,6 +26,9 @@ struct MemoryObject {
     PSNode *node;
     // possible pointers stored in this memory object
     PointsToMapT pointsTo;
+    // incremented on every change of pointsTo made via the methods
+    // of this class (used by difference propagation)
+    unsigned version{0};
 
     PointsToSetT &getPointsTo(const Offset off) { return pointsTo[off]; }
 
@@ -48,27 +51,34 @@ struct MemoryObject {
             changed |= pointsTo[rit.first].add(rit.second);
         }
 
-        return changed;
+        return bump(changed);
     }
 
     bool addPointsTo(const Offset &off, const Pointer &ptr) {
         assert(ptr.target != nullptr &&
                "Cannot have NULL target, use unknown instead");
 
-        return pointsTo[off].add(ptr);
+        return bump(pointsTo[off].add(ptr));
     }
 
     bool addPointsTo(const Offset &off, const PointsToSetT &pointers) {
         if (pointers.empty())
             return false;
-        return pointsTo[off].add(pointers);
+        return bump(pointsTo[off].add(pointers));
     }
 
     bool addPointsTo(const Offset &off,
                      std::initializer_list<Pointer> pointers) {
         if (pointers.size() == 0)
             return false;
-        return pointsTo[off].add(pointers);
+        return bump(pointsTo[off].add(pointers));
+    }
+
+    // the object changed, so increase its version
+    bool bump(bool changed) {
+        if (changed)
+            ++version;
+        return changed;
     }
 
 #ifndef NDEBUG
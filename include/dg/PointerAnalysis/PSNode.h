@@ -6,6 +6,7 @@
 #include <iostream>
 #include <string>
 #include <utility>
+#include <vector>
 
 #ifndef NDEBUG
 #include <iostream>
@@ -421,6 +422,19 @@ class PSNodeGep : public PSNode {
     Offset getOffset() const { return offset; }
 };
 
+// remove 'x' from the vector 'v' where 'x' is at most once,
+// return true if 'x' was found
+template <typename T>
+bool removeFromVector(std::vector<T> &v, const T &x) {
+    for (auto it = v.begin(), et = v.end(); it != et; ++it) {
+        if (*it == x) {
+            v.erase(it);
+            return true;
+        }
+    }
+    return false;
+}
+
 class PSNodeEntry : public PSNode {
     std::string functionName;
     std::vector<PSNode *> callers;
@@ -451,6 +465,8 @@ class PSNodeEntry : public PSNode {
         callers.push_back(n);
         return true;
     }
+
+    bool removeCaller(PSNode *n) { return removeFromVector(callers, n); }
 };
 
 class PSNodeCall : public PSNode {
@@ -490,6 +506,10 @@ class PSNodeCall : public PSNode {
         return true;
     }
 
+    bool removeCallee(PointerSubgraph *ps) {
+        return removeFromVector(callees, ps);
+    }
+
 #ifndef NDEBUG
     // verbose dump
     void dumpv() const override {
@@ -548,6 +568,8 @@ class PSNodeCallRet : public PSNode {
         return true;
     }
 
+    bool removeReturn(PSNode *p) { return removeFromVector(returns, p); }
+
 #ifndef NDEBUG
     // verbose dump
     void dumpv() const override {
@@ -593,6 +615,8 @@ class PSNodeRet : public PSNode {
         return true;
     }
 
+    bool removeReturnSite(PSNode *r) { return removeFromVector(returns, r); }
+
 #ifndef NDEBUG
     // verbose dump
     void dumpv() const override {
@@ -2,6 +2,10 @@
 #define DG_POINTER_ANALYSIS_H_
 
 #include <cassert>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -10,6 +14,8 @@
 #include "dg/PointerAnalysis/Pointer.h"
 #include "dg/PointerAnalysis/PointerAnalysisOptions.h"
 #include "dg/PointerAnalysis/PointerGraph.h"
+#include "dg/PointerAnalysis/PointerGraphTopoOrder.h"
+#include "dg/util/ThreadPool.h"
 
 namespace dg {
 namespace pta {
@@ -28,6 +34,9 @@ class PointerAnalysis {
 
     const PointerAnalysisOptions options{};
 
+    // workers for the parallel solving (see options.solverThreads)
+    std::unique_ptr<ThreadPool> workers;
+
   public:
     PointerAnalysis(PointerGraph *ps, PointerAnalysisOptions opts)
             : PG(ps), options(std::move(opts)) {
@@ -61,6 +70,27 @@ class PointerAnalysis {
 
     virtual bool afterProcessed(PSNode * /*unused*/) { return false; }
 
+    // Can the analysis process nodes that only read points-to sets
+    // of their operands in parallel? If so, getMemoryObjects(),
+    // beforeProcessed(), afterProcessed(), error()
+    // and errorEmptyPointsTo() must be thread-safe
+    // for such nodes (e.g., LOAD, GEP, CAST or PHI).
+    virtual bool canProcessInParallel() const { return false; }
+
+    // Can the analysis use difference propagation? This requires
+    // that getMemoryObjects() returns the same objects for the same pointer
+    // every time and that memory objects are changed only via the methods
+    // of MemoryObject (so that their versions are up to date).
+    virtual bool canPropagateDifferences() const { return false; }
+
+    // Does the result of processing a node depend only on the points-to
+    // sets of its operands and on the memory objects that it reads?
+    // If so, the topological scheduling processes again only the users
+    // of changed nodes and the readers of changed memory objects
+    // (instead of all nodes reachable from changed nodes). This requires
+    // the same as canPropagateDifferences().
+    virtual bool canScheduleByDependencies() const { return false; }
+
     PointerGraph *getPG() { return PG; }
     const PointerGraph *getPG() const { return PG; }
 
@@ -73,6 +103,16 @@ class PointerAnalysis {
 
         PSNode *root = PG->getEntry()->getRoot();
         assert(root && "Do not have root of PG");
+        if (scheduleByDependencies) {
+            for (PSNode *nd : topoOrder->getOrder())
+                topoOrder->push(nd);
+            return;
+        }
+        if (topoOrder) {
+            topoOrder->getReachableNodes({root}, to_process);
+            return;
+        }
+
         // rely on C++11 move semantics
         to_process = PG->getNodes(root);
     }
@@ -87,6 +127,19 @@ class PointerAnalysis {
     bool iteration() {
         assert(changed.empty());
 
+        if (propagateDifferences)
+            diffStates.resize(PG->getNodes().size());
+
+        if (workers) {
+            parallelIteration();
+            return !changed.empty();
+        }
+
+        if (scheduleByDependencies) {
+            dependenciesIteration();
+            return !changed.empty();
+        }
+
         for (PSNode *cur : to_process) {
             bool enq = false;
             enq |= beforeProcessed(cur);
@@ -104,11 +157,26 @@ class PointerAnalysis {
         unsigned last_processed_num = to_process.size();
         to_process.clear();
 
+        if (scheduleByDependencies) {
+            queueDependencies();
+            return;
+        }
+
         if (!changed.empty()) {
-            // DONT std::move - it prevents compiler from copy ellision
-            to_process = PG->getNodes(changed /* starting set */,
-                                      true /* interprocedural */,
-                                      last_processed_num /* expected num */);
+            if (topoOrder) {
+                // put the new nodes into the order
+                for (PSNode *callsite : newCallSites)
+                    topoOrder->update(callsite);
+                newCallSites.clear();
+
+                topoOrder->getReachableNodes(changed, to_process);
+            } else {
+                // DONT std::move - it prevents compiler from copy ellision
+                to_process =
+                        PG->getNodes(changed /* starting set */,
+                                     true /* interprocedural */,
+                                     last_processed_num /* expected num */);
+            }
 
             // since changed was not empty,
             // the to_process must not be empty too
@@ -159,11 +227,79 @@ class PointerAnalysis {
     virtual bool handleJoin(PSNode * /*unused*/) { return false; }
 
   private:
+    // the state of a node for the difference propagation
+    struct DiffState {
+        // pointers of the address operand that were already processed
+        PointsToSetT pointers;
+        // pointers of the value operand that were already stored
+        PointsToSetT values;
+        // versions of memory objects in the time they were read
+        std::unordered_map<const MemoryObject *, unsigned> versions;
+
+        bool isUpToDate(const MemoryObject *mo) const {
+            auto it = versions.find(mo);
+            return it != versions.end() && it->second == mo->version;
+        }
+    };
+
+    // indexed by IDs of nodes, allocated lazily
+    std::vector<std::unique_ptr<DiffState>> diffStates;
+    bool propagateDifferences{false};
+
+    // return nullptr if difference propagation is not used
+    DiffState *getDiffState(const PSNode *node);
+
+    // edges between copy nodes that were already checked for being
+    // on a cycle (see options.collapseCycles)
+    std::unordered_set<uint64_t> checkedCopyEdges;
+    // was the graph changed by the analysis (e.g., functionPointerCall())
+    // in this iteration?
+    bool graphChanged{false};
+
+    // the order of nodes (see options.topologicalScheduling)
+    std::unique_ptr<PointerGraphTopoOrder> topoOrder;
+    // the nodes where new nodes were added to the graph
+    // in this iteration (e.g., by functionPointerCall())
+    std::vector<PSNode *> newCallSites;
+
+    // see canScheduleByDependencies(). The nodes that are going to be
+    // processed are in the worklist of topoOrder, not in to_process.
+    bool scheduleByDependencies{false};
+    // the nodes that read the memory objects
+    std::unordered_map<const MemoryObject *, std::unordered_set<PSNode *>>
+            objectReaders;
+    // memory objects accessed by the node that is being processed
+    // with their versions at the time of access
+    std::vector<std::pair<const MemoryObject *, unsigned>> accessedObjects;
+    // the number of nodes in 'changed' whose dependencies were already
+    // queued in dependenciesIteration()
+    size_t queuedChanged{0};
+    // JOIN nodes read the points-to sets of other nodes than operands
+    // (see handleJoin()), so they are processed again after every change
+    std::vector<PSNode *> joinNodes;
+
+    bool hasQueuedNodes() const {
+        return scheduleByDependencies && !topoOrder->empty();
+    }
+    void dependenciesIteration();
+    void queueDependencies();
+    // getMemoryObjects() that remembers the accessed objects
+    // when scheduling by dependencies
+    void accessMemoryObjects(PSNode *node, const Pointer &ptr,
+                             std::vector<MemoryObject *> &objects, bool read);
+
+    void collapseCycles();
+    bool collapseCycle(const std::vector<PSNode *> &scc);
+    void fixMergedNodes();
+
     // check the sanity of results of pointer analysis
     void sanityCheck();
 
+    void parallelIteration();
+
     bool processNode(PSNode * /*node*/);
     bool processLoad(PSNode *node);
+    bool processStore(PSNode *node);
     bool processGep(PSNode *node);
     bool processMemcpy(PSNode *node);
     bool processMemcpy(std::vector<MemoryObject *> &srcObjects,
@@ -3,6 +3,8 @@
 
 #include <cassert>
 #include <memory>
+#include <mutex>
+#include <set>
 #include <vector>
 
 #include "PointerAnalysis.h"
@@ -15,6 +17,8 @@ namespace pta {
 //
 class PointerAnalysisFI : public PointerAnalysis {
     std::vector<std::unique_ptr<MemoryObject>> memory_objects;
+    // memory objects are created lazily, possibly from several threads
+    std::mutex memory_objects_lock;
 
     void preprocessGEPs() {
         // if a node is in a loop (a scc that has more than one node),
@@ -34,6 +38,27 @@ class PointerAnalysisFI : public PointerAnalysis {
         }
     }
 
+    // the node that keeps the memory object of the target
+    // (or nullptr if the target is a function)
+    static PSNode *getAllocation(PSNode *n) {
+        // we want to have memory in allocation sites
+        if (n->getType() == PSNodeType::CAST || n->getType() == PSNodeType::GEP)
+            n = n->getOperand(0);
+        else if (n->getType() == PSNodeType::CONSTANT) {
+            assert(n->pointsTo.size() == 1);
+            n = (*n->pointsTo.begin()).target;
+        }
+
+        if (n->getType() == PSNodeType::FUNCTION)
+            return nullptr;
+
+        return n;
+    }
+
+    // get the memory object that was created for the pointer
+    // or nullptr if there is no such object
+    static MemoryObject *getObject(const Pointer &ptr);
+
   public:
     PointerAnalysisFI(PointerGraph *ps) : PointerAnalysisFI(ps, {}) {}
 
@@ -48,26 +73,35 @@ class PointerAnalysisFI : public PointerAnalysis {
             preprocessGEPs();
     }
 
+    ///
+    // Forget the points-to information that may depend on the nodes
+    // from 'removed' (the nodes that are going to be removed from the graph,
+    // e.g., because their function changed). The points-to sets of nodes
+    // and memory objects that may have got some pointers via the removed
+    // nodes are cleared, so that the next run() computes them again.
+    // The rest of the points-to sets is kept.
+    void invalidate(const std::set<PSNode *> &removed);
+
+    bool canProcessInParallel() const override { return true; }
+    bool canPropagateDifferences() const override { return true; }
+    bool canScheduleByDependencies() const override { return true; }
+
     void getMemoryObjects(PSNode *where, const Pointer &pointer,
                           std::vector<MemoryObject *> &objects) override {
         // irrelevant in flow-insensitive
         (void) where;
-        PSNode *n = pointer.target;
-
-        // we want to have memory in allocation sites
-        if (n->getType() == PSNodeType::CAST || n->getType() == PSNodeType::GEP)
-            n = n->getOperand(0);
-        else if (n->getType() == PSNodeType::CONSTANT) {
-            assert(n->pointsTo.size() == 1);
-            n = (*n->pointsTo.begin()).target;
-        }
-
-        if (n->getType() == PSNodeType::FUNCTION)
+        PSNode *n = getAllocation(pointer.target);
+        if (!n)
             return;
 
         assert(n->getType() == PSNodeType::ALLOC ||
                n->getType() == PSNodeType::UNKNOWN_MEM);
 
+        std::unique_lock<std::mutex> guard(memory_objects_lock,
+                                           std::defer_lock);
+        if (options.solverThreads > 1)
+            guard.lock();
+
         MemoryObject *mo = n->getData<MemoryObject>();
         if (!mo) {
             mo = new MemoryObject(n);
@@ -31,6 +31,52 @@ struct PointerAnalysisOptions : AnalysisOptions {
     // If exceeded, the analysis is terminated and points-to sets
     // of the unprocessed nodes are set to {}.
     size_t maxIterations{0};
+
+    // Number of threads used to process the nodes in one iteration
+    // of the fixpoint computation. 0 or 1 means that the nodes are
+    // processed sequentially. Analyses that do not support parallel
+    // processing of nodes ignore this option.
+    unsigned solverThreads{0};
+
+    PointerAnalysisOptions &setSolverThreads(unsigned n) {
+        solverThreads = n;
+        return *this;
+    }
+
+    // Propagate only differences of points-to sets. When a node
+    // is processed again, only the pointers that were added to its operands
+    // since the last processing (and memory objects that changed since then)
+    // are taken into account. Analyses that do not support it
+    // ignore this option.
+    bool differencePropagation{false};
+
+    PointerAnalysisOptions &setDifferencePropagation(bool b) {
+        differencePropagation = b;
+        return *this;
+    }
+
+    // Detect cycles of copy nodes (PHI and CAST nodes) during solving
+    // and collapse them into a single representative node. The merged
+    // nodes are mapped to their representatives in the PointerGraph
+    // (see PointerGraph::getRepresentative()).
+    bool collapseCycles{false};
+
+    PointerAnalysisOptions &setCollapseCycles(bool b) {
+        collapseCycles = b;
+        return *this;
+    }
+
+    // Compute the topological order of strongly connected components
+    // of the graph once and process the nodes in this order
+    // (instead of searching the graph in BFS order in every iteration).
+    // The flow-insensitive analysis then processes again only the nodes
+    // whose operands or read memory changed.
+    bool topologicalScheduling{false};
+
+    PointerAnalysisOptions &setTopologicalScheduling(bool b) {
+        topologicalScheduling = b;
+        return *this;
+    }
 };
 
 } // namespace dg
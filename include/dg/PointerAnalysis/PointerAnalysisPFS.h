@@ -0,0 +1,66 @@
+#ifndef DG_ANALYSIS_POINTS_TO_PERSISTENT_FLOW_SENSITIVE_H_
+#define DG_ANALYSIS_POINTS_TO_PERSISTENT_FLOW_SENSITIVE_H_
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "dg/ADT/PersistentMap.h"
+
+#include "PointerAnalysis.h"
+#include "PointerAnalysisFS.h"
+
+namespace dg {
+namespace pta {
+
+///
+// Flow-sensitive pointer analysis with persistent memory maps
+//
+// Computes the same information as PointerAnalysisFS, but the memory maps
+// are persistent maps that share their structure and also the memory
+// objects. A node that needs its own memory map starts with the objects
+// of its predecessors and it gets its own copy of an object only when
+// it writes to the object or when it needs to merge different states
+// of the object. Merging the maps skips the parts that the maps share.
+class PointerAnalysisPFS : public PointerAnalysisFS {
+  public:
+    // the memory object together with the node that may change it
+    struct SharedObject : public MemoryObject {
+        SharedObject(PSNode *target, PSNode *o)
+                : MemoryObject(target), owner(o) {}
+
+        PSNode *owner;
+    };
+
+    using PersistentMemoryMapT = ADT::PersistentMap<PSNode *, SharedObject *>;
+
+    PointerAnalysisPFS(PointerGraph *ps, PointerAnalysisOptions opts)
+            : PointerAnalysisFS(ps, std::move(opts)) {}
+
+    PointerAnalysisPFS(PointerGraph *ps) : PointerAnalysisPFS(ps, {}) {}
+
+    bool beforeProcessed(PSNode *n) override;
+    bool afterProcessed(PSNode *n) override;
+
+    void getMemoryObjects(PSNode *where, const Pointer &pointer,
+                          std::vector<MemoryObject *> &objects) override;
+
+    // the number of memory objects created by the analysis
+    size_t getObjectsNum() const { return objects.size(); }
+
+  private:
+    std::vector<std::unique_ptr<PersistentMemoryMapT>> maps;
+    std::vector<std::unique_ptr<SharedObject>> objects;
+
+    SharedObject *createObject(PSNode *target, PSNode *owner,
+                               const SharedObject *from = nullptr);
+
+    bool mergeMap(PSNode *n, PersistentMemoryMapT *mm,
+                  const PersistentMemoryMapT *from, unsigned sourcesNum,
+                  PointsToSetT *overwritten);
+};
+
+} // namespace pta
+} // namespace dg
+
+#endif // DG_ANALYSIS_POINTS_TO_PERSISTENT_FLOW_SENSITIVE_H_
@@ -0,0 +1,89 @@
+#ifndef DG_ANALYSIS_POINTS_TO_SPARSE_FLOW_SENSITIVE_H_
+#define DG_ANALYSIS_POINTS_TO_SPARSE_FLOW_SENSITIVE_H_
+
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "PointerAnalysisFS.h"
+
+namespace dg {
+namespace pta {
+
+///
+// Sparse flow-sensitive pointer analysis
+//
+// Computes the same information as PointerAnalysisFS, but the state
+// of memory is not kept in every node that may change it. Before
+// solving, the flow-insensitive analysis is run to find out which memory
+// objects every node may write or read. From that, we compute for every
+// node and object the definitions (stores and memcpys) of the object that
+// reach the node. The state of an object is then kept only in the nodes
+// that define it and it is propagated only along these def-use chains.
+//
+// The calls via function pointers are resolved by the flow-insensitive
+// pre-analysis, the flow-sensitive analysis uses its call graph.
+class PointerAnalysisSFS : public PointerAnalysisFS {
+  public:
+    struct NodeInfo {
+        // does the node write to memory?
+        bool isDef{false};
+        // for every memory object accessed by the node,
+        // the nodes that define the object and reach this node
+        std::map<PSNode *, std::vector<PSNode *>> reaching;
+        // the state of the objects written by this node (after the node).
+        // The state is created once the node writes to the object
+        // or some state of the object reaches the node.
+        std::map<PSNode *, std::unique_ptr<MemoryObject>> defined;
+    };
+
+    PointerAnalysisSFS(PointerGraph *ps, PointerAnalysisOptions opts)
+            : PointerAnalysisFS(ps, std::move(opts)) {}
+
+    PointerAnalysisSFS(PointerGraph *ps) : PointerAnalysisSFS(ps, {}) {}
+
+    // runs the flow-insensitive pre-analysis and builds def-use chains
+    void preprocess() override;
+
+    bool beforeProcessed(PSNode * /*unused*/) override { return false; }
+    bool afterProcessed(PSNode *n) override;
+
+    void getMemoryObjects(PSNode *where, const Pointer &pointer,
+                          std::vector<MemoryObject *> &objects) override;
+
+    const NodeInfo *getNodeInfo(const PSNode *n) const {
+        return n->getID() < infos.size() ? infos[n->getID()].get() : nullptr;
+    }
+
+    // the number of pairs (definition, defined object)
+    size_t getDefinitionsNum() const;
+    // the number of def-use edges
+    size_t getDefUseEdgesNum() const;
+
+  private:
+    class PreAnalysis;
+
+    // indexed by IDs of nodes, allocated only
+    // for nodes that read or write memory
+    std::vector<std::unique_ptr<NodeInfo>> infos;
+    // points-to sets that the nodes had before
+    // the pre-analysis (or when they were created)
+    std::vector<std::pair<PSNode *, PointsToSetT>> initialPointsTo;
+
+    NodeInfo *getNodeInfo(const PSNode *n) {
+        return n->getID() < infos.size() ? infos[n->getID()].get() : nullptr;
+    }
+
+    NodeInfo *getOrCreateNodeInfo(const PSNode *n);
+    MemoryObject *getState(PSNode *def, PSNode *target);
+
+    void rememberPointsTo(size_t fromID);
+    void buildDefUseChains();
+    void resetState();
+};
+
+} // namespace pta
+} // namespace dg
+
+#endif // DG_ANALYSIS_POINTS_TO_SPARSE_FLOW_SENSITIVE_H_
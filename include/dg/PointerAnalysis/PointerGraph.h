@@ -82,8 +82,46 @@ class PointerSubgraph {
 
     // FIXME: remember just that a node is on loop, not the whole loops
     void computeLoops();
+
+    // forget the loops (e.g., when the nodes of the subgraph changed)
+    void resetLoops() {
+        _computed_loops = false;
+        _loops.clear();
+        _node_to_loop.clear();
+    }
 };
 
+///
+// Call 'fun' on every successor of 'cur'. If 'interproc' is true,
+// follow the call and return edges instead of the CFG edges
+// of the calls (and returns) that have some callees (return sites).
+template <typename FunT>
+void foreachPSSuccessor(PSNode *cur, bool interproc, FunT fun) {
+    if (interproc) {
+        if (PSNodeCall *C = PSNodeCall::get(cur)) {
+            for (auto *subg : C->getCallees()) {
+                fun(subg->root);
+            }
+            // we do not need to iterate over succesors
+            // if we dive into the procedure (as we will
+            // return via call return)
+            // NOTE: we must iterate over successors if the
+            // function is undefined
+            if (!C->getCallees().empty())
+                return;
+        } else if (PSNodeRet *R = PSNodeRet::get(cur)) {
+            for (auto *ret : R->getReturnSites()) {
+                fun(ret);
+            }
+            if (!R->getReturnSites().empty())
+                return;
+        }
+    }
+
+    for (auto *s : cur->successors())
+        fun(s);
+}
+
 // IDs of special nodes
 enum PointerGraphReservedIDs {
     ID_UNKNOWN = 1,
@@ -115,6 +153,12 @@ class PointerGraph {
     GenericCallGraph<PSNode *> callGraph;
     GlobalNodesT _globals;
 
+    // nodes that were merged into other nodes (e.g., when collapsing
+    // cycles during the analysis) and their representatives.
+    // Indexed by IDs of the merged nodes.
+    std::vector<PSNode *> _representatives;
+    std::vector<PSNode *> _merged;
+
     // check for correct count of variadic arguments
     template <PSNodeType type, size_t actual_size>
     constexpr static ssize_t expected_args_size() {
@@ -215,6 +259,31 @@ class PointerGraph {
 
     void computeLoops();
 
+    // The node 'nd' was merged into 'rep', that is, 'rep' holds
+    // the points-to set of 'nd' from now on
+    void setMerged(PSNode *nd, PSNode *rep);
+
+    bool isMerged(const PSNode *nd) const {
+        return nd->getID() < _representatives.size() &&
+               _representatives[nd->getID()] != nullptr;
+    }
+
+    // get the node that holds the points-to set of 'nd'
+    // (that is 'nd' itself if it was not merged)
+    PSNode *getRepresentative(PSNode *nd) const {
+        while (isMerged(nd))
+            nd = _representatives[nd->getID()];
+        return nd;
+    }
+
+    const PSNode *getRepresentative(const PSNode *nd) const {
+        while (isMerged(nd))
+            nd = _representatives[nd->getID()];
+        return nd;
+    }
+
+    const std::vector<PSNode *> &getMergedNodes() const { return _merged; }
+
     PointerGraph(PointerGraph &&) = default;
     PointerGraph &operator=(PointerGraph &&) = default;
     PointerGraph(const PointerGraph &) = delete;
@@ -251,29 +320,7 @@ class PointerGraph {
             EdgeChooser(bool inter = true) : interproc(inter) {}
 
             void foreach (PSNode *cur, std::function<void(PSNode *)> Dispatch) {
-                if (interproc) {
-                    if (PSNodeCall *C = PSNodeCall::get(cur)) {
-                        for (auto *subg : C->getCallees()) {
-                            Dispatch(subg->root);
-                        }
-                        // we do not need to iterate over succesors
-                        // if we dive into the procedure (as we will
-                        // return via call return)
-                        // NOTE: we must iterate over successors if the
-                        // function is undefined
-                        if (!C->getCallees().empty())
-                            return;
-                    } else if (PSNodeRet *R = PSNodeRet::get(cur)) {
-                        for (auto *ret : R->getReturnSites()) {
-                            Dispatch(ret);
-                        }
-                        if (!R->getReturnSites().empty())
-                            return;
-                    }
-                }
-
-                for (auto *s : cur->successors())
-                    Dispatch(s);
+                foreachPSSuccessor(cur, interproc, Dispatch);
             }
         };
 
@@ -0,0 +1,133 @@
+#ifndef DG_POINTER_GRAPH_TOPO_ORDER_H_
+#define DG_POINTER_GRAPH_TOPO_ORDER_H_
+
+#include <cassert>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <utility>
+#include <vector>
+
+#include "dg/PointerAnalysis/PointerGraph.h"
+
+namespace dg {
+namespace pta {
+
+///
+// Topological order of the condensation of PointerGraph (that is,
+// the graph where strongly connected components are collapsed into
+// single nodes) over the CFG and call/return edges. Nodes from one
+// strongly connected component are kept together in the order
+// in which they were discovered.
+//
+// The order is computed once and then it is only updated when new nodes
+// are added to the graph (e.g., when a call via a function pointer
+// is resolved): the new nodes are inserted after the node from which
+// they are reachable.
+class PointerGraphTopoOrder {
+    PointerGraph *PG;
+
+    std::vector<PSNode *> _order;
+    // position of the node in _order plus one, indexed by IDs of nodes
+    // (0 means that the node has no position)
+    std::vector<unsigned> _pos;
+
+    // marks of nodes used when searching reachable nodes
+    std::vector<unsigned> _mark;
+    unsigned _markNum{0};
+    std::vector<PSNode *> _stack;
+
+    // worklist of nodes ordered by their positions, split into the nodes
+    // for the current pass over the order and for the next pass
+    using QueueElemT = std::pair<unsigned, PSNode *>;
+    using QueueT = std::priority_queue<QueueElemT, std::vector<QueueElemT>,
+                                       std::greater<QueueElemT>>;
+    QueueT _queue;
+    QueueT _nextQueue;
+    // the position of the last popped node
+    unsigned _last{0};
+    // is the node in the worklist? (indexed by IDs of nodes)
+    std::vector<bool> _queued;
+
+    // compute the order of the nodes reachable from 'start'
+    // that do not have any position yet
+    std::vector<PSNode *> computeOrder(PSNode *start);
+    void renumber(size_t from);
+
+  public:
+    PointerGraphTopoOrder(PointerGraph *pg) : PG(pg) {}
+
+    // compute the order of nodes reachable from 'root'
+    void compute(PSNode *root);
+
+    // give a position to nodes that are reachable from 'from'
+    // and do not have any position yet
+    void update(PSNode *from);
+
+    bool hasPosition(const PSNode *nd) const {
+        return nd->getID() < _pos.size() && _pos[nd->getID()] != 0;
+    }
+
+    // nodes without a position come after all the other nodes
+    unsigned getPosition(const PSNode *nd) const {
+        return hasPosition(nd) ? _pos[nd->getID()]
+                               : std::numeric_limits<unsigned>::max();
+    }
+
+    const std::vector<PSNode *> &getOrder() const { return _order; }
+
+    ///
+    // Worklist of nodes that are processed in passes over the order.
+    // A node is in the worklist at most once. A node that comes after
+    // the last popped node is popped still in the current pass,
+    // other nodes are popped in the next pass. The position of a node
+    // is taken when the node is pushed, so if the order is updated
+    // while the node is in the worklist, the node may be popped a bit
+    // out of the order.
+    void push(PSNode *nd) {
+        if (_queued.size() <= nd->getID())
+            _queued.resize(PG->getNodes().size(), false);
+        if (_queued[nd->getID()])
+            return;
+        _queued[nd->getID()] = true;
+
+        const unsigned pos = getPosition(nd);
+        if (pos > _last)
+            _queue.emplace(pos, nd);
+        else
+            _nextQueue.emplace(pos, nd);
+    }
+
+    // pop the next node of the current pass
+    PSNode *pop() {
+        assert(!_queue.empty());
+        _last = _queue.top().first;
+        PSNode *nd = _queue.top().second;
+        _queue.pop();
+        _queued[nd->getID()] = false;
+        return nd;
+    }
+
+    bool passDone() const { return _queue.empty(); }
+
+    // start the next pass over the order
+    void nextPass() {
+        assert(passDone());
+        _queue.swap(_nextQueue);
+        _last = 0;
+    }
+
+    bool empty() const { return _queue.empty() && _nextQueue.empty(); }
+
+    ///
+    // Store into 'nodes' the nodes reachable from the nodes in 'start'
+    // sorted by the order. Nodes without any position are stored
+    // at the end.
+    void getReachableNodes(const std::vector<PSNode *> &start,
+                           std::vector<PSNode *> &nodes);
+};
+
+} // namespace pta
+} // namespace dg
+
+#endif
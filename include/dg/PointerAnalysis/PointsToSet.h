@@ -6,13 +6,20 @@
 #include "dg/PointerAnalysis/PointsToSets/OffsetsSetPointsToSet.h"
 #include "dg/PointerAnalysis/PointsToSets/PointerIdPointsToSet.h"
 #include "dg/PointerAnalysis/PointsToSets/SeparateOffsetsPointsToSet.h"
+#include "dg/PointerAnalysis/PointsToSets/SharedPointerIdPointsToSet.h"
 #include "dg/PointerAnalysis/PointsToSets/SimplePointsToSet.h"
 #include "dg/PointerAnalysis/PointsToSets/SmallOffsetsPointsToSet.h"
 
 namespace dg {
 namespace pta {
 
+#if defined(SHARED_POINTS_TO_SETS)
+using PointsToSetT = SharedPointerIdPointsToSet;
+#elif defined(BLOCK_BITVECTOR_POINTS_TO_SETS)
+using PointsToSetT = BlockPointerIdPointsToSet;
+#else
 using PointsToSetT = PointerIdPointsToSet;
+#endif
 using PointsToMapT = std::map<Offset, PointsToSetT>;
 
 } // namespace pta
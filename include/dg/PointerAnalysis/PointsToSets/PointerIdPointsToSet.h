@@ -7,6 +7,7 @@
 
 #include "LookupTable.h"
 #include "dg/ADT/Bitvector.h"
+#include "dg/ADT/BlockBitvector.h"
 #include "dg/PointerAnalysis/Pointer.h"
 
 namespace dg {
@@ -14,14 +15,13 @@ namespace pta {
 
 class PSNode;
 
-class PointerIdPointsToSet {
+///
+// Points-to set that stores IDs of pointers in a bitvector
+// of the type PointersT.
+template <typename PointersT>
+class PointerIdPointsToSetImpl {
     static PointerIDLookupTable lookupTable;
 
-#if defined(HAVE_TSL_HOPSCOTCH) || (__clang__)
-    using PointersT = ADT::SparseBitvectorHashImpl;
-#else
-    using PointersT = ADT::SparseBitvector;
-#endif
     PointersT pointers;
 
     // if the pointer doesn't have ID, it's assigned one
@@ -41,8 +41,9 @@ class PointerIdPointsToSet {
     }
 
   public:
-    PointerIdPointsToSet() = default;
-    explicit PointerIdPointsToSet(const std::initializer_list<Pointer> &elems) {
+    PointerIdPointsToSetImpl() = default;
+    explicit PointerIdPointsToSetImpl(
+            const std::initializer_list<Pointer> &elems) {
         add(elems);
     }
 
@@ -66,7 +67,9 @@ class PointerIdPointsToSet {
         return changed;
     }
 
-    bool add(const PointerIdPointsToSet &S) { return pointers.set(S.pointers); }
+    bool add(const PointerIdPointsToSetImpl &S) {
+        return pointers.set(S.pointers);
+    }
 
     bool remove(const Pointer &ptr) {
         return pointers.unset(getPointerID(ptr));
@@ -96,7 +99,9 @@ class PointerIdPointsToSet {
     void clear() { pointers.reset(); }
 
     bool pointsTo(const Pointer &ptr) const {
-        return pointers.get(getPointerID(ptr));
+        // do not create a new ID just because we query the pointer
+        auto ptrid = lookupTable.get(ptr);
+        return ptrid != 0 && pointers.get(ptrid);
     }
 
     bool mayPointTo(const Pointer &ptr) const {
@@ -145,7 +150,7 @@ class PointerIdPointsToSet {
 
     size_t size() const { return pointers.size(); }
 
-    void swap(PointerIdPointsToSet &rhs) { pointers.swap(rhs.pointers); }
+    void swap(PointerIdPointsToSetImpl &rhs) { pointers.swap(rhs.pointers); }
 
     class const_iterator {
         typename PointersT::const_iterator container_it;
@@ -175,7 +180,7 @@ class PointerIdPointsToSet {
             return !operator==(rhs);
         }
 
-        friend class PointerIdPointsToSet;
+        friend class PointerIdPointsToSetImpl;
     };
 
     const_iterator begin() const { return {pointers}; }
@@ -184,6 +189,23 @@ class PointerIdPointsToSet {
     friend class const_iterator;
 };
 
+#if defined(HAVE_TSL_HOPSCOTCH) || (__clang__)
+using PointerIdPointsToSet =
+        PointerIdPointsToSetImpl<ADT::SparseBitvectorHashImpl>;
+#else
+using PointerIdPointsToSet = PointerIdPointsToSetImpl<ADT::SparseBitvector>;
+#endif
+
+// uses the bitvector with SIMD union
+using BlockPointerIdPointsToSet =
+        PointerIdPointsToSetImpl<ADT::BlockSparseBitvector>;
+
+// defined in PointsToSet.cpp
+template <>
+PointerIDLookupTable PointerIdPointsToSet::lookupTable;
+template <>
+PointerIDLookupTable BlockPointerIdPointsToSet::lookupTable;
+
 } // namespace pta
 } // namespace dg
 
@@ -0,0 +1,614 @@
+#ifndef DG_SHAREDPOINTERIDPOINTSTOSET_H
+#define DG_SHAREDPOINTERIDPOINTSTOSET_H
+
+#include <algorithm>
+#include <bitset>
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "LookupTable.h"
+#include "dg/PointerAnalysis/Pointer.h"
+
+namespace dg {
+namespace pta {
+
+class PSNode;
+
+///
+// Set of pointer IDs stored as a sorted vector of 64-bit words
+// (similarly to the buckets of SparseBitvector). Unions, inclusion
+// and comparison are merge-walks over the words.
+class PointerIdWords {
+  public:
+    using IDTy = PointerIDLookupTable::IDTy;
+
+    enum : IDTy { BITS = 64 };
+
+    struct Word {
+        IDTy base; // the ID of the bit 0, a multiple of BITS
+        uint64_t bits;
+
+        bool operator==(const Word &rhs) const {
+            return base == rhs.base && bits == rhs.bits;
+        }
+        bool operator<(const Word &rhs) const { return base < rhs.base; }
+    };
+
+    using WordsT = std::vector<Word>;
+
+  private:
+    WordsT _words;
+
+    static IDTy _base(IDTy id) { return id - (id % BITS); }
+    static uint64_t _bit(IDTy id) { return uint64_t{1} << (id % BITS); }
+
+  public:
+    PointerIdWords() = default;
+    // the IDs must be sorted
+    PointerIdWords(const std::vector<IDTy> &ids) {
+        assert(std::is_sorted(ids.begin(), ids.end()));
+        for (auto id : ids) {
+            if (_words.empty() || _words.back().base != _base(id))
+                _words.push_back({_base(id), 0});
+            _words.back().bits |= _bit(id);
+        }
+    }
+
+    bool empty() const { return _words.empty(); }
+
+    size_t size() const {
+        size_t num = 0;
+        for (const auto &W : _words)
+            num += std::bitset<BITS>(W.bits).count();
+        return num;
+    }
+
+    bool has(IDTy id) const {
+        auto it = std::lower_bound(_words.begin(), _words.end(),
+                                   Word{_base(id), 0});
+        return it != _words.end() && it->base == _base(id) &&
+               (it->bits & _bit(id));
+    }
+
+    // the IDs for which 'keep' returns true
+    template <typename Pred>
+    PointerIdWords filter(Pred keep) const {
+        PointerIdWords R;
+        R._words.reserve(_words.size());
+        for (const auto &W : _words) {
+            uint64_t bits = 0;
+            for (IDTy i = 0; i < BITS; ++i) {
+                if ((W.bits & (uint64_t{1} << i)) && keep(W.base + i))
+                    bits |= uint64_t{1} << i;
+            }
+            if (bits != 0)
+                R._words.push_back({W.base, bits});
+        }
+        return R;
+    }
+
+    static PointerIdWords unite(const PointerIdWords &A,
+                                const PointerIdWords &B) {
+        PointerIdWords R;
+        R._words.reserve(A._words.size() + B._words.size());
+        auto a = A._words.begin(), aend = A._words.end();
+        auto b = B._words.begin(), bend = B._words.end();
+        while (a != aend && b != bend) {
+            if (a->base < b->base) {
+                R._words.push_back(*a++);
+            } else if (b->base < a->base) {
+                R._words.push_back(*b++);
+            } else {
+                R._words.push_back({a->base, a->bits | b->bits});
+                ++a;
+                ++b;
+            }
+        }
+        R._words.insert(R._words.end(), a, aend);
+        R._words.insert(R._words.end(), b, bend);
+        R._words.shrink_to_fit();
+        return R;
+    }
+
+    // is every ID from this set also in 'rhs'?
+    bool isSubsetOf(const PointerIdWords &rhs) const {
+        auto b = rhs._words.begin(), bend = rhs._words.end();
+        for (const auto &W : _words) {
+            while (b != bend && b->base < W.base)
+                ++b;
+            if (b == bend || b->base != W.base || (W.bits & ~b->bits) != 0)
+                return false;
+        }
+        return true;
+    }
+
+    bool operator==(const PointerIdWords &rhs) const {
+        return _words == rhs._words;
+    }
+
+    size_t hash() const {
+        size_t h = _words.size();
+        for (const auto &W : _words) {
+            h ^= std::hash<IDTy>()(W.base) + 0x9e3779b9 + (h << 6) + (h >> 2);
+            h ^= std::hash<uint64_t>()(W.bits) + 0x9e3779b9 + (h << 6) +
+                 (h >> 2);
+        }
+        return h;
+    }
+
+    class const_iterator {
+        typename WordsT::const_iterator word_it;
+        typename WordsT::const_iterator word_end;
+        IDTy pos{0};
+
+        const_iterator(const WordsT &words, bool end = false)
+                : word_it(end ? words.end() : words.begin()),
+                  word_end(words.end()) {
+            if (word_it != word_end)
+                _findClosestBit();
+        }
+
+        void _findClosestBit() {
+            while (!(word_it->bits & (uint64_t{1} << pos)))
+                ++pos;
+        }
+
+      public:
+        const_iterator &operator++() {
+            assert(word_it != word_end && "operator++ called on end");
+            // no more bits in this word
+            if (pos + 1 == BITS || (word_it->bits >> (pos + 1)) == 0) {
+                ++word_it;
+                pos = 0;
+                if (word_it == word_end)
+                    return *this;
+            } else {
+                ++pos;
+            }
+            _findClosestBit();
+            return *this;
+        }
+
+        const_iterator operator++(int) {
+            auto tmp = *this;
+            operator++();
+            return tmp;
+        }
+
+        IDTy operator*() const { return word_it->base + pos; }
+
+        bool operator==(const const_iterator &rhs) const {
+            return word_it == rhs.word_it && pos == rhs.pos;
+        }
+
+        bool operator!=(const const_iterator &rhs) const {
+            return !operator==(rhs);
+        }
+
+        friend class PointerIdWords;
+    };
+
+    const_iterator begin() const { return {_words}; }
+    const_iterator end() const { return {_words, true /* end */}; }
+};
+
+///
+// Table of hash-consed (interned) sets of pointer IDs. Every set
+// is stored in the table only once and it is never modified,
+// so sets with the same elements are represented by the same pointer
+// and the results of unions can be memoized. The sets are reference
+// counted and a set is removed from the table when the last
+// points-to set that uses it is destroyed or changed.
+class PointerIdSetsTable {
+  public:
+    using ElementsT = PointerIdWords;
+
+    class Entry {
+        ElementsT _elements;
+        size_t _hash;
+        size_t _size;
+        // unlike the address, the serial number is never reused,
+        // so it identifies the set in the memoized unions
+        uint64_t _serial{0};
+        std::weak_ptr<const Entry> _self;
+
+      public:
+        Entry(ElementsT &&elems)
+                : _elements(std::move(elems)), _hash(_elements.hash()),
+                  _size(_elements.size()) {}
+
+        const ElementsT &elements() const { return _elements; }
+        size_t size() const { return _size; }
+
+        friend class PointerIdSetsTable;
+    };
+
+    // the empty set is represented by nullptr
+    using SetPtr = std::shared_ptr<const Entry>;
+
+  private:
+    struct EntryHash {
+        size_t operator()(const Entry *E) const { return E->_hash; }
+    };
+
+    struct EntryEq {
+        bool operator()(const Entry *A, const Entry *B) const {
+            return A->_hash == B->_hash && A->_elements == B->_elements;
+        }
+    };
+
+    struct PairHash {
+        size_t operator()(const std::pair<uint64_t, uint64_t> &P) const {
+            return std::hash<uint64_t>()(P.first) ^
+                   (std::hash<uint64_t>()(P.second) << 1);
+        }
+    };
+
+    // the memoized union does not keep the sets alive
+    struct Union {
+        std::weak_ptr<const Entry> lhs, rhs, result;
+
+        bool dead() const {
+            return lhs.expired() || rhs.expired() || result.expired();
+        }
+    };
+
+    struct Deleter {
+        PointerIdSetsTable *table;
+        void operator()(const Entry *E) const { table->release(E); }
+    };
+
+    std::unordered_set<const Entry *, EntryHash, EntryEq> _sets;
+    std::unordered_map<std::pair<uint64_t, uint64_t>, Union, PairHash>
+            _unions;
+    // drop the memoized unions of dead sets when there is more of them
+    size_t _unionsLimit{1024};
+    uint64_t _lastSerial{0};
+    // the sets may be created and released from multiple threads
+    // in the parallel solving of the pointer analysis. The lock is
+    // recursive, because a set may be released while it is held.
+    std::recursive_mutex _lock;
+
+    SetPtr _intern(ElementsT &&elems) {
+        if (elems.empty())
+            return nullptr;
+
+        std::unique_ptr<Entry> E(new Entry(std::move(elems)));
+        auto it = _sets.find(E.get());
+        if (it != _sets.end()) {
+            if (auto S = (*it)->_self.lock())
+                return S;
+            // the set is just being released, replace it
+            _sets.erase(it);
+        }
+
+        E->_serial = ++_lastSerial;
+        SetPtr S(E.get(), Deleter{this});
+        E->_self = S;
+        _sets.insert(E.release());
+        return S;
+    }
+
+    void release(const Entry *E) {
+        {
+            std::lock_guard<std::recursive_mutex> guard(_lock);
+            auto it = _sets.find(E);
+            // the table may already contain a new set with these elements
+            if (it != _sets.end() && *it == E)
+                _sets.erase(it);
+        }
+        delete E;
+    }
+
+    void _sweepUnions() {
+        if (_unions.size() < _unionsLimit)
+            return;
+
+        for (auto it = _unions.begin(); it != _unions.end();) {
+            if (it->second.dead())
+                it = _unions.erase(it);
+            else
+                ++it;
+        }
+        _unionsLimit = std::max<size_t>(1024, 2 * _unions.size());
+    }
+
+  public:
+    SetPtr intern(ElementsT &&elems) {
+        std::lock_guard<std::recursive_mutex> guard(_lock);
+        return _intern(std::move(elems));
+    }
+
+    SetPtr unite(const SetPtr &A, const SetPtr &B) {
+        if (A == B || !B)
+            return A;
+        if (!A)
+            return B;
+
+        // union is commutative, so memoize only one of the pairs
+        const SetPtr &L = A->_serial < B->_serial ? A : B;
+        const SetPtr &R = A->_serial < B->_serial ? B : A;
+
+        std::lock_guard<std::recursive_mutex> guard(_lock);
+        auto key = std::make_pair(L->_serial, R->_serial);
+        auto it = _unions.find(key);
+        if (it != _unions.end()) {
+            if (auto S = it->second.result.lock())
+                return S;
+        }
+
+        // one of the sets may contain the other one
+        SetPtr S;
+        if (R->elements().isSubsetOf(L->elements()))
+            S = L;
+        else if (L->elements().isSubsetOf(R->elements()))
+            S = R;
+        else
+            S = _intern(ElementsT::unite(L->elements(), R->elements()));
+
+        _unions[key] = Union{L, R, S};
+        _sweepUnions();
+        return S;
+    }
+
+    // the number of distinct non-empty sets that are in use
+    size_t size() {
+        std::lock_guard<std::recursive_mutex> guard(_lock);
+        return _sets.size();
+    }
+};
+
+///
+// Points-to set with the same semantics as PointerIdPointsToSet, but
+// whose elements are stored in PointerIdSetsTable. Nodes with the same
+// points-to sets share the storage and the set itself is just a pointer
+// into the table, so comparing sets is comparing pointers and merging
+// sets that were merged before is a look-up into a table.
+//
+// The sets are immutable, every modification creates (or finds)
+// a new set in the table and releases the old one.
+class SharedPointerIdPointsToSet {
+    using ElementsT = PointerIdSetsTable::ElementsT;
+    using SetPtr = PointerIdSetsTable::SetPtr;
+
+    static PointerIDLookupTable lookupTable;
+    static PointerIdSetsTable &getTable() {
+        // never destroyed, points-to sets in static objects
+        // may be released after the static objects are destroyed
+        static auto *table = new PointerIdSetsTable();
+        return *table;
+    }
+
+    SetPtr elements;
+
+    const ElementsT &elems() const {
+        static const ElementsT empty;
+        return elements ? elements->elements() : empty;
+    }
+
+    // if the pointer doesn't have ID, it's assigned one
+    static size_t getPointerID(const Pointer &ptr) {
+        return lookupTable.getOrCreate(ptr);
+    }
+
+    static const Pointer &getPointer(size_t id) { return lookupTable.get(id); }
+
+    bool hasID(size_t id) const { return elems().has(id); }
+
+    bool replace(SetPtr &&E) {
+        bool changed = elements != E;
+        elements = std::move(E);
+        return changed;
+    }
+
+  public:
+    SharedPointerIdPointsToSet() = default;
+    explicit SharedPointerIdPointsToSet(
+            const std::initializer_list<Pointer> &elems) {
+        add(elems);
+    }
+
+    bool add(PSNode *target, Offset off) { return add(Pointer(target, off)); }
+
+    bool add(const Pointer &ptr) { return add(std::vector<Pointer>{ptr}); }
+
+    // add all the pointers and create just the resulting set
+    template <typename ContainerTy>
+    bool add(const ContainerTy &C) {
+        // the targets added with unknown offset replace all the pointers
+        // to the target
+        std::vector<PSNode *> unknown;
+        for (const auto &ptr : C) {
+            if (ptr.offset.isUnknown() && !has(ptr))
+                unknown.push_back(ptr.target);
+        }
+        std::sort(unknown.begin(), unknown.end());
+        unknown.erase(std::unique(unknown.begin(), unknown.end()),
+                      unknown.end());
+
+        std::vector<PointerIdWords::IDTy> ids;
+        for (const auto &ptr : C) {
+            if (ptr.offset.isUnknown() ||
+                has({ptr.target, Offset::UNKNOWN}) ||
+                std::binary_search(unknown.begin(), unknown.end(),
+                                   ptr.target))
+                continue;
+            auto ptrid = getPointerID(ptr);
+            if (!hasID(ptrid))
+                ids.push_back(ptrid);
+        }
+        for (auto *target : unknown)
+            ids.push_back(getPointerID({target, Offset::UNKNOWN}));
+
+        if (ids.empty())
+            return false;
+
+        std::sort(ids.begin(), ids.end());
+
+        if (unknown.empty())
+            return replace(getTable().intern(
+                    ElementsT::unite(elems(), ElementsT(ids))));
+
+        auto old = elems().filter([&unknown](size_t id) {
+            const auto &ptr = getPointer(id);
+            return ptr.offset.isUnknown() ||
+                   !std::binary_search(unknown.begin(), unknown.end(),
+                                       ptr.target);
+        });
+        return replace(
+                getTable().intern(ElementsT::unite(old, ElementsT(ids))));
+    }
+
+    bool add(const SharedPointerIdPointsToSet &S) {
+        return replace(getTable().unite(elements, S.elements));
+    }
+
+    bool remove(const Pointer &ptr) {
+        // do not create a new ID just because we remove the pointer
+        auto ptrid = lookupTable.get(ptr);
+        if (ptrid == 0 || !hasID(ptrid))
+            return false;
+
+        return replace(getTable().intern(
+                elems().filter([ptrid](size_t id) { return id != ptrid; })));
+    }
+
+    bool remove(PSNode *target, Offset offset) {
+        return remove(Pointer(target, offset));
+    }
+
+    bool removeAny(PSNode *target) {
+        if (!pointsToTarget(target))
+            return false;
+
+        return replace(getTable().intern(elems().filter([target](size_t id) {
+            return getPointer(id).target != target;
+        })));
+    }
+
+    void clear() { elements.reset(); }
+
+    bool pointsTo(const Pointer &ptr) const {
+        // do not create a new ID just because we query the pointer
+        auto ptrid = lookupTable.get(ptr);
+        return ptrid != 0 && hasID(ptrid);
+    }
+
+    bool mayPointTo(const Pointer &ptr) const {
+        return pointsTo(ptr) || pointsTo(Pointer(ptr.target, Offset::UNKNOWN));
+    }
+
+    bool mustPointTo(const Pointer &ptr) const {
+        assert(!ptr.offset.isUnknown() && "Makes no sense");
+        return pointsTo(ptr) && isSingleton();
+    }
+
+    bool pointsToTarget(PSNode *target) const {
+        for (auto ptrid : elems()) {
+            const auto &ptr = getPointer(ptrid);
+            if (ptr.target == target) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool isSingleton() const { return size() == 1; }
+
+    bool empty() const { return !elements; }
+
+    size_t count(const Pointer &ptr) const { return pointsTo(ptr); }
+
+    bool has(const Pointer &ptr) const { return count(ptr) > 0; }
+
+    bool hasUnknown() const { return pointsToTarget(UNKNOWN_MEMORY); }
+
+    bool hasNull() const { return pointsToTarget(NULLPTR); }
+
+    bool hasNullWithOffset() const {
+        for (auto ptrid : elems()) {
+            const auto &ptr = getPointer(ptrid);
+            if (ptr.target == NULLPTR && *ptr.offset != 0) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    bool hasInvalidated() const { return pointsToTarget(INVALIDATED); }
+
+    size_t size() const { return elements ? elements->size() : 0; }
+
+    void swap(SharedPointerIdPointsToSet &rhs) {
+        elements.swap(rhs.elements);
+    }
+
+    // the sets are hash-consed, so this is just a comparison of pointers
+    bool operator==(const SharedPointerIdPointsToSet &rhs) const {
+        return elements == rhs.elements;
+    }
+
+    bool operator!=(const SharedPointerIdPointsToSet &rhs) const {
+        return !operator==(rhs);
+    }
+
+    // is every pointer from this set also in 'rhs'?
+    bool isSubsetOf(const SharedPointerIdPointsToSet &rhs) const {
+        if (elements == rhs.elements)
+            return true;
+        if (size() > rhs.size())
+            return false;
+        return elems().isSubsetOf(rhs.elems());
+    }
+
+    // the number of distinct non-empty sets that are in use
+    static size_t getNumberOfSharedSets() { return getTable().size(); }
+
+    class const_iterator {
+        typename ElementsT::const_iterator container_it;
+
+        const_iterator(const ElementsT &elems, bool end = false)
+                : container_it(end ? elems.end() : elems.begin()) {}
+
+      public:
+        const_iterator &operator++() {
+            container_it++;
+            return *this;
+        }
+
+        const_iterator operator++(int) {
+            auto tmp = *this;
+            operator++();
+            return tmp;
+        }
+
+        Pointer operator*() const { return {lookupTable.get(*container_it)}; }
+
+        bool operator==(const const_iterator &rhs) const {
+            return container_it == rhs.container_it;
+        }
+
+        bool operator!=(const const_iterator &rhs) const {
+            return !operator==(rhs);
+        }
+
+        friend class SharedPointerIdPointsToSet;
+    };
+
+    const_iterator begin() const { return {elems()}; }
+    const_iterator end() const { return {elems(), true /* end */}; }
+
+    friend class const_iterator;
+};
+
+} // namespace pta
+} // namespace dg
+
+#endif // DG_SHAREDPOINTERIDPOINTSTOSET_H
@@ -35,6 +35,17 @@ class RWBBlock : public BBlockBase<RWBBlock, RWNode> {
     // Return newly created basic blocks (there are at most two of them).
     std::pair<std::unique_ptr<RWBBlock>, std::unique_ptr<RWBBlock>>
     splitAround(NodeT *node) {
+        auto blks = splitAround(node,
+                                [this]() { return new RWBBlock(subgraph); });
+        return {std::unique_ptr<RWBBlock>(blks.first),
+                std::unique_ptr<RWBBlock>(blks.second)};
+    }
+
+    // Split the block before and after the given node, the new blocks
+    // are created by 'createBBlock' and are owned by the caller.
+    template <typename CreateBBlockT>
+    std::pair<RWBBlock *, RWBBlock *> splitAround(NodeT *node,
+                                                  CreateBBlockT createBBlock) {
         assert(node->getBBlock() == this && "Spliting a block on invalid node");
 
         RWBBlock *withnode = nullptr;
@@ -63,7 +74,7 @@ class RWBBlock : public BBlockBase<RWBBlock, RWNode> {
 
         ++it;
         if (it != et) {
-            after = new RWBBlock(subgraph);
+            after = createBBlock();
             for (; it != et; ++it) {
                 after->append(*it);
             }
@@ -71,7 +82,7 @@ class RWBBlock : public BBlockBase<RWBBlock, RWNode> {
 
         // truncate nodes in this block
         if (num > 0) {
-            withnode = new RWBBlock(subgraph);
+            withnode = createBBlock();
             withnode->append(node);
 
             getNodes().resize(num);
@@ -112,8 +123,7 @@ class RWBBlock : public BBlockBase<RWBBlock, RWNode> {
             this->addSuccessor(after);
         }
 
-        return {std::unique_ptr<RWBBlock>(withnode),
-                std::unique_ptr<RWBBlock>(after)};
+        return {withnode, after};
     }
 
     bool isReturnBBlock() const {
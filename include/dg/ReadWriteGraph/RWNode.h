@@ -62,6 +62,7 @@ class RWBBlock;
 class RWNode : public SubgraphNode<RWNode> {
     RWNodeType type;
     bool has_address_taken{false};
+    bool is_scalar{false};
     RWBBlock *bblock = nullptr;
 
     class DefUses {
@@ -94,6 +95,13 @@ class RWNode : public SubgraphNode<RWNode> {
         }
 
         bool initialized() const { return _init; }
+        size_t size() const { return defuse.size(); }
+
+        // forget the definitions (and free the memory)
+        void clear() {
+            T().swap(defuse);
+            _init = false;
+        }
 
         operator std::vector<RWNode *>() { return defuse; }
 
@@ -139,6 +147,12 @@ class RWNode : public SubgraphNode<RWNode> {
     bool hasAddressTaken() const { return has_address_taken; }
     void setAddressTaken() { has_address_taken = true; }
 
+    // The memory is always overwritten as a whole and its definitions
+    // are tracked only as the last definition (set by the data dependence
+    // analysis when it finds out that the memory is used this way).
+    bool isScalar() const { return is_scalar; }
+    void setScalar(bool b = true) { is_scalar = b; }
+
     virtual ~RWNode() = default;
 
 #ifndef NDEBUG
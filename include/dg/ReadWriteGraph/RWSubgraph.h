@@ -5,6 +5,7 @@
 #include <vector>
 
 #include "RWBBlock.h"
+#include "dg/ADT/Arena.h"
 #include "dg/util/iterators.h"
 
 namespace dg {
@@ -17,42 +18,28 @@ class RWSubgraph {
     // FIXME: get rid of this
     // unsigned int dfsnum{1};
 
-    using BBlocksVecT = std::vector<std::unique_ptr<RWBBlock>>;
-
-    // iterator over the bblocks that returns the bblock,
-    // not the unique_ptr to the bblock
-    struct block_iterator : public BBlocksVecT::iterator {
-        using ContainedType = std::remove_reference<decltype(*(
-                std::declval<BBlocksVecT::iterator>()->get()))>::type;
-
-        block_iterator(const BBlocksVecT::iterator &it)
-                : BBlocksVecT::iterator(it) {}
-        block_iterator(const block_iterator &) = default;
-        block_iterator() = default;
-
-        ContainedType *operator*() {
-            return (BBlocksVecT::iterator::operator*()).get();
-        };
-        ContainedType *operator->() {
-            return ((BBlocksVecT::iterator::operator*()).get());
-        };
-    };
+    // the blocks are owned by the arena of the graph,
+    // or by this subgraph if it has no arena
+    using BBlocksVecT = std::vector<RWBBlock *>;
 
     BBlocksVecT _bblocks;
+    ADT::Arena *_arena{nullptr};
 
-    struct blocks_range {
-        BBlocksVecT &blocks;
-        blocks_range(BBlocksVecT &b) : blocks(b) {}
-
-        block_iterator begin() { return block_iterator(blocks.begin()); }
-        block_iterator end() { return block_iterator(blocks.end()); }
-    };
+    RWBBlock *newBBlock() {
+        if (_arena)
+            return _arena->create<RWBBlock>(this);
+        return new RWBBlock(this);
+    }
 
-    // Build blocks for the nodes. If 'dce' is set to true,
-    // the dead code is eliminated after building the blocks.
-    void buildBBlocks(bool dce = false);
+    void deleteBBlocks() {
+        if (!_arena) {
+            for (auto *b : _bblocks)
+                delete b;
+        }
+        _bblocks.clear();
+    }
 
-    friend class ReadWriteGraph;
+    RWBBlock *splitBlockOnFirstCall(RWBBlock *block, BBlocksVecT &newblocks);
 
     std::vector<RWNode *> _callers;
 
@@ -61,8 +48,24 @@ class RWSubgraph {
 
   public:
     RWSubgraph() = default;
-    RWSubgraph(RWSubgraph &&) = default;
-    RWSubgraph &operator=(RWSubgraph &&) = default;
+    RWSubgraph(ADT::Arena *arena) : _arena(arena) {}
+    RWSubgraph(RWSubgraph &&oth)
+            : _bblocks(std::move(oth._bblocks)), _arena(oth._arena),
+              _callers(std::move(oth._callers)), name(std::move(oth.name)) {
+        oth._bblocks.clear();
+    }
+    RWSubgraph &operator=(RWSubgraph &&oth) {
+        deleteBBlocks();
+        _bblocks.swap(oth._bblocks);
+        _arena = oth._arena;
+        _callers = std::move(oth._callers);
+        name = std::move(oth.name);
+        return *this;
+    }
+    RWSubgraph(const RWSubgraph &) = delete;
+    RWSubgraph &operator=(const RWSubgraph &) = delete;
+
+    ~RWSubgraph() { deleteBBlocks(); }
 
     RWNode *getRoot() { return _bblocks.front()->getFirst(); }
     const RWNode *getRoot() const { return _bblocks.front()->getFirst(); }
@@ -71,8 +74,8 @@ class RWSubgraph {
     const std::string &getName() const { return name; }
 
     RWBBlock &createBBlock() {
-        _bblocks.emplace_back(new RWBBlock(this));
-        return *_bblocks.back().get();
+        _bblocks.push_back(newBBlock());
+        return *_bblocks.back();
     }
 
     bool hasCaller(RWNode *c) const {
@@ -93,9 +96,9 @@ class RWSubgraph {
 
     const BBlocksVecT &getBBlocks() const { return _bblocks; }
 
-    block_iterator bblocks_begin() { return {_bblocks.begin()}; }
-    block_iterator bblocks_end() { return {_bblocks.end()}; }
-    blocks_range bblocks() { return {_bblocks}; }
+    BBlocksVecT::iterator bblocks_begin() { return _bblocks.begin(); }
+    BBlocksVecT::iterator bblocks_end() { return _bblocks.end(); }
+    BBlocksVecT &bblocks() { return _bblocks; }
 
     auto size() const -> decltype(_bblocks.size()) { return _bblocks.size(); }
 };
@@ -4,6 +4,7 @@
 #include <memory>
 #include <vector>
 
+#include "dg/ADT/Arena.h"
 #include "dg/BFS.h"
 #include "dg/ReadWriteGraph/RWBBlock.h"
 #include "dg/ReadWriteGraph/RWNode.h"
@@ -16,9 +17,14 @@ namespace dda {
 
 class ReadWriteGraph {
     size_t lastNodeID{0};
-    using NodesT = std::vector<std::unique_ptr<RWNode>>;
+    using NodesT = std::vector<RWNode *>;
     using SubgraphsT = std::vector<std::unique_ptr<RWSubgraph>>;
 
+    // nodes and blocks of the graph live in the arena and they are
+    // destroyed all at once together with the graph. The arena must
+    // be destroyed last and it must not move with the graph, because
+    // the subgraphs keep a pointer to it.
+    std::unique_ptr<ADT::Arena> _arena{new ADT::Arena(1024 * 1024)};
     NodesT _nodes;
     SubgraphsT _subgraphs;
     RWSubgraph *_entry{nullptr};
@@ -63,42 +69,32 @@ class ReadWriteGraph {
 
     RWNode *getNode(unsigned id) {
         assert(id - 1 < _nodes.size());
-        auto *n = _nodes[id - 1].get();
+        auto *n = _nodes[id - 1];
         assert(n->getID() == id);
         return n;
     }
 
     const RWNode *getNode(unsigned id) const {
         assert(id - 1 < _nodes.size());
-        auto *n = _nodes[id - 1].get();
+        auto *n = _nodes[id - 1];
         assert(n->getID() == id);
         return n;
     }
 
     RWNode &create(RWNodeType t) {
         if (t == RWNodeType::CALL) {
-            _nodes.emplace_back(new RWNodeCall(++lastNodeID));
+            _nodes.push_back(_arena->create<RWNodeCall>(++lastNodeID));
         } else {
-            _nodes.emplace_back(new RWNode(++lastNodeID, t));
+            _nodes.push_back(_arena->create<RWNode>(++lastNodeID, t));
         }
-        return *_nodes.back().get();
+        return *_nodes.back();
     }
 
     RWSubgraph &createSubgraph() {
-        _subgraphs.emplace_back(new RWSubgraph());
+        _subgraphs.emplace_back(new RWSubgraph(_arena.get()));
         return *_subgraphs.back().get();
     }
 
-    // Build blocks for the nodes. If 'dce' is set to true,
-    // the dead code is eliminated after building the blocks.
-    /*
-    void buildBBlocks(bool dce = false) {
-        for (auto& s : _subgraphs) {
-            s->buildBBlocks(dce);
-        }
-    }
-    */
-
     void splitBBlocksOnCalls() {
         for (auto &s : _subgraphs) {
             s->splitBBlocksOnCalls();
@@ -134,6 +134,13 @@ class SubgraphNode {
         operands.clear();
     }
 
+    // remove all occurrences of 'n' from the operands
+    void removeOperand(NodeT *n) {
+        operands.erase(std::remove(operands.begin(), operands.end(), n),
+                       operands.end());
+        n->removeUser(static_cast<NodeT *>(this));
+    }
+
     template <typename NodePtr, typename... Args>
     size_t addOperand(NodePtr node, Args &&...args) {
         addOperand(node);
@@ -326,6 +333,22 @@ class SubgraphNode {
         _predecessors.clear();
     }
 
+    // remove all CFG edges of this node. Unlike isolate(),
+    // this does not connect the predecessors to the successors
+    void removeAllEdges() {
+        for (NodeT *pred : _predecessors) {
+            auto &succs = pred->_successors;
+            succs.erase(std::remove(succs.begin(), succs.end(), this),
+                        succs.end());
+        }
+
+        for (NodeT *succ : _successors)
+            _removeThisFromSuccessorsPredecessors(succ);
+
+        _successors.clear();
+        _predecessors.clear();
+    }
+
     void replaceAllUsesWith(NodeT *nd, bool removeDupl = true) {
         assert(nd != this && "Replacing uses of 'this' with 'this'");
 
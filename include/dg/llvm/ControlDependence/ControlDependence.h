@@ -111,6 +111,30 @@ class LLVMControlDependenceAnalysis {
                       const std::set<llvm::Value *> &vals) {
         return _impl->getClosure(F, vals);
     }
+
+    ///
+    // Update the results after edges were inserted into or deleted from
+    // the CFG of the function F (e.g., by slicing). The function must
+    // already contain the changes. The standard CD updates the post-dominator
+    // tree of the function incrementally (then it computes the frontiers
+    // of the function again), the other analyses forget the results
+    // and compute them again on demand. If blocks were added to or removed
+    // from the function, use invalidate() instead.
+    void updateCFG(const llvm::Function *F,
+                   const std::vector<CFGUpdate> &updates) {
+        _impl->updateCFG(F, updates);
+        if (getOptions().interproceduralCD())
+            _interprocImpl->updateCFG(F, updates);
+    }
+
+    // Forget the results for the function F (e.g., because it was changed
+    // or removed), they are computed again on demand.
+    void invalidate(const llvm::Function *F) {
+        _impl->invalidate(F);
+        if (getOptions().interproceduralCD())
+            _interprocImpl->invalidate(F);
+    }
+
     /// XXX TBD
     //// A getter for iterative building of results of closure-based algorithms.
     // void startClosure(const llvm::Function *F, const std::set<llvm::Value *>&
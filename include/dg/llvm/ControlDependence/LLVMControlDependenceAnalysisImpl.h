@@ -3,6 +3,7 @@
 
 #include <set>
 #include <utility>
+#include <vector>
 
 #include "dg/llvm/ControlDependence/LLVMControlDependenceAnalysisOptions.h"
 
@@ -10,12 +11,23 @@ namespace llvm {
 class Module;
 class Value;
 class Function;
+class BasicBlock;
 }; // namespace llvm
 
 namespace dg {
 
 class CDGraph;
 
+// an edge that was inserted into or deleted from the CFG of a function
+struct CFGUpdate {
+    enum class Kind { INSERT, DELETE } kind;
+    const llvm::BasicBlock *from;
+    const llvm::BasicBlock *to;
+
+    CFGUpdate(Kind k, const llvm::BasicBlock *f, const llvm::BasicBlock *t)
+            : kind(k), from(f), to(t) {}
+};
+
 class LLVMControlDependenceAnalysisImpl {
     const llvm::Module *_module;
     const LLVMControlDependenceAnalysisOptions _options;
@@ -69,6 +81,19 @@ class LLVMControlDependenceAnalysisImpl {
         assert(false && "Unsupported");
         abort();
     }
+
+    // Forget the results for the function (e.g., because its CFG changed
+    // or it was removed). The results are computed again on demand.
+    virtual void invalidate(const llvm::Function *) = 0;
+
+    // Update the results after edges were inserted into or deleted from
+    // the CFG of the function (the blocks of the function stay the same).
+    // The function must already contain the changes. By default,
+    // the results for the function are forgotten.
+    virtual void updateCFG(const llvm::Function *F,
+                           const std::vector<CFGUpdate> & /*unused*/) {
+        invalidate(F);
+    }
 };
 
 } // namespace dg
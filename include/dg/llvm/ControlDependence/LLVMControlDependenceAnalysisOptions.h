@@ -1,6 +1,8 @@
 #ifndef DG_LLVM_CDA_OPTIONS_H_
 #define DG_LLVM_CDA_OPTIONS_H_
 
+#include <string>
+
 #include "dg/ControlDependence/ControlDependenceAnalysisOptions.h"
 #include "dg/llvm/LLVMAnalysisOptions.h"
 
@@ -10,6 +12,9 @@ struct LLVMControlDependenceAnalysisOptions : public LLVMAnalysisOptions,
                                               ControlDependenceAnalysisOptions {
     bool _nodePerInstruction{false};
     bool _icfg{false};
+    // cache the control dependencies of functions in this directory
+    // (see CDCache), empty if the cache is disabled
+    std::string cacheDir{};
 
     void setNodePerInstruction(bool b) { _nodePerInstruction = b; }
     bool nodePerInstruction() const { return _nodePerInstruction; }
@@ -107,6 +107,14 @@ class LLVMDataDependenceAnalysis {
                                                   const Offset &off,
                                                   const Offset &len);
 
+    // The same as getLLVMDefinitions(use), but the search is limited
+    // by the budget. If the budget is exhausted, 'exact' is set to false
+    // and the use may read also values written by other instructions
+    // than the returned ones.
+    std::vector<llvm::Value *>
+    getLLVMDefinitions(llvm::Value *use, const DefinitionsQueryBudget &budget,
+                       bool &exact);
+
     DataDependenceAnalysis *getDDA() { return DDA.get(); }
     const DataDependenceAnalysis *getDDA() const { return DDA.get(); }
 };
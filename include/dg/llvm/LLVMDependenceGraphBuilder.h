@@ -14,6 +14,7 @@
 #include "dg/llvm/PointerAnalysis/LLVMPointerAnalysisOptions.h"
 
 #include "dg/llvm/PointerAnalysis/PointerAnalysis.h"
+#include "dg/llvm/PointerAnalysis/StoredPointerAnalysis.h"
 #ifdef HAVE_SVF
 #include "dg/llvm/PointerAnalysis/SVFPointerAnalysis.h"
 #endif
@@ -131,8 +132,8 @@ class LLVMDependenceGraphBuilder {
               _CDA(new LLVMControlDependenceAnalysis(M, _options.CDAOptions)),
               _dg(new LLVMDependenceGraph(opts.threads)),
               _controlFlowGraph(
-                      _options.threads && !_options.PTAOptions.isSVF()
-                              ? // check SVF due to the static cast...
+                      _options.threads && _options.PTAOptions.isDG()
+                              ? // check the PTA due to the static cast...
                               new ControlFlowGraph(
                                       static_cast<DGLLVMPointerAnalysis *>(
                                               _PTA.get()))
@@ -146,6 +147,8 @@ class LLVMDependenceGraphBuilder {
         if (_options.PTAOptions.isSVF())
             return new SVFPointerAnalysis(_M, _options.PTAOptions);
 #endif
+        if (_options.PTAOptions.isStored())
+            return new StoredPointerAnalysis(_M, _options.PTAOptions);
 
         return new DGLLVMPointerAnalysis(_M, _options.PTAOptions);
     }
@@ -171,9 +174,8 @@ class LLVMDependenceGraphBuilder {
         _runControlDependenceAnalysis();
 
         if (_options.threads) {
-            if (_options.PTAOptions.isSVF()) {
-                assert(0 && "Threading needs the DG pointer analysis, SVF is "
-                            "not supported yet");
+            if (!_options.PTAOptions.isDG()) {
+                assert(0 && "Threading needs the DG pointer analysis");
                 abort();
             }
             _controlFlowGraph->buildFunction(_entryFunction);
@@ -15,7 +15,12 @@
 #include <llvm/IR/Value.h>
 #include <llvm/Support/raw_ostream.h>
 
+#include <map>
+#include <set>
+#include <vector>
+
 #include "dg/Slicing.h"
+#include "dg/llvm/ControlDependence/ControlDependence.h"
 #include "dg/llvm/LLVMDependenceGraph.h"
 #include "dg/llvm/LLVMNode.h"
 
@@ -48,6 +53,12 @@ class LLVMSlicer : public Slicer<LLVMNode> {
 
     void keepFunctionUntouched(const char *n) { dont_touch.insert(n); }
 
+    // Record the changes of CFG made by slicing, so that control
+    // dependencies computed before slicing can be updated afterwards
+    // (see updateControlDependencies()). It is off by default,
+    // as it takes a snapshot of the CFG of every sliced function.
+    void setRecordCFGChanges(bool b = true) { recordCFGChanges = b; }
+
     bool removeNode(LLVMNode *node) override {
         using namespace llvm;
 
@@ -139,6 +150,8 @@ class LLVMSlicer : public Slicer<LLVMNode> {
             }
         }
         for (auto *F : to_erase) {
+            if (recordCFGChanges)
+                changedFunctions.insert(F);
             F->replaceAllUsesWith(llvm::UndefValue::get(F->getType()));
             F->deleteBody();
             F->eraseFromParent();
@@ -147,7 +160,64 @@ class LLVMSlicer : public Slicer<LLVMNode> {
         return sl_id;
     }
 
+    ///
+    // Propagate the changes of CFG made by slicing into control dependencies
+    // that were computed before slicing. If the slicer only reconnected
+    // blocks of a function, the inserted and deleted edges are passed to
+    // the analysis, otherwise the results for the function are invalidated.
+    // The recorded changes are forgotten afterwards.
+    void updateControlDependencies(LLVMControlDependenceAnalysis &CDA) {
+        assert(recordCFGChanges && "Changes of CFG are not recorded");
+        for (const auto *F : changedFunctions)
+            CDA.invalidate(F);
+        for (auto &it : cfgUpdates) {
+            if (changedFunctions.count(it.first) == 0)
+                CDA.updateCFG(it.first, it.second);
+        }
+        changedFunctions.clear();
+        cfgUpdates.clear();
+    }
+
   private:
+    using SuccessorsMapT = std::map<const llvm::BasicBlock *,
+                                    std::set<const llvm::BasicBlock *>>;
+
+    static SuccessorsMapT getSuccessors(const llvm::Function &F) {
+        SuccessorsMapT ret;
+        for (const llvm::BasicBlock &B : F) {
+            auto &succs = ret[&B];
+            for (auto I = succ_begin(&B), E = succ_end(&B); I != E; ++I)
+                succs.insert(*I);
+        }
+        return ret;
+    }
+
+    // compare the CFG of the function with the CFG before slicing
+    // and record the edges that were inserted or deleted
+    void recordCFGUpdates(const llvm::Function &F,
+                          const SuccessorsMapT &before) {
+        auto after = getSuccessors(F);
+        std::vector<CFGUpdate> updates;
+        for (auto &it : after) {
+            const auto &old = before.at(it.first);
+            for (const auto *succ : old) {
+                if (it.second.count(succ) == 0)
+                    updates.emplace_back(CFGUpdate::Kind::DELETE, it.first,
+                                         succ);
+            }
+            for (const auto *succ : it.second) {
+                if (old.count(succ) == 0)
+                    updates.emplace_back(CFGUpdate::Kind::INSERT, it.first,
+                                         succ);
+            }
+        }
+
+        if (!updates.empty()) {
+            auto &fupdates = cfgUpdates[&F];
+            fupdates.insert(fupdates.end(), updates.begin(), updates.end());
+        }
+    }
+
     /*
 void sliceCallNode(LLVMNode *callNode,
                    LLVMDependenceGraph *graph, uint32_t slice_id)
@@ -417,6 +487,12 @@ void sliceCallNode(LLVMNode *callNode, uint32_t slice_id)
     }
 
     void sliceGraph(LLVMDependenceGraph *graph, uint32_t slice_id) {
+        auto *F = llvm::cast<llvm::Function>(graph->getEntry()->getKey());
+        SuccessorsMapT successors;
+        if (recordCFGChanges)
+            successors = getSuccessors(*F);
+        const auto blocksRemoved = statistics.blocksRemoved;
+
         // first slice away bblocks that should go away
         sliceBBlocks(graph, slice_id);
 
@@ -464,6 +540,17 @@ void sliceCallNode(LLVMNode *callNode, uint32_t slice_id)
         // may have predecessors, which is not allowed in the
         // LLVM
         ensureEntryBlock(graph);
+
+        if (!recordCFGChanges)
+            return;
+
+        // blocks were removed or added (the new exit or entry block),
+        // so the control dependencies must be computed from scratch
+        if (statistics.blocksRemoved != blocksRemoved ||
+            F->size() != successors.size())
+            changedFunctions.insert(F);
+        else
+            recordCFGUpdates(*F, successors);
     }
 
     bool dontTouch(const llvm::StringRef &r) {
@@ -592,6 +679,11 @@ void sliceCallNode(LLVMNode *callNode, uint32_t slice_id)
 
     // do not slice these functions at all
     std::set<const char *> dont_touch;
+
+    // changes of CFG made by slicing, see updateControlDependencies()
+    bool recordCFGChanges{false};
+    std::map<const llvm::Function *, std::vector<CFGUpdate>> cfgUpdates;
+    std::set<const llvm::Function *> changedFunctions;
 };
 
 } // namespace llvmdg
@@ -1,6 +1,8 @@
 #ifndef DG_LLVM_POINTER_ANALYSIS_OPTIONS_H_
 #define DG_LLVM_POINTER_ANALYSIS_OPTIONS_H_
 
+#include <string>
+
 #include "dg/PointerAnalysis/PointerAnalysisOptions.h"
 #include "dg/llvm/LLVMAnalysisOptions.h"
 
@@ -8,14 +10,30 @@ namespace dg {
 
 struct LLVMPointerAnalysisOptions : public LLVMAnalysisOptions,
                                     PointerAnalysisOptions {
-    enum class AnalysisType { fi, fs, inv, svf } analysisType{AnalysisType::fi};
+    enum class AnalysisType {
+        fi,
+        fs,
+        sfs,
+        pfs,
+        inv,
+        svf
+    } analysisType{AnalysisType::fi};
 
     bool threads{false};
 
+    // load the results of the analysis from this file
+    // instead of computing them (see StoredPointerAnalysis)
+    std::string storedResults{};
+
     bool isFS() const { return analysisType == AnalysisType::fs; }
+    bool isSFS() const { return analysisType == AnalysisType::sfs; }
+    bool isPFS() const { return analysisType == AnalysisType::pfs; }
     bool isFSInv() const { return analysisType == AnalysisType::inv; }
     bool isFI() const { return analysisType == AnalysisType::fi; }
     bool isSVF() const { return analysisType == AnalysisType::svf; }
+    bool isStored() const { return !storedResults.empty(); }
+    // is the analysis computed by DG (and so we have the pointer graph)?
+    bool isDG() const { return !isSVF() && !isStored(); }
 };
 
 } // namespace dg
@@ -2,6 +2,7 @@
 #define LLVM_DG_POINTS_TO_ANALYSIS_H_
 
 #include <memory>
+#include <set>
 #include <utility>
 
 #include <llvm/IR/DataLayout.h>
@@ -13,6 +14,8 @@
 #include "dg/PointerAnalysis/PointerAnalysisFI.h"
 #include "dg/PointerAnalysis/PointerAnalysisFS.h"
 #include "dg/PointerAnalysis/PointerAnalysisFSInv.h"
+#include "dg/PointerAnalysis/PointerAnalysisPFS.h"
+#include "dg/PointerAnalysis/PointerAnalysisSFS.h"
 #include "dg/PointerAnalysis/PointerGraph.h"
 #include "dg/PointerAnalysis/PointerGraphOptimizations.h"
 
@@ -313,6 +316,12 @@ class DGLLVMPointerAnalysis : public LLVMPointerAnalysis {
             // FIXME: make a interface with run() method
             PTA.reset(new DGLLVMPointerAnalysisImpl<pta::PointerAnalysisFS>(
                     PS, _builder.get(), options));
+        } else if (options.isSFS()) {
+            PTA.reset(new DGLLVMPointerAnalysisImpl<pta::PointerAnalysisSFS>(
+                    PS, _builder.get(), options));
+        } else if (options.isPFS()) {
+            PTA.reset(new DGLLVMPointerAnalysisImpl<pta::PointerAnalysisPFS>(
+                    PS, _builder.get(), options));
         } else if (options.isFI()) {
             PTA.reset(new DGLLVMPointerAnalysisImpl<pta::PointerAnalysisFI>(
                     PS, _builder.get(), options));
@@ -331,6 +340,38 @@ class DGLLVMPointerAnalysis : public LLVMPointerAnalysis {
         }
         return PTA->run();
     }
+
+    ///
+    // Update the results after the functions 'changed' were modified,
+    // 'added' were added to the module and 'removed' were erased from it.
+    // Only the changed functions are built again and only the points-to
+    // sets that may depend on the removed parts of the graph are computed
+    // again, starting from the previous results. This is supported only
+    // by the flow-insensitive analysis (and without threads), otherwise
+    // everything is computed from scratch.
+    bool update(const LLVMPointerGraphBuilder::FunctionsT &changed,
+                const LLVMPointerGraphBuilder::FunctionsT &added,
+                const LLVMPointerGraphBuilder::FunctionsT &removed) {
+        if (!PTA)
+            return run();
+
+        if (options.isFI()) {
+            auto *FI = static_cast<pta::PointerAnalysisFI *>(PTA.get());
+            if (_builder->updateFunctions(
+                        changed, added, removed,
+                        [FI](const std::set<PSNode *> &nodes) {
+                            FI->invalidate(nodes);
+                        }))
+                return PTA->run();
+        }
+
+        // start from scratch
+        PTA.reset();
+        PS = nullptr;
+        _builder.reset(new LLVMPointerGraphBuilder(_builder->getModule(),
+                                                   options));
+        return run();
+    }
 };
 
 // an auxiliary function
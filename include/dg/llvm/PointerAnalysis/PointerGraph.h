@@ -1,7 +1,10 @@
 #ifndef LLVM_DG_POINTER_SUBGRAPH_H_
 #define LLVM_DG_POINTER_SUBGRAPH_H_
 
+#include <functional>
+#include <set>
 #include <unordered_map>
+#include <vector>
 
 #include <llvm/IR/Constants.h>
 #include <llvm/IR/DataLayout.h>
@@ -177,6 +180,7 @@ class LLVMPointerGraphBuilder {
                                         PointerSubgraph *parent);
 
     void buildArguments(const llvm::Function &F, PointerSubgraph *parent);
+    void removeNodes(const std::set<PSNode *> &nodes);
     PSNodesBlock buildArgumentsStructure(const llvm::Function &F);
     void buildGlobals();
 
@@ -197,6 +201,10 @@ class LLVMPointerGraphBuilder {
     std::unordered_map<const llvm::Value *, PSNodesSeq> nodes_map;
     // map of all built subgraphs - the value type is a pair (root, return)
     std::unordered_map<const llvm::Function *, PointerSubgraph *> subgraphs_map;
+    // subgraphs of changed functions that wait for being built again
+    // (see updateFunctions())
+    std::unordered_map<const llvm::Function *, PointerSubgraph *>
+            detached_subgraphs;
 
     std::vector<PSNodeFork *> forkNodes;
     std::vector<PSNodeJoin *> joinNodes;
@@ -212,6 +220,25 @@ class LLVMPointerGraphBuilder {
 
     PointerGraph *buildLLVMPointerGraph();
 
+    using FunctionsT = std::vector<const llvm::Function *>;
+
+    ///
+    // Update the built graph after the functions 'changed' were modified,
+    // 'added' were added to the module and 'removed' were erased from it.
+    // The nodes of the changed and removed functions are removed
+    // and the changed functions are built again (the added functions
+    // are built once they are called). Right before removing the nodes,
+    // 'invalidate' is called with the set of the removed nodes.
+    // The removed functions are used only as keys, so they may
+    // be already deleted. Return false if the graph cannot be updated
+    // this way, the graph is not changed in that case.
+    bool updateFunctions(
+            const FunctionsT &changed, const FunctionsT &added,
+            const FunctionsT &removed,
+            const std::function<void(const std::set<PSNode *> &)> &invalidate);
+
+    const llvm::Module *getModule() const { return M; }
+
     bool validateSubgraph(bool no_connectivity = false) const;
 
     void setAdHocBuilding(bool adHoc) { ad_hoc_building = adHoc; }
@@ -291,10 +318,11 @@ class LLVMPointerGraphBuilder {
         // node was optimized away and replaced by mapping),
         // return it
         if (auto *mp = mapping.get(val))
-            return mp;
+            return PS.getRepresentative(mp);
         if (auto *nds = getNodes(val)) {
             // otherwise get the representant of the built nodes
-            return nds->getRepresentant();
+            // (or the node it was merged into by the analysis)
+            return PS.getRepresentative(nds->getRepresentant());
         }
 
         // not built!
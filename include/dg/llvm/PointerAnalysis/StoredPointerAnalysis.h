@@ -0,0 +1,76 @@
+#ifndef DG_LLVM_STORED_POINTER_ANALYSIS_H_
+#define DG_LLVM_STORED_POINTER_ANALYSIS_H_
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <llvm/IR/Module.h>
+#include <llvm/Support/MemoryBuffer.h>
+
+#include "dg/llvm/PointerAnalysis/PointerAnalysis.h"
+
+namespace dg {
+
+///
+// Results of a pointer analysis stored in a file
+//
+// store() writes the points-to sets computed by any LLVMPointerAnalysis
+// into a binary file, run() loads them back. The values are identified
+// by the name of the function and the position of the instruction
+// (or of the argument) in the function and the global values by their
+// names, so the results can be loaded for the same module in another process.
+// The file contains also fingerprints of the functions and global variables
+// of the module and the results are not loaded for a different module.
+// The points-to sets are read directly from the (memory mapped) file,
+// loading the results resolves only the identities of the values.
+// Pointers that are constant expressions are not stored, their points-to sets
+// are derived from the sets of the global values on demand.
+class StoredPointerAnalysis : public LLVMPointerAnalysis {
+  public:
+    // the parts of the file
+    struct Header;
+    struct FunctionEntry;
+    struct PointerEntry;
+    struct SetEntry;
+    struct ValueEntry;
+
+    StoredPointerAnalysis(const llvm::Module *M,
+                          const LLVMPointerAnalysisOptions &opts)
+            : LLVMPointerAnalysis(opts), _module(M) {}
+
+    ///
+    // Write the results of 'PTA' for the module 'M' into the file 'path'.
+    // Returns false if the file could not be written.
+    static bool store(LLVMPointerAnalysis &PTA, const llvm::Module *M,
+                      const std::string &path);
+
+    ///
+    // Load the results from the file 'path'. Returns false if the file
+    // could not be read or if it was not created for this module.
+    bool load(const std::string &path);
+
+    bool hasPointsTo(const llvm::Value *val) override;
+    LLVMPointsToSet getLLVMPointsTo(const llvm::Value *val) override;
+    std::pair<bool, LLVMPointsToSet>
+    getLLVMPointsToChecked(const llvm::Value *val) override;
+
+    // load the results from the file given in the options
+    bool run() override;
+
+  private:
+    const llvm::Module *_module;
+    std::unique_ptr<llvm::MemoryBuffer> _buffer;
+    const PointerEntry *_pointers{nullptr};
+    // the values that the stored values are resolved to
+    std::vector<const llvm::Value *> _values;
+    std::unordered_map<const llvm::Value *, const SetEntry *> _sets;
+
+    const SetEntry *getSet(const llvm::Value *val, Offset &shift) const;
+};
+
+} // namespace dg
+
+#endif // DG_LLVM_STORED_POINTER_ANALYSIS_H_
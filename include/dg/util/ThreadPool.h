@@ -0,0 +1,171 @@
+#ifndef DG_UTIL_THREAD_POOL_H_
+#define DG_UTIL_THREAD_POOL_H_
+
+#include <algorithm>
+#include <cassert>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace dg {
+
+///
+// A simple pool of worker threads with a work-stealing scheduler.
+// Every worker has its own deque of tasks. A worker takes tasks
+// from the back of its deque and when the deque is empty, it steals
+// tasks from the front of deques of other workers.
+class ThreadPool {
+  public:
+    using Task = std::function<void()>;
+
+  private:
+    struct WorkQueue {
+        std::mutex lock;
+        std::deque<Task> tasks;
+    };
+
+    std::vector<std::unique_ptr<WorkQueue>> _queues;
+    std::vector<std::thread> _threads;
+
+    // protects the counters below
+    std::mutex _lock;
+    std::condition_variable _has_work;
+    std::condition_variable _done;
+    // number of queued tasks that were not claimed by any worker yet
+    size_t _queued{0};
+    // number of pushed tasks that did not finish yet
+    size_t _unfinished{0};
+    unsigned _next_queue{0};
+    bool _stop{false};
+
+    bool popLocal(unsigned idx, Task &task) {
+        auto &Q = *_queues[idx];
+        std::lock_guard<std::mutex> guard(Q.lock);
+        if (Q.tasks.empty())
+            return false;
+        task = std::move(Q.tasks.back());
+        Q.tasks.pop_back();
+        return true;
+    }
+
+    bool steal(unsigned idx, Task &task) {
+        for (unsigned i = 1; i < _queues.size(); ++i) {
+            auto &Q = *_queues[(idx + i) % _queues.size()];
+            std::lock_guard<std::mutex> guard(Q.lock);
+            if (Q.tasks.empty())
+                continue;
+            task = std::move(Q.tasks.front());
+            Q.tasks.pop_front();
+            return true;
+        }
+        return false;
+    }
+
+    void worker(unsigned idx) {
+        Task task;
+        while (true) {
+            {
+                std::unique_lock<std::mutex> guard(_lock);
+                _has_work.wait(guard,
+                               [this] { return _stop || _queued > 0; });
+                if (_queued == 0) {
+                    assert(_stop);
+                    return;
+                }
+                // claim one of the queued tasks. It is in some of the
+                // queues for sure, we just need to find it.
+                --_queued;
+            }
+
+            while (!popLocal(idx, task) && !steal(idx, task))
+                std::this_thread::yield();
+
+            task();
+
+            std::lock_guard<std::mutex> guard(_lock);
+            assert(_unfinished > 0);
+            if (--_unfinished == 0)
+                _done.notify_all();
+        }
+    }
+
+  public:
+    ThreadPool(unsigned workers) {
+        assert(workers > 0 && "Need at least one worker");
+        _queues.reserve(workers);
+        for (unsigned i = 0; i < workers; ++i)
+            _queues.emplace_back(new WorkQueue());
+
+        _threads.reserve(workers);
+        for (unsigned i = 0; i < workers; ++i)
+            _threads.emplace_back(&ThreadPool::worker, this, i);
+    }
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> guard(_lock);
+            _stop = true;
+        }
+        _has_work.notify_all();
+        for (auto &thr : _threads)
+            thr.join();
+    }
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    unsigned size() const { return static_cast<unsigned>(_threads.size()); }
+
+    void push(Task task) {
+        std::lock_guard<std::mutex> guard(_lock);
+        ++_unfinished;
+        {
+            auto &Q = *_queues[_next_queue];
+            _next_queue = (_next_queue + 1) % _queues.size();
+            std::lock_guard<std::mutex> qguard(Q.lock);
+            Q.tasks.push_back(std::move(task));
+        }
+        ++_queued;
+        _has_work.notify_one();
+    }
+
+    // wait until all pushed tasks are finished
+    void wait() {
+        std::unique_lock<std::mutex> guard(_lock);
+        _done.wait(guard, [this] { return _unfinished == 0; });
+    }
+
+    ///
+    // Call 'fun(i)' for every i in [0, num) and wait until all the calls
+    // are finished. The indices are split into chunks of at least
+    // 'min_chunk' elements. If there is only one chunk, the work is done
+    // in the calling thread.
+    template <typename Fun>
+    void parallelFor(size_t num, Fun fun, size_t min_chunk = 1) {
+        size_t chunk = std::max<size_t>(num / (4 * size()), 1);
+        chunk = std::max(chunk, min_chunk);
+
+        if (num <= chunk) {
+            for (size_t i = 0; i < num; ++i)
+                fun(i);
+            return;
+        }
+
+        for (size_t b = 0; b < num; b += chunk) {
+            const size_t e = std::min(b + chunk, num);
+            push([&fun, b, e] {
+                for (size_t i = b; i < e; ++i)
+                    fun(i);
+            });
+        }
+        wait();
+    }
+};
+
+} // namespace dg
+
+#endif // DG_UTIL_THREAD_POOL_H_
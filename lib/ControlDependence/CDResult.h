@@ -0,0 +1,105 @@
+#ifndef DG_CDRESULT_H_
+#define DG_CDRESULT_H_
+
+#include <algorithm>
+#include <cassert>
+#include <map>
+#include <set>
+#include <vector>
+
+#include "CDGraph.h"
+
+namespace dg {
+
+/////
+/// CDResult - control dependencies of nodes of a CDGraph stored
+/// in the compressed sparse row format. For every node we keep the nodes
+/// on which it depends, ordered by their IDs. The reverse relation
+/// is another CDResult (see reverse()).
+/////
+class CDResult {
+    // the node with the ID 'id' depends on the nodes
+    // _deps[_offsets[id - 1]], ..., _deps[_offsets[id] - 1]
+    std::vector<unsigned> _offsets{0};
+    std::vector<CDNode *> _deps;
+
+    static bool idLess(const CDNode *a, const CDNode *b) {
+        return a->getID() < b->getID();
+    }
+
+  public:
+    class DepsRange {
+        CDNode *const *_begin;
+        CDNode *const *_end;
+
+      public:
+        DepsRange(CDNode *const *b, CDNode *const *e) : _begin(b), _end(e) {}
+
+        CDNode *const *begin() const { return _begin; }
+        CDNode *const *end() const { return _end; }
+        size_t size() const { return _end - _begin; }
+        bool empty() const { return _begin == _end; }
+    };
+
+    CDResult() = default;
+
+    ///
+    // 'deps[i]' are the indices (IDs - 1) of nodes on which the node
+    // with the index 'i' depends. The vectors get sorted.
+    CDResult(CDGraph &graph, std::vector<std::vector<unsigned>> &deps) {
+        assert(deps.size() == graph.size());
+        _offsets.reserve(deps.size() + 1);
+        for (auto &nddeps : deps) {
+            std::sort(nddeps.begin(), nddeps.end());
+            nddeps.erase(std::unique(nddeps.begin(), nddeps.end()),
+                         nddeps.end());
+            for (auto idx : nddeps)
+                _deps.push_back(graph.getNode(idx + 1));
+            _offsets.push_back(_deps.size());
+        }
+    }
+
+    CDResult(CDGraph &graph, const std::map<CDNode *, std::set<CDNode *>> &CD) {
+        _offsets.reserve(graph.size() + 1);
+        for (auto *nd : graph) {
+            auto it = CD.find(nd);
+            if (it != CD.end()) {
+                auto start = _deps.size();
+                _deps.insert(_deps.end(), it->second.begin(), it->second.end());
+                std::sort(_deps.begin() + start, _deps.end(), idLess);
+            }
+            _offsets.push_back(_deps.size());
+        }
+    }
+
+    // the nodes on which 'nd' depends
+    DepsRange operator[](const CDNode *nd) const {
+        auto idx = nd->getID() - 1;
+        if (idx + 1 >= _offsets.size())
+            return {nullptr, nullptr};
+        return {_deps.data() + _offsets[idx], _deps.data() + _offsets[idx + 1]};
+    }
+
+    // the reverse relation (for every node the nodes that depend on it)
+    CDResult reverse(CDGraph &graph) const {
+        std::vector<std::vector<unsigned>> rev(graph.size());
+        for (size_t idx = 0; idx + 1 < _offsets.size(); ++idx) {
+            for (auto i = _offsets[idx]; i < _offsets[idx + 1]; ++i)
+                rev[_deps[i]->getID() - 1].push_back(idx);
+        }
+        return {graph, rev};
+    }
+
+    // the number of pairs in the relation
+    size_t size() const { return _deps.size(); }
+    bool empty() const { return _deps.empty(); }
+
+    bool operator==(const CDResult &rhs) const {
+        return _offsets == rhs._offsets && _deps == rhs._deps;
+    }
+    bool operator!=(const CDResult &rhs) const { return !(*this == rhs); }
+};
+
+} // namespace dg
+
+#endif // DG_CDRESULT_H_
@@ -0,0 +1,95 @@
+#ifndef DG_COMPACT_CDGRAPH_H_
+#define DG_COMPACT_CDGRAPH_H_
+
+#include <cassert>
+#include <vector>
+
+#include "CDGraph.h"
+
+namespace dg {
+
+/////
+/// CompactCDGraph - a read-only copy of the successor and predecessor
+/// relations of CDGraph in the compressed sparse row format. The nodes
+/// are referred to by dense indices (the index of a node is its ID - 1),
+/// so the algorithms can keep their data about nodes in plain vectors
+/// instead of maps keyed by pointers.
+/////
+class CompactCDGraph {
+    // the successors of the node with the index 'i' are
+    // _succs[_succ_offsets[i]], ..., _succs[_succ_offsets[i + 1] - 1]
+    // (and similarly for predecessors)
+    std::vector<unsigned> _succ_offsets;
+    std::vector<unsigned> _succs;
+    std::vector<unsigned> _pred_offsets;
+    std::vector<unsigned> _preds;
+    // the indices of nodes with more than one successor (in ascending order)
+    std::vector<unsigned> _predicates;
+
+  public:
+    // a range of indices of nodes
+    class EdgesRange {
+        const unsigned *_begin;
+        const unsigned *_end;
+
+      public:
+        EdgesRange(const unsigned *b, const unsigned *e) : _begin(b), _end(e) {}
+
+        const unsigned *begin() const { return _begin; }
+        const unsigned *end() const { return _end; }
+        size_t size() const { return _end - _begin; }
+        bool empty() const { return _begin == _end; }
+        unsigned operator[](size_t i) const {
+            assert(i < size());
+            return _begin[i];
+        }
+    };
+
+    CompactCDGraph(CDGraph &graph) {
+        _succ_offsets.reserve(graph.size() + 1);
+        _pred_offsets.reserve(graph.size() + 1);
+
+        for (auto *nd : graph) {
+            assert(getIndex(nd) == _succ_offsets.size());
+            _succ_offsets.push_back(_succs.size());
+            _pred_offsets.push_back(_preds.size());
+
+            for (auto *succ : nd->successors())
+                _succs.push_back(getIndex(succ));
+            for (auto *pred : nd->predecessors())
+                _preds.push_back(getIndex(pred));
+
+            if (nd->successors().size() > 1)
+                _predicates.push_back(getIndex(nd));
+        }
+        _succ_offsets.push_back(_succs.size());
+        _pred_offsets.push_back(_preds.size());
+    }
+
+    static unsigned getIndex(const CDNode *nd) { return nd->getID() - 1; }
+
+    size_t size() const { return _succ_offsets.size() - 1; }
+    bool empty() const { return size() == 0; }
+
+    EdgesRange successors(unsigned idx) const {
+        assert(idx < size());
+        return {_succs.data() + _succ_offsets[idx],
+                _succs.data() + _succ_offsets[idx + 1]};
+    }
+
+    EdgesRange predecessors(unsigned idx) const {
+        assert(idx < size());
+        return {_preds.data() + _pred_offsets[idx],
+                _preds.data() + _pred_offsets[idx + 1]};
+    }
+
+    bool isPredicate(unsigned idx) const {
+        return successors(idx).size() > 1;
+    }
+
+    const std::vector<unsigned> &predicates() const { return _predicates; }
+};
+
+} // namespace dg
+
+#endif // DG_COMPACT_CDGRAPH_H_
@@ -6,6 +6,7 @@
 
 #include "CDGraph.h"
 
+#include "dg/ADT/Bitvector.h"
 #include "dg/ADT/Queue.h"
 #include "dg/ADT/SetQueue.h"
 
@@ -16,9 +17,11 @@ class StrongControlClosure {
     template <typename Nodes, typename FunT>
     void foreachFirstReachable(const Nodes &nodes, CDNode *from,
                                const FunT &fun) {
-        ADT::SetQueue<ADT::QueueLIFO<CDNode *>> queue;
+        ADT::SparseBitvector visited;
+        ADT::QueueLIFO<CDNode *> queue;
         for (auto *s : from->successors()) {
-            queue.push(s);
+            if (!visited.set(s->getID()))
+                queue.push(s);
         }
 
         while (!queue.empty()) {
@@ -27,7 +30,8 @@ class StrongControlClosure {
                 fun(cur);
             } else {
                 for (auto *s : cur->successors()) {
-                    queue.push(s);
+                    if (!visited.set(s->getID()))
+                        queue.push(s);
                 }
             }
         }
@@ -42,30 +46,31 @@ class StrongControlClosure {
             unsigned short counter;
         };
 
-        std::unordered_map<CDNode *, Info> data;
-        data.reserve(graph.size());
+        // indexed by the IDs of nodes
+        std::vector<Info> data(graph.size() + 1);
         ADT::QueueLIFO<CDNode *> queue;
 
         // initialize nodes
         for (auto *nd : graph) {
-            auto &D = data[nd];
+            auto &D = data[nd->getID()];
             D.colored = false;
             D.counter = nd->successors().size();
         }
 
         // initialize the search
         for (auto *target : targets) {
-            data[target].colored = true;
+            data[target->getID()].colored = true;
             queue.push(target);
         }
 
         // search!
         while (!queue.empty()) {
             auto *node = queue.pop();
-            assert(data[node].colored && "A non-colored node in queue");
+            assert(data[node->getID()].colored &&
+                   "A non-colored node in queue");
 
             for (auto *pred : node->predecessors()) {
-                auto &D = data[pred];
+                auto &D = data[pred->getID()];
                 --D.counter;
                 if (D.counter == 0) {
                     D.colored = true;
@@ -76,7 +81,7 @@ class StrongControlClosure {
 
         std::set<CDNode *> retval;
         for (auto *n : graph) {
-            if (!data[n].colored) {
+            if (!data[n->getID()].colored) {
                 retval.insert(n);
             }
         }
@@ -3,14 +3,19 @@
 
 #include <functional>
 #include <map>
+#include <mutex>
 #include <set>
 #include <unordered_map>
 
 #include <dg/ADT/Bitvector.h>
 #include <dg/ADT/Queue.h>
 #include <dg/ADT/SetQueue.h>
+#include <dg/util/debug.h>
 
 #include "CDGraph.h"
+#include "CDResult.h"
+#include "CompactCDGraph.h"
+#include "ParallelCD.h"
 
 namespace dg {
 
@@ -19,58 +24,77 @@ namespace dg {
 // but we remember the results of calls to compute()
 class AllMaxPath {
   public:
-    using ResultT = std::map<CDNode *, const ADT::SparseBitvector &>;
+    // for every node (indexed by its index) the indices of nodes
+    // that lie on all max paths from the node
+    using ResultT = std::vector<ADT::SparseBitvector>;
 
   private:
-    struct Info {
-        ADT::SparseBitvector colors;
-        unsigned short counter;
+    // data of one chunk of targets (indexed by the indices of nodes)
+    struct State {
+        // the number of uncolored successors
+        std::vector<unsigned short> counters;
+        std::vector<unsigned> queue;
+        // the nodes colored by the current target
+        std::vector<unsigned> colored;
+
+        State(size_t size) : counters(size) {}
     };
 
-    std::unordered_map<CDNode *, Info> data;
+    ResultT colors;
+    // guards 'colors' when the targets are colored in parallel
+    std::mutex colors_lock;
 
-    void compute(CDGraph &graph, CDNode *target) {
+    // the targets are colored in parallel by this number of threads
+    unsigned threads;
+
+    // find the nodes colored by the target (including the target)
+    static void compute(const CompactCDGraph &graph, unsigned target,
+                        State &state) {
         // initialize nodes
-        for (auto *nd : graph) {
-            data[nd].counter = nd->successors().size();
+        for (unsigned nd = 0; nd < graph.size(); ++nd) {
+            state.counters[nd] = graph.successors(nd).size();
         }
 
-        // initialize the search
-        data[target].colors.set(target->getID());
-        ADT::QueueLIFO<CDNode *> queue;
-        queue.push(target);
+        // initialize the search (the queue is LIFO)
+        auto &queue = state.queue;
+        state.colored.clear();
+        state.colored.push_back(target);
+        queue.push_back(target);
 
         // search!
         while (!queue.empty()) {
-            auto *node = queue.pop();
-            assert(data[node].colors.get(target->getID()) &&
-                   "A non-colored node in queue");
-
-            for (auto *pred : node->predecessors()) {
-                auto &D = data[pred];
-                --D.counter;
-                if (D.counter == 0) {
-                    D.colors.set(target->getID());
-                    queue.push(pred);
+            auto node = queue.back();
+            queue.pop_back();
+            for (auto pred : graph.predecessors(node)) {
+                auto &counter = state.counters[pred];
+                --counter;
+                if (counter == 0) {
+                    state.colored.push_back(pred);
+                    queue.push_back(pred);
                 }
             }
         }
     }
 
   public:
-    // returns mapping CDNode -> Set of CDNodes (where the set is implemented as
-    // a bitvector)
-    ResultT compute(CDGraph &graph) {
-        ResultT res;
-
-        data.reserve(graph.size());
-
-        for (auto *nd : graph) {
-            compute(graph, nd);
-            res.emplace(nd, data[nd].colors);
-        }
+    AllMaxPath(unsigned threads = 1) : threads(threads) {}
+
+    const ResultT &compute(const CompactCDGraph &graph) {
+        colors.clear();
+        colors.resize(graph.size());
+
+        forEachInParallel(
+                getIndicesVector(graph.size()), threads,
+                [&graph]() { return State(graph.size()); },
+                [this, &graph](unsigned target, State &state) {
+                    compute(graph, target, state);
+                    std::lock_guard<std::mutex> guard(colors_lock);
+                    for (auto nd : state.colored) {
+                        colors[nd].set(target);
+                    }
+                });
 
-        return res;
+        return colors;
     }
 };
 
@@ -83,7 +107,7 @@ class DOD {
     // the ternary relation. However, the effect on the results of slicing
     // is usually small. There is a flag that computes the relation
     // as ternary.
-    using ResultT = std::map<CDNode *, std::set<CDNode *>>;
+    using ResultT = CDResult;
     using ColoringT = ADT::SparseBitvector;
 
   private:
@@ -92,31 +116,29 @@ class DOD {
         ColoringT blues;
         ColoringT reds;
 
-        // mapping G -> Ap
-        std::unordered_map<CDNode *, CDNode *> _mapping{};
-        // mapping Ap -> G
-        std::unordered_map<CDNode *, CDNode *> _rev_mapping{};
+        // mapping G -> Ap, indexed by the indices of nodes of G. This is
+        // a scratch vector shared by all Ap graphs of one chunk of
+        // predicates, so it is valid only for nodes that are in this Ap.
+        std::vector<CDNode *> *_mapping{nullptr};
+        // mapping Ap -> G (indexed by the IDs of Ap nodes - 1)
+        std::vector<unsigned> _rev_mapping{};
 
-        CDNode *createNode(CDNode *gnode) {
+        CDNode *createNode(unsigned gnode) {
             auto *nd = &Ap.createNode();
-            _mapping[gnode] = nd;
-            _rev_mapping[nd] = gnode;
+            (*_mapping)[gnode] = nd;
+            _rev_mapping.push_back(gnode);
+            assert(_rev_mapping.size() == nd->getID());
             return nd;
         }
 
-        CDNode *getNode(CDNode *gnode) {
-            auto it = _mapping.find(gnode);
-            return it == _mapping.end() ? nullptr : it->second;
-        }
+        CDNode *getNode(unsigned gnode) const { return (*_mapping)[gnode]; }
 
-        CDNode *getGNode(CDNode *apnode) {
-            auto it = _rev_mapping.find(apnode);
-            return it == _rev_mapping.end() ? nullptr : it->second;
+        unsigned getGNode(CDNode *apnode) const {
+            return _rev_mapping[apnode->getID() - 1];
         }
 
         ColoredAp() = default;
-        ColoredAp(CDGraph &&g, ColoringT &&b, ColoringT &&r)
-                : Ap(std::move(g)), blues(std::move(b)), reds(std::move(r)) {}
+        ColoredAp(std::vector<CDNode *> &mapping) : _mapping(&mapping) {}
         ColoredAp(ColoredAp &&) = default;
         ColoredAp(const ColoredAp &) = delete;
 
@@ -125,42 +147,43 @@ class DOD {
     };
 
     template <typename Nodes, typename FunT>
-    void foreachFirstReachable(const Nodes &nodes, CDNode *from,
-                               const FunT &fun) {
-        // FIXME: this breaks the complexity (it uses std::set)
-        ADT::SetQueue<ADT::QueueLIFO<CDNode *>> queue;
-        for (auto *s : from->successors()) {
-            queue.push(s);
+    static void foreachFirstReachable(const CompactCDGraph &graph,
+                                      const Nodes &nodes, unsigned from,
+                                      const FunT &fun) {
+        ADT::SparseBitvector visited;
+        std::vector<unsigned> queue;
+        for (auto s : graph.successors(from)) {
+            if (!visited.set(s))
+                queue.push_back(s);
         }
 
         while (!queue.empty()) {
-            auto *cur = queue.pop();
-            if (nodes.get(cur->getID())) { // the node is from Ap?
+            auto cur = queue.back();
+            queue.pop_back();
+            if (nodes.get(cur)) { // the node is from Ap?
                 fun(cur);
             } else {
-                for (auto *s : cur->successors()) {
-                    queue.push(s);
+                for (auto s : graph.successors(cur)) {
+                    if (!visited.set(s))
+                        queue.push_back(s);
                 }
             }
         }
     }
 
     // Create the Ap graph (nodes and edges)
-    ColoredAp createAp(const ADT::SparseBitvector &nodes, CDGraph &graph,
-                       CDNode *node) {
-        ColoredAp CAp;
+    static ColoredAp createAp(const ADT::SparseBitvector &nodes,
+                              const CompactCDGraph &graph, unsigned node,
+                              std::vector<CDNode *> &mapping) {
+        ColoredAp CAp(mapping);
         CDGraph &Ap = CAp.Ap;
 
         // create nodes of graph
-        for (auto *n : graph) {
-            if (nodes.get(n->getID())) {
-                CAp.createNode(n);
-                // DBG(cda, "  - Ap has node " << n->getID() << " (which is " <<
-                // nd->getID() << " in Ap)");
-            }
+        for (auto n : nodes) {
+            CAp.createNode(n);
         }
 
-        assert(CAp.getNode(node) != nullptr);
+        assert(nodes.get(node) && "node is not in Ap");
 
         if (CAp.Ap.size() < 3) {
             return {}; // no DOD possible, bail out early
@@ -168,18 +191,15 @@ class DOD {
 
         // Add edges. FIXME: we can use a better implementation
         for (auto *n : Ap) {
-            auto *gn = CAp.getGNode(n);
+            auto gn = CAp.getGNode(n);
 
-            foreachFirstReachable(nodes, gn, [&](CDNode *cur) {
+            foreachFirstReachable(graph, nodes, gn, [&](unsigned cur) {
                 auto *apn = CAp.getNode(cur);
                 assert(apn);
                 n->addSuccessor(apn);
-                // DBG(cda, "  - Ap edge " << gn->getID() << " -> " <<
-                // cur->getID());
             });
         }
 
-        assert(CAp.getNode(node) && "node is not in Ap");
         if (CAp.getNode(node)->successors().size() < 2) {
             return {}; // no DOD possible, skip the rest of building colored Ap
         }
@@ -188,68 +208,53 @@ class DOD {
     }
 
     // create the Ap graph (calls createAp) and color the nodes in the Ap graph
-    ColoredAp createColoredAp(AllMaxPath::ResultT &allpaths, CDGraph &graph,
-                              CDNode *node) {
-        auto it = allpaths.find(node);
-        if (it == allpaths.end()) {
-            return {};
-        }
-        const auto &nodes = it->second;
+    static ColoredAp createColoredAp(const AllMaxPath::ResultT &allpaths,
+                                     const CompactCDGraph &graph, unsigned node,
+                                     std::vector<CDNode *> &mapping) {
+        const auto &nodes = allpaths[node];
 
-        ColoredAp CAp = createAp(nodes, graph, node);
+        ColoredAp CAp = createAp(nodes, graph, node, mapping);
         if (CAp.Ap.empty()) {
             return {};
         }
 
         // initialize the colors
-        assert(node->successors().size() == 2 &&
+        assert(graph.successors(node).size() == 2 &&
                "Node is not the right predicate");
 
-        // FIXME: refactor...
         // color nodes
-        const auto &succs = node->successors();
-        auto sit = succs.begin();
-        CDNode *bluesucc = *sit;
-        CDNode *redsucc = *(++sit);
-        // DBG(cda, "Blue successor: " << bluesucc->getID());
-        // DBG(cda, "Red successor: " << redsucc->getID());
-        assert(++sit == succs.end());
-
-        if (nodes.get(bluesucc->getID())) { // is blue successor in Ap?
+        const auto &succs = graph.successors(node);
+        auto bluesucc = succs[0];
+        auto redsucc = succs[1];
+
+        if (nodes.get(bluesucc)) { // is blue successor in Ap?
             auto *apn = CAp.getNode(bluesucc);
             assert(apn);
             CAp.blues.set(apn->getID());
-            // DBG(cda, "  - Ap blue: " << apn->getID() << " ("
-            //                         << bluesucc->getID() << " in original)");
         } else {
-            foreachFirstReachable(nodes, bluesucc, [&](CDNode *cur) {
+            foreachFirstReachable(graph, nodes, bluesucc, [&](unsigned cur) {
                 auto *apn = CAp.getNode(cur);
                 assert(apn);
                 CAp.blues.set(apn->getID());
-                // DBG(cda, "  - Ap blue: " << apn->getID() << " ("
-                //                         << cur->getID() << " in original)");
             });
         }
 
         bool twocolors = false;
-        if (nodes.get(redsucc->getID())) { // is red successor in Ap?
+        if (nodes.get(redsucc)) { // is red successor in Ap?
             auto *apn = CAp.getNode(redsucc);
             assert(apn);
             if (CAp.blues.get(apn->getID())) {
                 twocolors = true;
             }
             CAp.reds.set(apn->getID());
-            // DBG(cda, "  - Ap red: " << redsucc->getID());
         } else {
-            foreachFirstReachable(nodes, redsucc, [&](CDNode *cur) {
+            foreachFirstReachable(graph, nodes, redsucc, [&](unsigned cur) {
                 auto *apn = CAp.getNode(cur);
                 assert(apn);
                 CAp.reds.set(apn->getID());
                 if (CAp.blues.get(apn->getID())) {
                     twocolors = true;
                 }
-                // DBG(cda, "  - Ap red: " << apn->getID() << " ("
-                //                        << cur->getID() << " in original)");
             });
         }
 
@@ -328,7 +333,8 @@ class DOD {
         return {n1, n2};
     }
 
-    void computeDOD(ColoredAp &CAp, CDNode *p, ResultT &CD, ResultT &revCD,
+    // 'dependent' are the (indices of) nodes that depend on the predicate
+    void computeDOD(ColoredAp &CAp, std::vector<unsigned> &dependent,
                     bool asTernary = false) {
         assert(checkAp(CAp.Ap)); // sanity check
 
@@ -364,32 +370,29 @@ class DOD {
         assert(r2);
 
         if (asTernary) {
-            constructTernaryRelation(CAp, p, CD, revCD, b2, b3, r1, r2);
+            constructTernaryRelation(CAp, dependent, b2, b3, r1, r2);
         } else { // break into binary relation
-            constructBinaryRelation(CAp, p, CD, revCD, b2, b3, r1, r2);
+            constructBinaryRelation(CAp, dependent, b2, b3, r1, r2);
         }
     }
 
-    static void constructTernaryRelation(ColoredAp &CAp, CDNode *p, ResultT &CD,
-                                         ResultT &revCD, CDNode *b2, CDNode *b3,
-                                         CDNode *r1, CDNode *r2) {
+    static void constructTernaryRelation(ColoredAp &CAp,
+                                         std::vector<unsigned> &dependent,
+                                         CDNode *b2, CDNode *b3, CDNode *r1,
+                                         CDNode *r2) {
         auto *cur = b2;
         do {
-            auto *gcur = CAp.getGNode(cur);
-            assert(gcur);
+            auto gcur = CAp.getGNode(cur);
 
             auto *ncur = r2;
             do {
-                auto *gncur = CAp.getGNode(ncur);
-                assert(gncur);
+                auto gncur = CAp.getGNode(ncur);
                 // DBG(cda, p->getID() << " - dod -> {" << gcur->getID() << ", "
                 //                                     << gncur->getID() <<
                 //                                     "}");
 
-                CD[gcur].insert(p);
-                CD[gncur].insert(p);
-                revCD[p].insert(gcur);
-                revCD[p].insert(gncur);
+                dependent.push_back(gcur);
+                dependent.push_back(gncur);
 
                 ncur = ncur->getSingleSuccessor();
             } while (!(CAp.isBlue(ncur) || CAp.isRed(ncur)));
@@ -402,15 +405,13 @@ class DOD {
         (void) r1;
     }
 
-    static void constructBinaryRelation(ColoredAp &CAp, CDNode *p, ResultT &CD,
-                                        ResultT &revCD, CDNode *b2, CDNode *b3,
-                                        CDNode *r1, CDNode *r2) {
+    static void constructBinaryRelation(ColoredAp &CAp,
+                                        std::vector<unsigned> &dependent,
+                                        CDNode *b2, CDNode *b3, CDNode *r1,
+                                        CDNode *r2) {
         auto *cur = b2;
         do {
-            auto *gcur = CAp.getGNode(cur);
-            assert(gcur);
-            CD[gcur].insert(p);
-            revCD[p].insert(gcur);
+            dependent.push_back(CAp.getGNode(cur));
             // DBG(cda, p->getID() << " - dod -> " << gcur->getID());
             cur = cur->getSingleSuccessor();
         } while (!(CAp.isBlue(cur) || CAp.isRed(cur)));
@@ -419,10 +420,7 @@ class DOD {
 
         cur = r2;
         do {
-            auto *gcur = CAp.getGNode(cur);
-            assert(gcur);
-            CD[gcur].insert(p);
-            revCD[p].insert(gcur);
+            dependent.push_back(CAp.getGNode(cur));
             // DBG(cda, p->getID() << " - dod -> " << gcur->getID());
             cur = cur->getSingleSuccessor();
         } while (!(CAp.isBlue(cur) || CAp.isRed(cur)));
@@ -431,17 +429,18 @@ class DOD {
     }
 
   protected:
+    // scratch data of one chunk of predicates
+    using MappingT = std::vector<CDNode *>;
+
     // make this public, so that we can use it in NTSCD+DOD algorithm
-    template <typename OnAllPaths>
-    void computeDOD(CDNode *p, CDGraph &graph, OnAllPaths &allpaths,
-                    ResultT &CD, ResultT &revCD) {
-        assert(p->successors().size() == 2 &&
+    void computeDOD(unsigned p, const CompactCDGraph &graph,
+                    const AllMaxPath::ResultT &allpaths, MappingT &mapping,
+                    std::vector<unsigned> &dependent) {
+        assert(graph.successors(p).size() == 2 &&
                "We work with at most 2 successors");
 
-        DBG_SECTION_BEGIN(cda, "Creating Ap graph for fun " << graph.getName()
-                                                            << " node "
-                                                            << p->getID());
-        auto res = createColoredAp(allpaths, graph, p);
+        DBG_SECTION_BEGIN(cda, "Creating Ap graph for node " << p + 1);
+        auto res = createColoredAp(allpaths, graph, p, mapping);
         DBG_SECTION_END(cda, "Done creating Ap graph");
         if (res.Ap.empty()) {
             DBG(cda, "No DOD in the Ap are possible");
@@ -450,32 +449,66 @@ class DOD {
         }
 
         DBG(cda, "Computing DOD from the Ap");
-        computeDOD(res, p, CD, revCD);
+        computeDOD(res, dependent);
+    }
+
+    // the predicates (and the targets in AllMaxPath) are processed
+    // in parallel by this number of threads
+    unsigned threads;
+
+    ///
+    // Call 'fun(p, mapping, dependent)' for every predicate 'p' of the graph
+    // where 'fun' stores the nodes that depend on 'p' into 'dependent'.
+    // The predicates are processed in parallel and the results
+    // are merged at the end.
+    template <typename FunT>
+    std::pair<ResultT, ResultT> forEachPredicate(CDGraph &graph,
+                                                 const CompactCDGraph &G,
+                                                 FunT fun) {
+        const auto &preds = G.predicates();
+        std::vector<std::vector<unsigned>> dependent(preds.size());
+
+        forEachInParallel(
+                getIndicesVector(preds.size()), threads,
+                [&G]() { return MappingT(G.size()); },
+                [&](unsigned i, MappingT &mapping) {
+                    fun(preds[i], mapping, dependent[i]);
+                });
+
+        std::vector<std::vector<unsigned>> deps(G.size());
+        for (size_t i = 0; i < preds.size(); ++i) {
+            for (auto nd : dependent[i])
+                deps[nd].push_back(preds[i]);
+        }
+        return mergeDependencies(graph, deps);
     }
 
   public:
-    std::pair<ResultT, ResultT> compute(CDGraph &graph) {
-        ResultT CD;
-        ResultT revCD;
+    DOD(unsigned threads = 1) : threads(threads) {}
 
+    std::pair<ResultT, ResultT> compute(CDGraph &graph) {
         DBG_SECTION_BEGIN(cda, "Computing DOD for all predicates");
 
-        AllMaxPath allmaxpath;
+        CompactCDGraph G(graph);
+        AllMaxPath allmaxpath(threads);
         DBG_SECTION_BEGIN(
                 cda,
                 "Coputing nodes that are on all max paths from nodes for fun "
                         << graph.getName());
-        auto allpaths = allmaxpath.compute(graph);
+        const auto &allpaths = allmaxpath.compute(G);
         DBG_SECTION_END(
                 cda,
                 "Done computing nodes that are on all max paths from nodes");
 
-        for (auto *p : graph.predicates()) {
-            computeDOD(p, graph, allpaths, CD, revCD);
-        }
+        auto result = forEachPredicate(
+                graph, G,
+                [&](unsigned p, MappingT &mapping,
+                    std::vector<unsigned> &dependent) {
+                    computeDOD(p, G, allpaths, mapping, dependent);
+                });
 
         DBG_SECTION_END(cda, "Finished computing DOD for all predicates");
-        return {CD, revCD};
+        return result;
     }
 };
 
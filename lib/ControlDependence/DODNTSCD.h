@@ -6,6 +6,7 @@
 #include <dg/ADT/SetQueue.h>
 
 #include "CDGraph.h"
+#include "CompactCDGraph.h"
 #include "DOD.h"
 
 namespace dg {
@@ -13,58 +14,52 @@ namespace dg {
 class DODNTSCD : public DOD {
     using ResultT = DOD::ResultT;
 
-    template <typename OnAllPathsT>
-    void computeNTSCD(CDNode *p, CDGraph &graph, const OnAllPathsT &onallpaths,
-                      ResultT &CD, ResultT &revCD) {
-        const auto &succs = p->successors();
+    static void computeNTSCD(unsigned p, const CompactCDGraph &graph,
+                             const AllMaxPath::ResultT &onallpaths,
+                             std::vector<unsigned> &dependent) {
+        const auto &succs = graph.successors(p);
         assert(succs.size() == 2);
-        auto succit = succs.begin();
-        auto *s1 = *succit;
-        auto *s2 = *(++succit);
-        assert(++succit == succs.end());
 
-        auto it1 = onallpaths.find(s1);
-        if (it1 == onallpaths.end())
-            return;
-        auto it2 = onallpaths.find(s2);
-        if (it2 == onallpaths.end())
-            return;
-
-        const auto &nodes1 = it1->second;
-        const auto &nodes2 = it2->second;
-        // FIXME: we could do that faster
-        for (auto *n : graph) {
-            if (nodes1.get(n->getID()) ^ nodes2.get(n->getID())) {
-                CD[n].insert(p);
-                revCD[p].insert(n);
-            }
+        // the nodes that are on all max paths only from one of the successors
+        const auto &nodes1 = onallpaths[succs[0]];
+        const auto &nodes2 = onallpaths[succs[1]];
+        for (auto n : nodes1) {
+            if (!nodes2.get(n))
+                dependent.push_back(n);
+        }
+        for (auto n : nodes2) {
+            if (!nodes1.get(n))
+                dependent.push_back(n);
         }
     }
 
   public:
-    std::pair<ResultT, ResultT> compute(CDGraph &graph) {
-        ResultT CD;
-        ResultT revCD;
+    DODNTSCD(unsigned threads = 1) : DOD(threads) {}
 
+    std::pair<ResultT, ResultT> compute(CDGraph &graph) {
         DBG_SECTION_BEGIN(cda, "Computing DOD for all predicates");
 
-        AllMaxPath allmaxpath;
+        CompactCDGraph G(graph);
+        AllMaxPath allmaxpath(threads);
         DBG_SECTION_BEGIN(
                 cda,
                 "Coputing nodes that are on all max paths from nodes for fun "
                         << graph.getName());
-        auto allpaths = allmaxpath.compute(graph);
+        const auto &allpaths = allmaxpath.compute(G);
         DBG_SECTION_END(
                 cda,
                 "Done coputing nodes that are on all max paths from nodes");
 
-        for (auto *p : graph.predicates()) {
-            computeDOD(p, graph, allpaths, CD, revCD);
-            computeNTSCD(p, graph, allpaths, CD, revCD);
-        }
+        auto result = forEachPredicate(
+                graph, G,
+                [&](unsigned p, MappingT &mapping,
+                    std::vector<unsigned> &dependent) {
+                    computeDOD(p, G, allpaths, mapping, dependent);
+                    computeNTSCD(p, G, allpaths, dependent);
+                });
 
         DBG_SECTION_END(cda, "Finished computing DOD for all predicates");
-        return {CD, revCD};
+        return result;
     }
 };
 
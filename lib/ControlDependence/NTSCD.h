@@ -7,43 +7,74 @@
 #include <vector>
 
 #include "CDGraph.h"
+#include "CDResult.h"
+#include "CompactCDGraph.h"
+#include "ParallelCD.h"
 #include "dg/ADT/Queue.h"
 #include "dg/ADT/SetQueue.h"
+#include "dg/util/debug.h"
 
 namespace dg {
 
 class NTSCD {
-    using ResultT = std::map<CDNode *, std::set<CDNode *>>;
+    using ResultT = CDResult;
+
+    // data of one chunk of targets (indexed by the indices of nodes)
+    struct State {
+        // the color of a node is the index of the last target
+        // whose coloring reached the node plus one
+        std::vector<unsigned> colors;
+        // is the node in the new frontier?
+        std::vector<bool> queued;
+        std::vector<unsigned> frontier;
+        std::vector<unsigned> new_frontier;
+
+        State(size_t size) : colors(size, 0), queued(size, false) {}
+
+        void queue(unsigned nd) {
+            if (!queued[nd]) {
+                queued[nd] = true;
+                new_frontier.push_back(nd);
+            }
+        }
 
-    struct Info {
-        unsigned color{0};
+        // make the new frontier the current one
+        void swap() {
+            frontier.swap(new_frontier);
+            new_frontier.clear();
+            for (auto nd : frontier)
+                queued[nd] = false;
+        }
     };
 
-    std::unordered_map<CDNode *, Info> data;
+    // the targets are colored in parallel by this number of threads
+    unsigned threads;
 
-    void compute(CDGraph &graph, CDNode *target, ResultT &CD, ResultT &revCD) {
-        std::set<CDNode *> frontier;
-        std::set<CDNode *> new_frontier;
+    // compute the predicates on which 'target' depends
+    static void compute(const CompactCDGraph &graph, unsigned target,
+                        State &state, std::vector<unsigned> &deps) {
+        auto &colors = state.colors;
+        const auto color = target + 1;
 
         // color the target node
-        data[target].color = target->getID();
-        for (auto *pred : target->predecessors()) {
-            if (data[pred].color != target->getID()) {
-                frontier.insert(pred);
+        colors[target] = color;
+        for (auto pred : graph.predecessors(target)) {
+            if (colors[pred] != color) {
+                state.queue(pred);
             }
         }
+        state.swap();
 
         bool progress;
         do {
             progress = false;
-            new_frontier.clear();
 
-            for (auto *nd : frontier) {
-                assert(!nd->successors().empty());
+            for (auto nd : state.frontier) {
+                assert(!graph.successors(nd).empty());
                 // do all successors have the right color?
                 bool colorit = true;
-                for (auto *succ : nd->successors()) {
-                    if (data[succ].color != target->getID()) {
+                for (auto succ : graph.successors(nd)) {
+                    if (colors[succ] != color) {
                         colorit = false;
                         break;
                     }
@@ -51,128 +82,147 @@ class NTSCD {
 
                 // color the node and enqueue its predecessors
                 if (colorit) {
-                    data[nd].color = target->getID();
-                    for (auto *pred : nd->predecessors()) {
-                        if (data[pred].color != target->getID()) {
-                            new_frontier.insert(pred);
+                    colors[nd] = color;
+                    for (auto pred : graph.predecessors(nd)) {
+                        if (colors[pred] != color) {
+                            state.queue(pred);
                         }
                     }
                     progress = true;
                 } else {
                     // re-queue the node as nothing happend
-                    new_frontier.insert(nd);
+                    state.queue(nd);
                 }
             }
 
-            new_frontier.swap(frontier);
+            state.swap();
         } while (progress);
 
         // iterate over frontier set, not over predicates -- only
         // the predicates that are in the frontier set may have colored
         // and uncolored successors
-        for (auto *predicate : frontier) {
-            if (!graph.isPredicate(*predicate))
+        for (auto predicate : state.frontier) {
+            if (!graph.isPredicate(predicate))
                 continue;
             bool has_colored = false;
             bool has_uncolored = false;
-            for (auto *succ : predicate->successors()) {
-                if (data[succ].color == target->getID())
+            for (auto succ : graph.successors(predicate)) {
+                if (colors[succ] == color)
                     has_colored = true;
-                if (data[succ].color != target->getID())
+                if (colors[succ] != color)
                     has_uncolored = true;
             }
 
             if (has_colored && has_uncolored) {
-                CD[target].insert(predicate);
-                revCD[predicate].insert(target);
+                deps.push_back(predicate);
             }
         }
     }
 
   public:
+    NTSCD(unsigned threads = 1) : threads(threads) {}
+
     // returns control dependencies and reverse control dependencies
     std::pair<ResultT, ResultT> compute(CDGraph &graph) {
-        ResultT CD;
-        ResultT revCD;
-
-        data.reserve(graph.size());
-
-        for (auto *nd : graph) {
-            compute(graph, nd, CD, revCD);
-        }
-
-        return {CD, revCD};
+        CompactCDGraph G(graph);
+        std::vector<std::vector<unsigned>> deps(G.size());
+
+        // each chunk of targets has its own colors, the colorings
+        // of the targets are independent
+        forEachInParallel(
+                getIndicesVector(G.size()), threads,
+                [&G]() { return State(G.size()); },
+                [&G, &deps](unsigned target, State &state) {
+                    compute(G, target, state, deps[target]);
+                });
+
+        return mergeDependencies(graph, deps);
     }
 };
 
 class NTSCD2 {
-    using ResultT = std::map<CDNode *, std::set<CDNode *>>;
+    using ResultT = CDResult;
 
     struct Info {
         unsigned colored{false};
         unsigned short counter;
     };
 
-    std::unordered_map<CDNode *, Info> data;
+    // data of one chunk of targets (indexed by the indices of nodes)
+    struct State {
+        std::vector<Info> data;
+        std::vector<unsigned> queue;
 
-    void compute(CDGraph &graph, CDNode *target) {
+        State(size_t size) : data(size) {}
+    };
+
+    // the targets are colored in parallel by this number of threads
+    unsigned threads;
+
+    static void compute(const CompactCDGraph &graph, unsigned target,
+                        State &state) {
+        auto &data = state.data;
         // initialize nodes
-        for (auto *nd : graph) {
+        for (unsigned nd = 0; nd < graph.size(); ++nd) {
             auto &D = data[nd];
             D.colored = false;
-            D.counter = nd->successors().size();
+            D.counter = graph.successors(nd).size();
         }
 
-        // initialize the search
+        // initialize the search (the queue is LIFO)
+        auto &queue = state.queue;
         data[target].colored = true;
-        ADT::QueueLIFO<CDNode *> queue;
-        queue.push(target);
+        queue.push_back(target);
 
         // search!
         while (!queue.empty()) {
-            auto *node = queue.pop();
+            auto node = queue.back();
+            queue.pop_back();
             assert(data[node].colored && "A non-colored node in queue");
 
-            for (auto *pred : node->predecessors()) {
+            for (auto pred : graph.predecessors(node)) {
                 auto &D = data[pred];
                 --D.counter;
                 if (D.counter == 0) {
                     D.colored = true;
-                    queue.push(pred);
+                    queue.push_back(pred);
                 }
             }
         }
     }
 
   public:
+    NTSCD2(unsigned threads = 1) : threads(threads) {}
+
     // returns control dependencies and reverse control dependencies
     std::pair<ResultT, ResultT> compute(CDGraph &graph) {
-        ResultT CD;
-        ResultT revCD;
-
-        data.reserve(graph.size());
-
-        for (auto *nd : graph) {
-            compute(graph, nd);
-
-            for (auto *predicate : graph.predicates()) {
-                bool has_colored = false;
-                bool has_uncolored = false;
-                for (auto *succ : predicate->successors()) {
-                    if (data[succ].colored)
-                        has_colored = true;
-                    if (!data[succ].colored)
-                        has_uncolored = true;
-                }
+        CompactCDGraph G(graph);
+        std::vector<std::vector<unsigned>> deps(G.size());
+
+        forEachInParallel(
+                getIndicesVector(G.size()), threads,
+                [&G]() { return State(G.size()); },
+                [&G, &deps](unsigned nd, State &state) {
+                    compute(G, nd, state);
+
+                    const auto &data = state.data;
+                    for (auto predicate : G.predicates()) {
+                        bool has_colored = false;
+                        bool has_uncolored = false;
+                        for (auto succ : G.successors(predicate)) {
+                            if (data[succ].colored)
+                                has_colored = true;
+                            if (!data[succ].colored)
+                                has_uncolored = true;
+                        }
 
-                if (has_colored && has_uncolored) {
-                    CD[nd].insert(predicate);
-                    revCD[predicate].insert(nd);
-                }
-            }
-        }
+                        if (has_colored && has_uncolored) {
+                            deps[nd].push_back(predicate);
+                        }
+                    }
+                });
 
-        return {CD, revCD};
+        return mergeDependencies(graph, deps);
     }
 };
 
@@ -0,0 +1,500 @@
+#ifndef DG_NTSCD_FAST_H_
+#define DG_NTSCD_FAST_H_
+
+#include <algorithm>
+#include <cassert>
+#include <utility>
+#include <vector>
+
+#include "CDGraph.h"
+#include "CDResult.h"
+#include "CompactCDGraph.h"
+#include "ParallelCD.h"
+#include "dg/util/debug.h"
+
+namespace dg {
+
+///
+// Computation of NTSCD that does not color the graph for every node.
+//
+// Let AMP(x) be the set of nodes that lie on all maximal paths from x
+// (the nodes that NTSCD colors when computing from x). If a and b are
+// in AMP(x), then a is in AMP(b) or b is in AMP(a), and AMP is transitive.
+// Therefore, AMP is a forest of classes of nodes (nodes a and b are
+// in one class if a is in AMP(b) and b is in AMP(a)): AMP(x) are the nodes
+// in the class of x and in all classes above it. A node n depends on
+// a predicate p iff n is in AMP(s) for some successor s of p, but not
+// in AMP(s') for another successor s'. That is, the dependent nodes are
+// those on the paths from the successors of p to their common ancestor.
+//
+// The forest is computed on the condensation of the graph similarly
+// to post-dominators (the parent of a node that is not on a cycle is
+// the nearest common ancestor of its successors). Nodes of a strongly
+// connected component with an edge leaving the component are roots
+// and the rest of the component is processed again without them.
+// Components that cannot be left are split by a node h and the nodes
+// that must reach h (see solveClosed()).
+//
+// The time is linear in the size of the graph and of the result,
+// except for components that cannot be left (infinite loops) that may
+// be split several times.
+class NTSCDFast {
+    using ResultT = CDResult;
+
+    enum : unsigned { NONE = ~0U };
+
+    enum class NodeState : unsigned char {
+        ACTIVE,
+        // the edges into the node are treated as edges into redirect[node]
+        DEFERRED,
+        DONE,
+    };
+
+    enum class TaskKind {
+        // compute the forest for the given nodes
+        SOLVE,
+        // activate the given (deferred) nodes and solve them
+        ACTIVATE,
+        // process a strongly connected component
+        COMPONENT,
+        // merge the class of the node with the nodes that
+        // lie on all paths from the node back to the node
+        MERGE,
+    };
+
+    struct Task {
+        TaskKind kind;
+        std::vector<unsigned> nodes;
+        unsigned node{NONE};
+
+        Task(TaskKind k, std::vector<unsigned> n, unsigned nd = NONE)
+                : kind(k), nodes(std::move(n)), node(nd) {}
+    };
+
+    const CompactCDGraph *graph{nullptr};
+    std::vector<NodeState> state;
+    std::vector<unsigned> redirect;
+
+    // union-find of the classes of nodes
+    std::vector<unsigned> classes;
+    // the members of a class form a circular list
+    std::vector<unsigned> members;
+    // for the representative of a class: a node from the parent class
+    std::vector<unsigned> parent;
+    // for the representative of a class: classes finished later have lower
+    // numbers, so parents have higher numbers than their children
+    std::vector<unsigned> order;
+    unsigned last_order{NONE};
+
+    std::vector<Task> tasks;
+
+    // data of Tarjan's algorithm
+    std::vector<unsigned> dfs_index;
+    std::vector<unsigned> lowpt;
+    std::vector<bool> on_stack;
+
+    // scratch data for closed components (indexed by global indices)
+    std::vector<unsigned> local;
+    std::vector<unsigned> stamp;
+    unsigned stamp_num{0};
+
+    unsigned getClass(unsigned nd) {
+        auto root = nd;
+        while (classes[root] != root)
+            root = classes[root];
+        while (classes[nd] != root) {
+            auto next = classes[nd];
+            classes[nd] = root;
+            nd = next;
+        }
+        return root;
+    }
+
+    // follow the redirections of deferred nodes
+    unsigned getTarget(unsigned nd) const {
+        while (state[nd] == NodeState::DEFERRED)
+            nd = redirect[nd];
+        return nd;
+    }
+
+    void finish(unsigned nd, unsigned par) {
+        assert(state[nd] == NodeState::ACTIVE);
+        state[nd] = NodeState::DONE;
+        parent[nd] = par;
+        order[nd] = last_order--;
+    }
+
+    unsigned getParentClass(unsigned cls) {
+        return parent[cls] == NONE ? NONE : getClass(parent[cls]);
+    }
+
+    // the nearest common ancestor class of two finished nodes
+    // (NONE if they are in different trees)
+    unsigned intersect(unsigned a, unsigned b) {
+        a = getClass(a);
+        b = getClass(b);
+        while (a != b) {
+            if (order[a] < order[b]) {
+                a = getParentClass(a);
+                if (a == NONE)
+                    return NONE;
+            } else {
+                b = getParentClass(b);
+                if (b == NONE)
+                    return NONE;
+            }
+        }
+        return a;
+    }
+
+    // the nearest common ancestor of the (finished) successors
+    unsigned getCommonAncestor(unsigned nd) {
+        unsigned anc = NONE;
+        bool first = true;
+        for (auto succ : graph->successors(nd)) {
+            succ = getTarget(succ);
+            assert(state[succ] == NodeState::DONE);
+            if (first) {
+                anc = getClass(succ);
+                first = false;
+            } else {
+                anc = intersect(anc, succ);
+                if (anc == NONE)
+                    break;
+            }
+        }
+        return anc;
+    }
+
+    void push(TaskKind kind, std::vector<unsigned> nodes,
+              unsigned node = NONE) {
+        if (nodes.empty() && kind != TaskKind::MERGE)
+            return;
+        tasks.emplace_back(kind, std::move(nodes), node);
+    }
+
+    // strongly connected components of the active nodes 'nodes'
+    // in reverse topological order
+    std::vector<std::vector<unsigned>>
+    getComponents(const std::vector<unsigned> &nodes) {
+        std::vector<std::vector<unsigned>> components;
+        std::vector<unsigned> stack;
+        // (node, the index of the next successor)
+        std::vector<std::pair<unsigned, unsigned>> dfs;
+        unsigned index = 0;
+
+        for (auto nd : nodes)
+            dfs_index[nd] = NONE;
+
+        for (auto start : nodes) {
+            if (dfs_index[start] != NONE)
+                continue;
+
+            dfs.emplace_back(start, 0);
+            dfs_index[start] = lowpt[start] = index++;
+            stack.push_back(start);
+            on_stack[start] = true;
+
+            while (!dfs.empty()) {
+                auto nd = dfs.back().first;
+                auto &next = dfs.back().second;
+                auto succs = graph->successors(nd);
+                if (next < succs.size()) {
+                    auto succ = getTarget(succs[next++]);
+                    if (state[succ] == NodeState::DONE)
+                        continue;
+                    if (dfs_index[succ] == NONE) {
+                        dfs_index[succ] = lowpt[succ] = index++;
+                        stack.push_back(succ);
+                        on_stack[succ] = true;
+                        dfs.emplace_back(succ, 0);
+                    } else if (on_stack[succ]) {
+                        lowpt[nd] = std::min(lowpt[nd], dfs_index[succ]);
+                    }
+                    continue;
+                }
+
+                dfs.pop_back();
+                if (!dfs.empty()) {
+                    auto pred = dfs.back().first;
+                    lowpt[pred] = std::min(lowpt[pred], lowpt[nd]);
+                }
+
+                if (lowpt[nd] == dfs_index[nd]) {
+                    std::vector<unsigned> component;
+                    unsigned w;
+                    do {
+                        w = stack.back();
+                        stack.pop_back();
+                        on_stack[w] = false;
+                        component.push_back(w);
+                    } while (w != nd);
+                    components.push_back(std::move(component));
+                }
+            }
+        }
+
+        return components;
+    }
+
+    bool hasSelfLoop(unsigned nd) const {
+        for (auto succ : graph->successors(nd)) {
+            if (getTarget(succ) == nd)
+                return true;
+        }
+        return false;
+    }
+
+    void solve(const std::vector<unsigned> &nodes) {
+        auto components = getComponents(nodes);
+        // process the components in reverse topological order,
+        // the tasks are taken from the back
+        for (auto it = components.rbegin(), et = components.rend(); it != et;
+             ++it) {
+            push(TaskKind::COMPONENT, std::move(*it));
+        }
+    }
+
+    void solveComponent(const std::vector<unsigned> &component) {
+        if (component.size() == 1) {
+            auto nd = component[0];
+            // a node on a cycle with itself can loop forever
+            finish(nd, hasSelfLoop(nd) ? NONE : getCommonAncestor(nd));
+            return;
+        }
+
+        // a path can leave the component from these nodes
+        // and never come back, so they are the roots
+        std::vector<unsigned> rest;
+        std::vector<unsigned> exits;
+        for (auto nd : component) {
+            bool is_exit = false;
+            for (auto succ : graph->successors(nd)) {
+                if (state[getTarget(succ)] == NodeState::DONE) {
+                    is_exit = true;
+                    break;
+                }
+            }
+            (is_exit ? exits : rest).push_back(nd);
+        }
+
+        if (exits.empty()) {
+            solveClosed(component);
+            return;
+        }
+
+        for (auto nd : exits)
+            finish(nd, NONE);
+        push(TaskKind::SOLVE, std::move(rest));
+    }
+
+    ///
+    // Solve a strongly connected component that has no edges leaving it.
+    // We pick a node h and compute Z, the nodes that must reach h
+    // (Z = AMP^{-1}(h)). If Z is the whole component, then h lies on all
+    // cycles and the component without h is acyclic. Otherwise, the nodes
+    // W outside Z never have a node from Z in AMP. If h has a successor
+    // in Z, then AMP(h) = {h} and paths from W into Z can avoid W forever.
+    // If it has not, then Z \ {h} is just a detour to h for W and we solve
+    // W and h first with the edges into Z \ {h} redirected to h.
+    void solveClosed(const std::vector<unsigned> &component) {
+        const auto size = component.size();
+        for (unsigned i = 0; i < size; ++i)
+            local[component[i]] = i;
+
+        // successors and predecessors inside the component
+        // (without duplicates that arise due to redirections)
+        std::vector<std::vector<unsigned>> succs(size);
+        std::vector<std::vector<unsigned>> preds(size);
+        for (unsigned i = 0; i < size; ++i) {
+            ++stamp_num;
+            for (auto succ : graph->successors(component[i])) {
+                succ = getTarget(succ);
+                assert(state[succ] == NodeState::ACTIVE);
+                if (stamp[succ] == stamp_num)
+                    continue;
+                stamp[succ] = stamp_num;
+                succs[i].push_back(local[succ]);
+                preds[local[succ]].push_back(i);
+            }
+        }
+
+        // if a node has a single successor, then the successor is
+        // on all maximal paths from the node and Z is not trivial
+        unsigned h = NONE;
+        for (unsigned i = 0; i < size && h == NONE; ++i) {
+            if (succs[i].size() == 1 && succs[i][0] != i)
+                h = succs[i][0];
+        }
+
+        if (h == NONE) {
+            // all nodes have at least two successors, so no
+            // other node lies on all maximal paths from a node
+            for (auto nd : component)
+                finish(nd, NONE);
+            return;
+        }
+
+        std::vector<unsigned> counters(size);
+        std::vector<bool> in_z(size, false);
+        for (unsigned i = 0; i < size; ++i)
+            counters[i] = succs[i].size();
+        std::vector<unsigned> queue{h};
+        in_z[h] = true;
+        while (!queue.empty()) {
+            auto cur = queue.back();
+            queue.pop_back();
+            for (auto pred : preds[cur]) {
+                if (--counters[pred] == 0 && !in_z[pred]) {
+                    in_z[pred] = true;
+                    queue.push_back(pred);
+                }
+            }
+        }
+
+        std::vector<unsigned> Z;
+        std::vector<unsigned> W;
+        for (unsigned i = 0; i < size; ++i) {
+            if (i != h)
+                (in_z[i] ? Z : W).push_back(component[i]);
+        }
+
+        const auto hnode = component[h];
+        if (W.empty()) {
+            // h lies on all cycles
+            finish(hnode, NONE);
+            push(TaskKind::MERGE, {}, hnode);
+            push(TaskKind::SOLVE, std::move(Z));
+            return;
+        }
+
+        bool has_z_succ = false;
+        for (auto succ : succs[h]) {
+            if (in_z[succ]) {
+                has_z_succ = true;
+                break;
+            }
+        }
+
+        if (has_z_succ) {
+            finish(hnode, NONE);
+            push(TaskKind::SOLVE, std::move(W));
+            push(TaskKind::SOLVE, std::move(Z));
+            return;
+        }
+
+        for (auto nd : Z) {
+            state[nd] = NodeState::DEFERRED;
+            redirect[nd] = hnode;
+        }
+        W.push_back(hnode);
+        push(TaskKind::ACTIVATE, std::move(Z));
+        push(TaskKind::SOLVE, std::move(W));
+    }
+
+    // 'nd' lies on all cycles of its (closed) component, so the nodes
+    // on all paths from 'nd' back to 'nd' are in its class
+    void mergeCycle(unsigned nd) {
+        auto anc = getCommonAncestor(nd);
+        assert(anc != NONE && "The node is not on a cycle");
+
+        const auto cls = getClass(nd);
+        auto cur = anc;
+        while (cur != cls) {
+            auto next = getParentClass(cur);
+            assert(next != NONE);
+            classes[cur] = cls;
+            std::swap(members[cur], members[cls]);
+            cur = next;
+        }
+    }
+
+    void run() {
+        while (!tasks.empty()) {
+            auto task = std::move(tasks.back());
+            tasks.pop_back();
+
+            switch (task.kind) {
+            case TaskKind::ACTIVATE:
+                for (auto nd : task.nodes)
+                    state[nd] = NodeState::ACTIVE;
+                solve(task.nodes);
+                break;
+            case TaskKind::SOLVE:
+                solve(task.nodes);
+                break;
+            case TaskKind::COMPONENT:
+                solveComponent(task.nodes);
+                break;
+            case TaskKind::MERGE:
+                mergeCycle(task.node);
+                break;
+            }
+        }
+    }
+
+    void initialize(const CompactCDGraph &G) {
+        const auto size = G.size();
+        graph = &G;
+        state.assign(size, NodeState::ACTIVE);
+        redirect.assign(size, NONE);
+        classes.resize(size);
+        members.resize(size);
+        for (unsigned i = 0; i < size; ++i)
+            classes[i] = members[i] = i;
+        parent.assign(size, NONE);
+        order.assign(size, NONE);
+        last_order = NONE - 1;
+        dfs_index.assign(size, NONE);
+        lowpt.assign(size, 0);
+        on_stack.assign(size, false);
+        local.assign(size, NONE);
+        stamp.assign(size, 0);
+        stamp_num = 0;
+    }
+
+  public:
+    // returns control dependencies and reverse control dependencies
+    std::pair<ResultT, ResultT> compute(CDGraph &graph) {
+        DBG_SECTION_BEGIN(cda, "Computing NTSCD (fast) for fun "
+                                       << graph.getName());
+        CompactCDGraph G(graph);
+        initialize(G);
+
+        solve(getIndicesVector(G.size()));
+        run();
+
+        // the nodes on the paths from the successors of a predicate
+        // to their nearest common ancestor depend on the predicate
+        std::vector<std::vector<unsigned>> deps(G.size());
+        std::vector<unsigned> visited(G.size(), NONE);
+        for (auto p : G.predicates()) {
+            auto anc = getCommonAncestor(p);
+            for (auto succ : G.successors(p)) {
+                auto cls = getClass(succ);
+                while (cls != anc && visited[cls] != p) {
+                    visited[cls] = p;
+                    auto nd = cls;
+                    do {
+                        // NTSCD does not make a predicate
+                        // dependent on itself
+                        if (nd != p)
+                            deps[nd].push_back(p);
+                        nd = members[nd];
+                    } while (nd != cls);
+
+                    cls = getParentClass(cls);
+                    if (cls == NONE)
+                        break;
+                }
+            }
+        }
+
+        DBG_SECTION_END(cda, "Finished computing NTSCD (fast)");
+        return mergeDependencies(graph, deps);
+    }
+};
+
+} // namespace dg
+
+#endif // DG_NTSCD_FAST_H_
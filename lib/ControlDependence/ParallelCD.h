@@ -0,0 +1,62 @@
+#ifndef DG_PARALLEL_CD_H_
+#define DG_PARALLEL_CD_H_
+
+#include <algorithm>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "CDGraph.h"
+#include "CDResult.h"
+#include "dg/util/ThreadPool.h"
+
+namespace dg {
+
+///
+// Call 'fun(elem, state)' for every element of 'elems' (usually indices
+// of nodes or predicates). The elements are split into chunks that are
+// processed by 'threads' threads (or sequentially if 'threads' is at most 1).
+// Every chunk has its own state created by 'init()' that is reused for all
+// the elements from the chunk, so 'fun' does not need any synchronization
+// as long as it writes only into the state and into the data of the element.
+template <typename ElemsT, typename InitT, typename FunT>
+void forEachInParallel(const ElemsT &elems, unsigned threads, InitT init,
+                       FunT fun) {
+    if (threads <= 1) {
+        auto state = init();
+        for (const auto &elem : elems)
+            fun(elem, state);
+        return;
+    }
+
+    // more chunks than threads so that the work is balanced
+    const size_t chunks = std::min<size_t>(4 * threads, elems.size());
+    ThreadPool workers(threads);
+    workers.parallelFor(chunks, [&](size_t c) {
+        auto state = init();
+        for (size_t i = c; i < elems.size(); i += chunks)
+            fun(elems[i], state);
+    });
+}
+
+// the indices 0, ..., num - 1 in a vector
+inline std::vector<unsigned> getIndicesVector(size_t num) {
+    std::vector<unsigned> indices(num);
+    std::iota(indices.begin(), indices.end(), 0);
+    return indices;
+}
+
+///
+// Create the control dependence relation and its reverse from the
+// dependencies of single nodes ('deps[i]' are the indices of nodes
+// on which the node with the index 'i' depends).
+inline std::pair<CDResult, CDResult>
+mergeDependencies(CDGraph &graph, std::vector<std::vector<unsigned>> &deps) {
+    CDResult CD(graph, deps);
+    auto revCD = CD.reverse(graph);
+    return {std::move(CD), std::move(revCD)};
+}
+
+} // namespace dg
+
+#endif // DG_PARALLEL_CD_H_
@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include "dg/MemorySSA/MemorySSA.h"
 
 #include "dg/util/debug.h"
@@ -45,12 +47,78 @@ void Definitions::update(RWNode *node, RWNode *defnode) {
                "Update on unknown offset");
         assert(!ds.target->isUnknown() && "Update on unknown memory");
 
+        if (ds.target->isScalar()) {
+            assert(ds.offset.isZero() && "Scalar overwritten partially");
+            scalars[ds.target] = {defnode, ds.len, unknownWrites.size()};
+            continue;
+        }
+
         kills.add(ds, defnode);
         definitions.update(ds, defnode);
     }
 }
 
+std::vector<RWNode *>
+Definitions::getScalarDefinitions(const ScalarDefinition &sd) const {
+    std::vector<RWNode *> ret{sd.node};
+    ret.insert(ret.end(), unknownWrites.begin() + sd.unknownWritesNum,
+               unknownWrites.end());
+    return ret;
+}
+
+void Definitions::addScalarDefinitions(const DefSite &ds,
+                                       std::set<RWNode *> &defs) const {
+    auto it = scalars.find(ds.target);
+    if (it == scalars.end())
+        return;
+    // does 'ds' access some of the defined bytes?
+    if (!ds.offset.isUnknown() && ds.offset >= it->second.len)
+        return;
+
+    auto nodes = getScalarDefinitions(it->second);
+    defs.insert(nodes.begin(), nodes.end());
+}
+
+void Definitions::removeKilledScalar(const RWNode *target,
+                                     IntervalsT &intervals) const {
+    auto it = scalars.find(const_cast<RWNode *>(target));
+    if (it == scalars.end())
+        return;
+
+    // only the bytes after the end of the scalar may be uncovered
+    const Offset &len = it->second.len;
+    IntervalsT ret;
+    for (const auto &I : intervals) {
+        if (I.end >= len)
+            ret.emplace_back(std::max(I.start, len), I.end);
+    }
+    intervals.swap(ret);
+}
+
+void Definitions::expandScalars() {
+    for (const auto &it : scalars) {
+        DefSite ds{it.first, 0, it.second.len};
+        kills.update(ds, it.second.node);
+        definitions.update(ds, it.second.node);
+        for (auto I = unknownWrites.begin() + it.second.unknownWritesNum,
+                  E = unknownWrites.end();
+             I != E; ++I) {
+            definitions.add(ds, *I);
+        }
+    }
+    scalars.clear();
+}
+
 void Definitions::join(const Definitions &rhs) {
+    // the definitions of scalars are not a single node after the join
+    expandScalars();
+    if (!rhs.scalars.empty()) {
+        Definitions tmp = rhs;
+        tmp.expandScalars();
+        join(tmp);
+        return;
+    }
+
     definitions.add(rhs.definitions);
     kills = kills.intersect(rhs.kills);
     unknownWrites.insert(unknownWrites.end(), rhs.unknownWrites.begin(),
@@ -65,6 +133,11 @@ void Definitions::dump() const {
     std::cout << " -- kills -- \n";
     kills.dump();
     std::cout << "\n";
+    std::cout << " -- scalars -- \n";
+    for (const auto &it : scalars) {
+        std::cout << it.first->getID() << ": " << it.second.node->getID()
+                  << "\n";
+    }
     std::cout << " -- unknown writes -- \n";
     for (auto *nd : unknownWrites) {
         std::cout << nd->getID() << " ";
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <set>
 #include <vector>
 
@@ -5,6 +6,7 @@
 #include "dg/MemorySSA/MemorySSA.h"
 //#include "dg/BBlocksBuilder.h"
 
+#include "dg/util/ThreadPool.h"
 #include "dg/util/debug.h"
 
 namespace dg {
@@ -93,8 +95,12 @@ MemorySSATransformation::findDefinitions(RWNode *node, const DefSite &ds) {
 
 RWNode *MemorySSATransformation::createPhi(const DefSite &ds, RWNodeType type) {
     // This phi is the definition that we are looking for.
-    _phis.emplace_back(&graph.create(type));
-    auto *phi = _phis.back();
+    RWNode *phi;
+    {
+        std::lock_guard<std::mutex> guard(_nodes_lock);
+        phi = &graph.create(type);
+        _phis.push_back(phi);
+    }
     assert(phi->isPhi() && "Got wrong type");
 
     phi->addOverwrites(ds);
@@ -154,7 +160,7 @@ void MemorySSATransformation::findDefinitionsInMultiplePredecessors(
         // so the iterator should not be invalidated.
         phi = createAndPlacePhi(block, ds);
         // recursively find definitions for this phi node
-        findPhiDefinitions(phi);
+        searchPhiOperands(phi, [this, phi]() { findPhiDefinitions(phi); });
     } else if (canBeInput(ds.target, block->getSubgraph())) {
         // this is the entry block, so we add a PHI node
         // representing "input" into this procedure
@@ -165,7 +171,17 @@ void MemorySSATransformation::findDefinitionsInMultiplePredecessors(
         auto &summary = getSubgraphSummary(subg);
         summary.addInput(ds, phi);
 
-        findDefinitionsFromCalledFun(phi, subg, ds);
+        auto search = [this, phi, subg, ds]() {
+            findDefinitionsFromCalledFun(phi, subg, ds);
+        };
+        if (_summarizing) {
+            // the callers may be summarized by other threads right now,
+            // search them when the summaries are done
+            std::lock_guard<std::mutex> guard(_nodes_lock);
+            _pending_phis.emplace(phi, search);
+        } else {
+            searchPhiOperands(phi, search);
+        }
     }
 
     if (phi) {
@@ -300,14 +316,24 @@ void MemorySSATransformation::findDefinitionsInSubgraph(RWNode *phi,
         // do not search the procedure if it cannot define the memory
         // (this saves creating PHI nodes). If it may define only
         // unknown memory, add that definitions directly and continue searching
-        // before the call.
+        // before the call. The summarized procedures have outputs for
+        // all memory that they may define, so they do not define
+        // the uncovered bytes either.
+        if (si.summarized) {
+            // do not change the summary, it is shared by threads
+            for (auto *def : si.modref.getUnknownDefs()) {
+                phi->addDefUse(def);
+            }
+            phi->addDefUse(findDefinitions(C, subgds));
+            continue;
+        }
         if (!si.modref.mayDefine(ds.target)) {
             if (si.modref.mayDefineUnknown()) {
                 auto *subgphi =
                         createPhi(subgds, /* type = */ RWNodeType::OUTARG);
                 summary.addOutput(subgds, subgphi);
-                for (const auto &it : si.modref.getMayDef(UNKNOWN_MEMORY)) {
-                    subgphi->addDefUse(it);
+                for (auto *def : si.modref.getUnknownDefs()) {
+                    subgphi->addDefUse(def);
                 }
                 phi->addDefUse(subgphi);
             }
@@ -321,16 +347,18 @@ void MemorySSATransformation::findDefinitionsInSubgraph(RWNode *phi,
         phi->addDefUse(subgphi);
 
         // find the new phi operands
-        for (auto *subgblock : subg->bblocks()) {
-            if (subgblock->hasSuccessors()) {
-                continue;
-            }
-            if (!subgblock->isReturnBBlock()) {
-                // ignore blocks that does not return to this subgraph
-                continue;
+        searchPhiOperands(subgphi, [this, subgphi, subg, ds]() {
+            for (auto *subgblock : subg->bblocks()) {
+                if (subgblock->hasSuccessors()) {
+                    continue;
+                }
+                if (!subgblock->isReturnBBlock()) {
+                    // ignore blocks that does not return to this subgraph
+                    continue;
+                }
+                subgphi->addDefUse(findDefinitions(subgblock, ds));
             }
-            subgphi->addDefUse(findDefinitions(subgblock, ds));
-        }
+        });
     }
     DBG_SECTION_END(tmp, "Done searching definitions in subgraph "
                                  << subg->getName());
@@ -370,14 +398,16 @@ void MemorySSATransformation::fillDefinitionsFromCall(Definitions &D,
         C->addOutput(phi);
 
         // recursively find definitions for this phi node
-        for (auto &callee : C->getCallees()) {
-            if (auto *subg = callee.getSubgraph()) {
-                findDefinitionsInSubgraph(phi, C, uncoveredds, subg);
-            } else {
-                addDefinitionsFromCalledValue(phi, C, uncoveredds,
-                                              callee.getCalledValue());
+        searchPhiOperands(phi, [this, phi, C, uncoveredds]() {
+            for (auto &callee : C->getCallees()) {
+                if (auto *subg = callee.getSubgraph()) {
+                    findDefinitionsInSubgraph(phi, C, uncoveredds, subg);
+                } else {
+                    addDefinitionsFromCalledValue(phi, C, uncoveredds,
+                                                  callee.getCalledValue());
+                }
             }
-        }
+        });
     }
 }
 
@@ -399,7 +429,9 @@ void MemorySSATransformation::findDefinitionsFromCalledFun(RWNode *phi,
         C->addInput(callphi);
 
         phi->addDefUse(callphi);
-        callphi->addDefUse(findDefinitions(callphi, ds));
+        searchPhiOperands(callphi, [this, callphi, ds]() {
+            callphi->addDefUse(findDefinitions(callphi, ds));
+        });
     }
 }
 
@@ -432,6 +464,9 @@ Definitions &MemorySSATransformation::getBBlockDefinitions(RWBBlock *b,
             assert(D.isProcessed());
         }
     } else {
+        if (_budget)
+            _budget->visit(b->size());
+        ++_lvn_bblocks;
         performLvn(D, b); // normal basic block
         assert(D.isProcessed());
         DBG(dda, "Retrived LVN'd definitions for block " << b->getID());
@@ -522,6 +557,18 @@ static void joinDefinitions(DefinitionsMap<RWNode> &from,
 static void joinDefinitions(Definitions &from, Definitions &to,
                             bool escaping = false) {
     joinDefinitions(from.definitions, to.definitions, escaping);
+    // scalars do not escape
+    if (!escaping) {
+        for (const auto &it : from.scalars) {
+            DefSite ds{it.first, 0, it.second.len};
+            auto nodes = from.getScalarDefinitions(it.second);
+            for (auto &undefInterv : to.definitions.undefinedIntervals(ds)) {
+                to.definitions.add(
+                        {ds.target, undefInterv.start, undefInterv.length()},
+                        nodes);
+            }
+        }
+    }
     to.unknownWrites.insert(to.unknownWrites.end(), from.unknownWrites.begin(),
                             from.unknownWrites.end());
     // we ignore 'kills' and 'unknownReads' as this function is used
@@ -551,21 +598,12 @@ void MemorySSATransformation::fillDefinitionsFromCall(Definitions &D,
             computeModRef(subg, si);
             assert(si.modref.isInitialized());
 
-            for (const auto &it : si.modref.maydef) {
-                if (it.first->isUnknown()) {
-                    for (const auto &it2 : it.second) {
-                        D.unknownWrites.insert(D.unknownWrites.end(),
-                                               it2.second.begin(),
-                                               it2.second.end());
-                    }
-                    continue;
-                }
-                for (const auto &it2 : it.second) {
-                    fillDefinitionsFromCall(
-                            D, C,
-                            {it.first, it2.first.start, it2.first.length()});
-                }
-            }
+            const auto &unknownDefs = si.modref.getUnknownDefs();
+            D.unknownWrites.insert(D.unknownWrites.end(), unknownDefs.begin(),
+                                   unknownDefs.end());
+            si.modref.forEachMayDef([this, &D, C](const DefSite &ds) {
+                fillDefinitionsFromCall(D, C, ds);
+            });
         }
     }
 
@@ -644,14 +682,16 @@ void MemorySSATransformation::collectAllDefinitionsInCallers(Definitions &defs,
         // not covered by 'defs'. Therefore, we can reuse this search
         // in all later searches.
         // auto tmpDefs = defs;
-        Definitions tmpDefs;
-        collectAllDefinitions(callsite, tmpDefs, /* escaping = */ true);
-        for (const auto &it : tmpDefs.definitions) {
-            for (const auto &it2 : it.second) {
-                callphi->addDefUse(it2.second);
+        searchPhiOperands(callphi, [this, callphi, callsite]() {
+            Definitions tmpDefs;
+            collectAllDefinitions(callsite, tmpDefs, /* escaping = */ true);
+            for (const auto &it : tmpDefs.definitions) {
+                for (const auto &it2 : it.second) {
+                    callphi->addDefUse(it2.second);
+                }
             }
-        }
-        callphi->addDefUse(tmpDefs.unknownWrites);
+            callphi->addDefUse(tmpDefs.unknownWrites);
+        });
     }
 }
 
@@ -669,6 +709,8 @@ void MemorySSATransformation::collectAllDefinitions(RWNode *from,
     } else {
         D = findDefinitionsInBlock(from);
     }
+    // we work with the maps of 'D' directly
+    D.expandScalars();
 
     ///
     // -- Get the definitions from predecessors in this subgraph --
@@ -717,8 +759,77 @@ MemorySSATransformation::findAllDefinitions(RWNode *from) {
     return std::vector<RWNode *>(values.begin(), values.end());
 }
 
+///
+// Check whether searching the definitions of 'use' may leave its subgraph
+// (the search may create phi nodes in callers or callees) -- 'calls' are
+// the calls of defined functions in the subgraph of 'use'.
+bool MemorySSATransformation::isIntraproceduralUse(
+        RWNode *use, const std::vector<RWNodeCall *> &calls) {
+    if (use->usesUnknown())
+        return false;
+
+    auto *subg = use->getBBlock()->getSubgraph();
+    for (const auto &ds : use->getUses()) {
+        // the search could reach the entry block and continue in callers
+        if (canBeInput(ds.target, subg))
+            return false;
+        // the search would continue in the callees
+        // (the summaries of callees are only read)
+        for (auto *C : calls) {
+            if (!isSummarized(C) && callMayDefineTarget(C, ds.target))
+                return false;
+        }
+    }
+    return true;
+}
+
+void MemorySSATransformation::computeIntraproceduralDefinitions(
+        unsigned threads) {
+    DBG_SECTION_BEGIN(dda, "Computing intraprocedural definitions using "
+                                   << threads << " threads");
+    std::vector<RWSubgraph *> subgraphs;
+    subgraphs.reserve(graph.size());
+    // computing modref searches also the callees, so do it beforehand
+    for (auto *subg : graph.subgraphs()) {
+        computeModRef(subg, getSubgraphInfo(subg));
+        subgraphs.push_back(subg);
+    }
+
+    ThreadPool workers(threads);
+    workers.parallelFor(subgraphs.size(), [this, &subgraphs](size_t i) {
+        auto *subg = subgraphs[i];
+        auto &si = getSubgraphInfo(subg);
+
+        std::vector<RWNodeCall *> calls;
+        for (auto *b : subg->bblocks()) {
+            auto &bi = si.getBBlockInfo(b);
+            if (bi.isCallBlock())
+                calls.push_back(bi.getCall());
+        }
+
+        for (auto *b : subg->bblocks()) {
+            for (auto *n : b->getNodes()) {
+                if (n->isUse() && !n->defuse.initialized() &&
+                    isIntraproceduralUse(n, calls)) {
+                    n->addDefUse(findDefinitions(n));
+                    assert(n->defuse.initialized());
+                }
+            }
+        }
+    });
+    DBG_SECTION_END(dda, "Computing intraprocedural definitions finished");
+}
+
 void MemorySSATransformation::computeAllDefinitions() {
     DBG_SECTION_BEGIN(dda, "Computing definitions for all uses (requested)");
+    // finish the searches postponed by the queries with a budget
+    completePendingPhis();
+
+    if (options.eagerThreads > 1) {
+        computeIntraproceduralDefinitions(options.eagerThreads);
+    }
+
+    // the rest of uses (all if we do not use threads)
     for (auto *subg : graph.subgraphs()) {
         for (auto *b : subg->bblocks()) {
             for (auto *n : b->getNodes()) {
@@ -740,12 +851,17 @@ void MemorySSATransformation::initialize() {
     // remove useless blocks and nodes
     graph.optimize();
 
+    if (options.scalarObjects) {
+        findScalars();
+    }
+
     // make sure we have a constant-time access to information
     _subgraphs_info.reserve(graph.size());
 
     for (auto *subg : graph.subgraphs()) {
         auto &si = _subgraphs_info[subg];
         si._bblock_infos.reserve(subg->size());
+        _bblocks_num += subg->size();
 
         // initialize information about basic blocks
         for (auto *bb : subg->bblocks()) {
@@ -760,11 +876,56 @@ void MemorySSATransformation::initialize() {
     }
 }
 
+///
+// Mark the memory that is always accessed as a whole (all accesses
+// have the same known size) and that is only overwritten as scalar.
+// Such memory cannot be accessed through a pointer, so only non-escaping
+// local variables are considered.
+void MemorySSATransformation::findScalars() {
+    // Offset::UNKNOWN if the memory is not scalar
+    auto &sizes = _scalar_sizes;
+    auto access = [&sizes](const DefSite &ds, bool whole) {
+        auto *target = ds.target;
+        if (!target->isAlloc() || target->canEscape())
+            return;
+        auto it = sizes.emplace(target, ds.len).first;
+        if (!whole || !ds.offset.isZero() || ds.len.isUnknown() ||
+            ds.len.isZero() || it->second != ds.len) {
+            it->second = Offset::UNKNOWN;
+        }
+    };
+
+    for (auto *subg : graph.subgraphs()) {
+        for (auto *bb : subg->bblocks()) {
+            for (auto *node : bb->getNodes()) {
+                for (const auto &ds : node->getDefines())
+                    access(ds, /* whole = */ false);
+                for (const auto &ds : node->getOverwrites())
+                    access(ds, /* whole = */ true);
+                for (const auto &ds : node->getUses())
+                    access(ds, /* whole = */ true);
+            }
+        }
+    }
+
+    for (auto &it : sizes) {
+        if (!it.second.isUnknown())
+            it.first->setScalar();
+    }
+}
+
 RWNode *MemorySSATransformation::insertUse(RWNode *where, RWNode *mem,
                                            const Offset &off,
                                            const Offset &len) {
+    // the new phi nodes for this use would overwrite the memory partially
+    if (mem->isScalar() && (!off.isZero() || len != _scalar_sizes.at(mem))) {
+        mem->setScalar(false);
+    }
+
     // DBG_SECTION_BEGIN(dda, "Adding MU node");
+    std::unique_lock<std::mutex> guard(_nodes_lock);
     auto &use = graph.create(RWNodeType::MU);
+    guard.unlock();
     use.addUse({mem, off, len});
     use.insertBefore(where);
     where->getBBlock()->insertBefore(&use, where);
@@ -773,67 +934,249 @@ RWNode *MemorySSATransformation::insertUse(RWNode *where, RWNode *mem,
     return &use;
 }
 
-static void recGatherNonPhisDefs(RWNode *phi,
-                                 dg::ADT::SparseBitvectorHashImpl &phis,
-                                 dg::ADT::SparseBitvectorHashImpl &ret,
-                                 bool intraproc = false) {
+///
+// State of the Tarjan's algorithm that finds SCCs of phi nodes
+// (with edges going from phi nodes to their phi operands).
+struct MemorySSATransformation::PhiSCCState {
+    struct Info {
+        unsigned dfs_id;
+        unsigned lowpt;
+        bool on_stack;
+    };
+
+    std::unordered_map<const RWNode *, Info> info;
+    std::vector<RWNode *> stack;
+    unsigned index{0};
+};
+
+void MemorySSATransformation::collapsePhis(RWNode *phi, PhiSCCState &state) {
     assert(phi->isPhi());
-    // set returns the previous value, so if its 'true',
-    // we already had the phi
-    if (phis.set(phi->getID()))
-        return; // we already visited this phi
+    // (references to elements of unordered_map survive rehashing)
+    auto &info = state.info[phi];
+    ++state.index;
+    info = {state.index, state.index, true};
+    state.stack.push_back(phi);
 
     for (auto *n : phi->defuse) {
-        if (!n->isPhi()) {
-            ret.set(n->getID());
-        } else {
-            if (intraproc && n->isInOut()) {
-                ret.set(n->getID());
+        if (!n->isPhi() || _nonphi_defs.count(n) > 0)
+            continue;
+        auto it = state.info.find(n);
+        if (it == state.info.end()) {
+            collapsePhis(n, state);
+            info.lowpt = std::min(info.lowpt, state.info[n].lowpt);
+        } else if (it->second.on_stack) {
+            info.lowpt = std::min(info.lowpt, it->second.dfs_id);
+        }
+    }
+
+    if (info.lowpt != info.dfs_id)
+        return;
+
+    // 'phi' is the root of an SCC, the SCCs reachable from this one
+    // are already collapsed (the reverse topological order of Tarjan's algo)
+    std::vector<RWNode *> component;
+    RWNode *w;
+    do {
+        w = state.stack.back();
+        state.stack.pop_back();
+        state.info[w].on_stack = false;
+        component.push_back(w);
+    } while (w != phi);
+
+    auto defs = std::make_shared<NonPhiDefsT>();
+    for (auto *c : component) {
+        for (auto *n : c->defuse) {
+            if (!n->isPhi()) {
+                assert(n->getID() > 0);
+                defs->push_back(n->getID());
             } else {
-                recGatherNonPhisDefs(n, phis, ret, intraproc);
+                auto it = _nonphi_defs.find(n);
+                if (it != _nonphi_defs.end())
+                    defs->insert(defs->end(), it->second->begin(),
+                                 it->second->end());
+                // else 'n' is in this component
             }
         }
     }
+    std::sort(defs->begin(), defs->end());
+    defs->erase(std::unique(defs->begin(), defs->end()), defs->end());
+
+    for (auto *c : component)
+        _nonphi_defs[c] = defs;
 }
 
-// recursivelu replace all phi values with its non-phi definitions
-template <typename ContT>
-std::vector<RWNode *> gatherNonPhisDefs(ReadWriteGraph *graph,
-                                        const ContT &nodes,
-                                        bool intraproc = false) {
-    dg::ADT::SparseBitvectorHashImpl ret; // use set to get rid of duplicates
-    dg::ADT::SparseBitvectorHashImpl
-            phis; // set of visited phi nodes - to check the fixpoint
+const MemorySSATransformation::NonPhiDefsT &
+MemorySSATransformation::getNonPhiDefs(RWNode *phi) {
+    if (_nonphi_defs_phis != _phis.size()) {
+        // new phi nodes were created since we filled the cache
+        _nonphi_defs.clear();
+        _nonphi_defs_phis = _phis.size();
+    }
+
+    auto it = _nonphi_defs.find(phi);
+    if (it != _nonphi_defs.end())
+        return *it->second;
+
+    PhiSCCState state;
+    collapsePhis(phi, state);
+    assert(state.stack.empty());
+    return *_nonphi_defs[phi];
+}
 
-    for (auto n : nodes) {
+// replace all phi values with its non-phi definitions
+std::vector<RWNode *> MemorySSATransformation::gatherNonPhisDefs(RWNode *use) {
+    std::vector<RWNode *> retval;
+    auto &defuse = use->defuse;
+    // the common case -- the use is defined by a single phi node
+    if (defuse.size() == 1 && (*defuse.begin())->isPhi()) {
+        const auto &defs = getNonPhiDefs(*defuse.begin());
+        retval.reserve(defs.size());
+        for (auto i : defs) {
+            retval.push_back(graph.getNode(i));
+        }
+        return retval;
+    }
+
+    dg::ADT::SparseBitvectorHashImpl ret; // use set to get rid of duplicates
+    for (auto *n : defuse) {
         if (!n->isPhi()) {
             assert(n->getID() > 0);
             ret.set(n->getID());
         } else {
-            if (intraproc && n->isInOut()) {
-                assert(n->getID() > 0);
-                ret.set(n->getID());
-            } else {
-                recGatherNonPhisDefs(n, phis, ret, intraproc);
-            }
+            for (auto i : getNonPhiDefs(n))
+                ret.set(i);
         }
     }
 
-    std::vector<RWNode *> retval;
     retval.reserve(ret.size());
     for (auto i : ret) {
-        retval.push_back(graph->getNode(i));
+        retval.push_back(graph.getNode(i));
     }
     return retval;
 }
 
-std::vector<RWNode *> MemorySSATransformation::getDefinitions(RWNode *use) {
+void MemorySSATransformation::releaseDefinitions(RWNode *use) {
+    assert(use->isUse() && "Releasing definitions of a non-use");
+    use->defuse.clear();
+}
+
+void MemorySSATransformation::releaseCachedDefinitions() {
+    decltype(_nonphi_defs)().swap(_nonphi_defs);
+}
+
+void MemorySSATransformation::completePendingPhi(RWNode *phi) {
+    auto it = _pending_phis.find(phi);
+    if (it == _pending_phis.end())
+        return;
+
+    DBG(dda, "Resuming the search for operands of phi " << phi->getID());
+    auto search = std::move(it->second);
+    _pending_phis.erase(it);
+    // the phi gets new operands, the cached definitions
+    // of phis that reach it are invalid
+    _nonphi_defs.clear();
+    if (_budget)
+        _budget->visit();
+    search();
+}
+
+void MemorySSATransformation::completePendingPhis() {
+    assert(!_budget);
+    while (!_pending_phis.empty()) {
+        completePendingPhi(_pending_phis.begin()->first);
+    }
+}
+
+// the phi nodes with postponed search that the definitions of 'use' depend on
+std::vector<RWNode *>
+MemorySSATransformation::getPendingPhis(RWNode *use) const {
+    std::vector<RWNode *> pending;
+    if (_pending_phis.empty())
+        return pending;
+
+    std::set<RWNode *> visited;
+    std::vector<RWNode *> stack(use->defuse.begin(), use->defuse.end());
+    while (!stack.empty()) {
+        auto *n = stack.back();
+        stack.pop_back();
+        if (!n->isPhi() || !visited.insert(n).second)
+            continue;
+        if (_pending_phis.count(n) > 0)
+            pending.push_back(n);
+        stack.insert(stack.end(), n->defuse.begin(), n->defuse.end());
+    }
+    return pending;
+}
+
+DefinitionsQueryResult
+MemorySSATransformation::getDefinitionsWithBudget(RWNode *use) {
     // on demand triggering finding the definitions
     if (!use->defuse.initialized()) {
         use->addDefUse(findDefinitions(use));
         assert(use->defuse.initialized());
     }
-    return gatherNonPhisDefs(getGraph(), use->defuse);
+
+    // finish the searches that the definitions depend on
+    // (they may have been postponed by this or previous queries)
+    auto pending = getPendingPhis(use);
+    while (!pending.empty()) {
+        if (_budget && _budget->exhausted()) {
+            break;
+        }
+        for (auto *phi : pending) {
+            completePendingPhi(phi);
+            if (_budget && _budget->exhausted()) {
+                break;
+            }
+        }
+        pending = getPendingPhis(use);
+    }
+
+    if (pending.empty()) {
+        return {gatherNonPhisDefs(use), true};
+    }
+
+    // the definitions found so far and the unknown memory
+    // that stands for the definitions that we did not search for
+    std::set<RWNode *> visited;
+    std::set<unsigned> defs;
+    std::vector<RWNode *> stack(use->defuse.begin(), use->defuse.end());
+    while (!stack.empty()) {
+        auto *n = stack.back();
+        stack.pop_back();
+        if (!n->isPhi()) {
+            defs.insert(n->getID());
+        } else if (visited.insert(n).second) {
+            stack.insert(stack.end(), n->defuse.begin(), n->defuse.end());
+        }
+    }
+
+    DefinitionsQueryResult result;
+    result.exact = false;
+    result.definitions.reserve(defs.size() + 1);
+    for (auto id : defs) {
+        result.definitions.push_back(graph.getNode(id));
+    }
+    result.definitions.push_back(UNKNOWN_MEMORY);
+    return result;
+}
+
+std::vector<RWNode *> MemorySSATransformation::getDefinitions(RWNode *use) {
+    assert(!_budget);
+    return getDefinitionsWithBudget(use).definitions;
+}
+
+DefinitionsQueryResult
+MemorySSATransformation::getDefinitions(RWNode *use,
+                                        const DefinitionsQueryBudget &budget) {
+    if (budget.unlimited())
+        return {getDefinitions(use), true};
+
+    QueryBudget qb(budget);
+    _budget = &qb;
+    auto result = getDefinitionsWithBudget(use);
+    _budget = nullptr;
+    return result;
 }
 
 // return the reaching definitions of ('mem', 'off', 'len')
@@ -845,12 +1188,26 @@ MemorySSATransformation::getDefinitions(RWNode *where, RWNode *mem,
     return getDefinitions(use);
 }
 
+DefinitionsQueryResult MemorySSATransformation::getDefinitions(
+        RWNode *where, RWNode *mem, const Offset &off, const Offset &len,
+        const DefinitionsQueryBudget &budget) {
+    auto *use = insertUse(where, mem, off, len);
+    return getDefinitions(use, budget);
+}
+
 void MemorySSATransformation::run() {
     DBG_SECTION_BEGIN(dda, "Initializing MemorySSA analysis");
 
     initialize();
 
-    // the rest is on-demand :)
+    if (options.summaries) {
+        computeSummaries();
+    }
+
+    if (options.eagerThreads > 0) {
+        computeAllDefinitions();
+    }
+    // otherwise the rest is on-demand :)
 
     DBG_SECTION_END(dda, "Initializing MemorySSA analysis finished");
 }
@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include "dg/MemorySSA/MemorySSA.h"
 #include "dg/util/debug.h"
 
@@ -10,28 +12,25 @@ static inline bool canBeOutput(const RWNode *node, RWSubgraph *subg) {
            (!node->getBBlock() || node->getBBlock()->getSubgraph() != subg);
 }
 
-template <typename MR, typename C>
-static void modRefAdd(MR &modref, const C &c, RWNode *node, RWSubgraph *subg) {
+template <typename C>
+static void modRefAddDefs(ModRefInfo &modref, const C &c, RWNode *node,
+                          RWSubgraph *subg) {
     assert(node && "Node the definion node");
     for (const DefSite &ds : c) {
         // can escape
         if (canBeOutput(ds.target, subg)) {
-            modref.add(ds, node);
+            modref.addMayDef(ds, node);
         }
     }
 }
 
-void MemorySSATransformation::computeModRef(RWSubgraph *subg,
-                                            SubgraphInfo &si) {
-    if (si.modref.isInitialized()) {
-        return;
-    }
-
-    DBG_SECTION_BEGIN(dda, "Computing modref for subgraph " << subg->getName());
-
-    // set it here due to recursive procedures
-    si.modref.setInitialized();
-
+///
+// Add the effects of the nodes from 'subg' to 'modref'. The effects
+// of calls of defined functions are taken from 'calleeModRef(callee)',
+// which may return nullptr if the callee should be skipped.
+template <typename SI, typename GetModRefT>
+static void addSubgraphModRef(ModRefInfo &modref, RWSubgraph *subg, SI &si,
+                              GetModRefT calleeModRef) {
     // iterate over the blocks (note: not over the infos, those
     // may not be created if the block was not used yet
     for (auto *b : subg->bblocks()) {
@@ -41,34 +40,74 @@ void MemorySSATransformation::computeModRef(RWSubgraph *subg,
             for (auto &callee : C->getCallees()) {
                 auto *csubg = callee.getSubgraph();
                 if (csubg) {
-                    auto &callsi = getSubgraphInfo(csubg);
-                    computeModRef(csubg, callsi);
-                    assert(callsi.modref.isInitialized());
-
-                    si.modref.add(callsi.modref);
+                    if (const auto *callmodref = calleeModRef(csubg)) {
+                        modref.add(*callmodref);
+                    }
                 } else {
                     // undefined function
-                    modRefAdd(si.modref.maydef,
-                              callee.getCalledValue()->getDefines(), C, csubg);
-                    modRefAdd(si.modref.maydef,
-                              callee.getCalledValue()->getOverwrites(), C,
-                              csubg);
-                    modRefAdd(si.modref.mayref,
-                              callee.getCalledValue()->getUses(), C, csubg);
+                    auto *cv = callee.getCalledValue();
+                    modRefAddDefs(modref, cv->getDefines(), C, csubg);
+                    modRefAddDefs(modref, cv->getOverwrites(), C, csubg);
                 }
             }
         } else {
             // do not perform LVN if not needed, just scan the nodes
             for (auto *node : b->getNodes()) {
-                modRefAdd(si.modref.maydef, node->getDefines(), node, subg);
-                modRefAdd(si.modref.maydef, node->getOverwrites(), node, subg);
-                modRefAdd(si.modref.mayref, node->getUses(), node, subg);
+                modRefAddDefs(modref, node->getDefines(), node, subg);
+                modRefAddDefs(modref, node->getOverwrites(), node, subg);
             }
         }
     }
+}
+
+void MemorySSATransformation::computeModRef(RWSubgraph *subg,
+                                            SubgraphInfo &si) {
+    if (si.modref.isInitialized()) {
+        return;
+    }
+
+    DBG_SECTION_BEGIN(dda, "Computing modref for subgraph " << subg->getName());
+
+    // set it here due to recursive procedures
+    si.modref.setInitialized();
+
+    addSubgraphModRef(si.modref, subg, si, [this](RWSubgraph *csubg) {
+        auto &callsi = getSubgraphInfo(csubg);
+        computeModRef(csubg, callsi);
+        assert(callsi.modref.isInitialized());
+        return &callsi.modref;
+    });
+
     DBG_SECTION_END(dda, "Computing modref for subgraph " << subg->getName()
                                                           << " done");
 }
 
+void MemorySSATransformation::computeModRef(
+        const std::vector<RWSubgraph *> &scc) {
+    // the procedures from the SCC may call each other,
+    // so they all have the same effects
+    ModRefInfo modref;
+    for (auto *subg : scc) {
+        addSubgraphModRef(
+                modref, subg, getSubgraphInfo(subg),
+                [this, &scc](RWSubgraph *csubg) -> const ModRefInfo * {
+                    if (std::find(scc.begin(), scc.end(), csubg) != scc.end())
+                        return nullptr;
+                    auto &callsi = getSubgraphInfo(csubg);
+                    assert(callsi.modref.isInitialized() &&
+                           "Callee was not processed before");
+                    return &callsi.modref;
+                });
+    }
+
+    for (auto *subg : scc) {
+        auto &si = getSubgraphInfo(subg);
+        if (si.modref.isInitialized())
+            continue; // computed on demand before
+        si.modref.add(modref);
+        si.modref.setInitialized();
+    }
+}
+
 } // namespace dda
 } // namespace dg
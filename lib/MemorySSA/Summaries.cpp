@@ -0,0 +1,187 @@
+#include <algorithm>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+#include "dg/MemorySSA/MemorySSA.h"
+#include "dg/util/ThreadPool.h"
+#include "dg/util/debug.h"
+
+namespace dg {
+namespace dda {
+
+// the defined procedures that 'C' may call
+template <typename F>
+static void forEachCalledSubgraph(RWNodeCall *C, F fun) {
+    for (auto &callee : C->getCallees()) {
+        if (auto *csubg = callee.getSubgraph())
+            fun(csubg);
+    }
+}
+
+bool MemorySSATransformation::isSummarized(RWNodeCall *C) {
+    bool ret = true;
+    forEachCalledSubgraph(C, [this, &ret](RWSubgraph *csubg) {
+        ret &= getSubgraphInfo(csubg).summarized;
+    });
+    return ret;
+}
+
+namespace {
+// Tarjan's algorithm for SCCs of the call graph
+struct CallGraphSCCs {
+    struct Info {
+        unsigned dfs_id;
+        unsigned lowpt;
+        bool on_stack;
+        // the index of the SCC
+        unsigned scc;
+    };
+
+    std::unordered_map<RWSubgraph *, Info> info;
+    std::vector<RWSubgraph *> stack;
+    unsigned index{0};
+    // SCCs in the reverse topological order (callees first)
+    std::vector<std::vector<RWSubgraph *>> sccs;
+};
+} // namespace
+
+std::vector<std::vector<std::vector<RWSubgraph *>>>
+MemorySSATransformation::getCallGraphLevels() {
+    std::unordered_map<RWSubgraph *, std::vector<RWSubgraph *>> callees;
+    for (auto *subg : graph.subgraphs()) {
+        auto &si = getSubgraphInfo(subg);
+        auto &cs = callees[subg];
+        for (auto *b : subg->bblocks()) {
+            auto &bi = si.getBBlockInfo(b);
+            if (!bi.isCallBlock())
+                continue;
+            forEachCalledSubgraph(bi.getCall(), [&cs](RWSubgraph *csubg) {
+                cs.push_back(csubg);
+            });
+        }
+    }
+
+    CallGraphSCCs state;
+    std::function<void(RWSubgraph *)> visit = [&](RWSubgraph *subg) {
+        // (references to elements of unordered_map survive rehashing)
+        auto &info = state.info[subg];
+        ++state.index;
+        info = {state.index, state.index, true, 0};
+        state.stack.push_back(subg);
+
+        for (auto *csubg : callees[subg]) {
+            auto it = state.info.find(csubg);
+            if (it == state.info.end()) {
+                visit(csubg);
+                info.lowpt = std::min(info.lowpt, state.info[csubg].lowpt);
+            } else if (it->second.on_stack) {
+                info.lowpt = std::min(info.lowpt, it->second.dfs_id);
+            }
+        }
+
+        if (info.lowpt != info.dfs_id)
+            return;
+
+        std::vector<RWSubgraph *> scc;
+        RWSubgraph *w;
+        do {
+            w = state.stack.back();
+            state.stack.pop_back();
+            auto &winfo = state.info[w];
+            winfo.on_stack = false;
+            winfo.scc = state.sccs.size();
+            scc.push_back(w);
+        } while (w != subg);
+        state.sccs.push_back(std::move(scc));
+    };
+
+    for (auto *subg : graph.subgraphs()) {
+        if (state.info.count(subg) == 0)
+            visit(subg);
+    }
+
+    // the level of an SCC is greater than the levels of SCCs that it calls
+    std::vector<unsigned> levels(state.sccs.size(), 0);
+    std::vector<std::vector<std::vector<RWSubgraph *>>> ret;
+    for (unsigned i = 0; i < state.sccs.size(); ++i) {
+        for (auto *subg : state.sccs[i]) {
+            for (auto *csubg : callees[subg]) {
+                auto cscc = state.info[csubg].scc;
+                if (cscc != i)
+                    levels[i] = std::max(levels[i], levels[cscc] + 1);
+            }
+        }
+
+        if (ret.size() <= levels[i])
+            ret.resize(levels[i] + 1);
+        ret[levels[i]].push_back(std::move(state.sccs[i]));
+    }
+
+    return ret;
+}
+
+///
+// Create output phi nodes for all the memory that the procedure
+// may define (that is not covered by outputs yet).
+void MemorySSATransformation::computeSummary(RWSubgraph *subg) {
+    DBG_SECTION_BEGIN(dda, "Computing summary of subgraph " << subg->getName());
+    auto &si = getSubgraphInfo(subg);
+    auto &summary = si.getSummary();
+    assert(si.modref.isInitialized());
+
+    std::vector<RWBBlock *> retblocks;
+    for (auto *b : subg->bblocks()) {
+        // ignore blocks that does not return to the caller
+        if (!b->hasSuccessors() && b->isReturnBBlock())
+            retblocks.push_back(b);
+    }
+
+    si.modref.forEachMayDef([&](const DefSite &ds) {
+        for (auto &interval : summary.getUncoveredOutputs(ds)) {
+            DefSite outds{ds.target, interval.start, interval.length()};
+            auto *phi = createPhi(outds, /* type = */ RWNodeType::OUTARG);
+            summary.addOutput(outds, phi);
+            for (auto *b : retblocks) {
+                phi->addDefUse(findDefinitions(b, outds));
+            }
+        }
+    });
+    DBG_SECTION_END(dda, "Computing summary of subgraph " << subg->getName()
+                                                          << " done");
+}
+
+void MemorySSATransformation::computeSummaries() {
+    const auto threads = std::max(1U, options.eagerThreads);
+    DBG_SECTION_BEGIN(dda, "Computing summaries of procedures using "
+                                   << threads << " threads");
+
+    auto levels = getCallGraphLevels();
+
+    _summarizing = true;
+    ThreadPool workers(threads);
+    for (auto &level : levels) {
+        // the SCCs from one level do not call each other
+        workers.parallelFor(level.size(), [this, &level](size_t i) {
+            auto &scc = level[i];
+            computeModRef(scc);
+            for (auto *subg : scc) {
+                computeSummary(subg);
+            }
+            // mark the SCC as summarized only when all its procedures
+            // have the summary, they may call each other
+            for (auto *subg : scc) {
+                getSubgraphInfo(subg).summarized = true;
+            }
+        });
+    }
+    _summarizing = false;
+
+    // search the callers for the definitions of inputs
+    completePendingPhis();
+
+    DBG_SECTION_END(dda, "Computing summaries of procedures finished");
+}
+
+} // namespace dda
+} // namespace dg
@@ -1,3 +1,7 @@
+#include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
+
 #include "dg/PointerAnalysis/PointerAnalysis.h"
 #include "dg/PointerAnalysis/Pointer.h"
 #include "dg/PointerAnalysis/PointsToSet.h"
@@ -38,10 +42,18 @@ bool PointerAnalysis::processLoad(PSNode *node) {
     if (operand->pointsTo.empty())
         return error(operand, "Load's operand has no points-to set");
 
+    // with difference propagation, we skip the pointers that were processed
+    // the last time, unless the memory they point to changed since then
+    DiffState *diff = getDiffState(node);
+    std::vector<std::pair<const MemoryObject *, unsigned>> read;
+
     for (const Pointer &ptr : operand->pointsTo) {
+        const bool seen = diff && diff->pointers.has(ptr);
+
         if (ptr.isUnknown()) {
             // load from unknown pointer yields unknown pointer
-            changed |= node->addPointsTo(UnknownPointer);
+            if (!seen)
+                changed |= node->addPointsTo(UnknownPointer);
             continue;
         }
 
@@ -51,7 +63,7 @@ bool PointerAnalysis::processLoad(PSNode *node) {
         // find memory objects holding relevant points-to
         // information
         std::vector<MemoryObject *> objects;
-        getMemoryObjects(node, ptr, objects);
+        accessMemoryObjects(node, ptr, objects, true /* read */);
 
         PSNodeAlloc *target = PSNodeAlloc::get(ptr.target);
         assert(target && "Target is not memory allocation");
@@ -59,6 +71,8 @@ bool PointerAnalysis::processLoad(PSNode *node) {
         // no objects found for this target? That is
         // load from unknown memory
         if (objects.empty()) {
+            if (seen)
+                continue;
             if (target->isZeroInitialized())
                 // if the memory is zero initialized, then everything
                 // is fine, we add nullptr
@@ -70,6 +84,12 @@ bool PointerAnalysis::processLoad(PSNode *node) {
         }
 
         for (MemoryObject *o : objects) {
+            if (diff) {
+                if (seen && diff->isUpToDate(o))
+                    continue;
+                read.emplace_back(o, o->version);
+            }
+
             // is the offset to the memory unknown?
             // In that case everything can be referenced,
             // so we need to copy the whole points-to
@@ -122,6 +142,61 @@ bool PointerAnalysis::processLoad(PSNode *node) {
         }
     }
 
+    if (diff) {
+        diff->pointers.add(operand->pointsTo);
+        for (const auto &it : read)
+            diff->versions[it.first] = it.second;
+    }
+
+    return changed;
+}
+
+// is every pointer from S also in R?
+static bool isSubset(const PointsToSetT &S, const PointsToSetT &R) {
+#ifdef SHARED_POINTS_TO_SETS
+    return S.isSubsetOf(R);
+#else
+    for (const Pointer &ptr : S) {
+        if (!R.has(ptr))
+            return false;
+    }
+    return true;
+#endif
+}
+
+bool PointerAnalysis::processStore(PSNode *node) {
+    bool changed = false;
+    const PointsToSetT &values = node->getOperand(0)->pointsTo;
+    const PointsToSetT &pointers = node->getOperand(1)->pointsTo;
+
+    // if no new values are stored, it is enough to store the values
+    // via the pointers that were not processed the last time
+    DiffState *diff = getDiffState(node);
+    const bool newValues = !diff || !isSubset(values, diff->values);
+
+    std::vector<MemoryObject *> objects;
+    for (const Pointer &ptr : pointers) {
+        assert(ptr.target && "Got nullptr as target");
+
+        if (!newValues && diff->pointers.has(ptr))
+            continue;
+
+        if (!canBeDereferenced(ptr))
+            continue;
+
+        objects.clear();
+        accessMemoryObjects(node, ptr, objects, false /* read */);
+        for (MemoryObject *o : objects) {
+            changed |= o->addPointsTo(ptr.offset, values);
+        }
+    }
+
+    if (diff) {
+        diff->pointers.add(pointers);
+        if (newValues)
+            diff->values.add(values);
+    }
+
     return changed;
 }
 
@@ -142,7 +217,7 @@ bool PointerAnalysis::processMemcpy(PSNode *node) {
             continue;
 
         srcObjects.clear();
-        getMemoryObjects(node, ptr, srcObjects);
+        accessMemoryObjects(node, ptr, srcObjects, true /* read */);
 
         if (srcObjects.empty()) {
             abort();
@@ -157,7 +232,7 @@ bool PointerAnalysis::processMemcpy(PSNode *node) {
                 continue;
 
             destObjects.clear();
-            getMemoryObjects(node, dptr, destObjects);
+            accessMemoryObjects(node, dptr, destObjects, false /* read */);
 
             if (destObjects.empty()) {
                 abort();
@@ -275,7 +350,12 @@ bool PointerAnalysis::processGep(PSNode *node) {
     PSNodeGep *gep = PSNodeGep::get(node);
     assert(gep && "Non-GEP given");
 
+    DiffState *diff = getDiffState(node);
     for (const Pointer &ptr : gep->getSource()->pointsTo) {
+        // the pointer was shifted the last time
+        if (diff && diff->pointers.has(ptr))
+            continue;
+
         Offset::type new_offset;
         if (ptr.offset.isUnknown() || gep->getOffset().isUnknown())
             // set it like this to avoid overflow when adding
@@ -293,12 +373,46 @@ bool PointerAnalysis::processGep(PSNode *node) {
             changed |= node->addPointsTo(ptr.target, Offset::UNKNOWN);
     }
 
+    if (diff)
+        diff->pointers.add(gep->getSource()->pointsTo);
+
     return changed;
 }
 
+void PointerAnalysis::accessMemoryObjects(PSNode *node, const Pointer &ptr,
+                                          std::vector<MemoryObject *> &objects,
+                                          bool read) {
+    const size_t num = objects.size();
+    getMemoryObjects(node, ptr, objects);
+    if (!scheduleByDependencies)
+        return;
+
+    for (size_t i = num; i < objects.size(); ++i) {
+        accessedObjects.emplace_back(objects[i], objects[i]->version);
+        if (read)
+            objectReaders[objects[i]].insert(node);
+    }
+}
+
+PointerAnalysis::DiffState *PointerAnalysis::getDiffState(const PSNode *node) {
+    // the states are allocated in iteration() (if we use difference
+    // propagation), so we can not get here with an ID that is too big
+    // unless difference propagation is off
+    if (node->getID() >= diffStates.size())
+        return nullptr;
+
+    auto &state = diffStates[node->getID()];
+    if (!state)
+        state.reset(new DiffState());
+    return state.get();
+}
+
 bool PointerAnalysis::processNode(PSNode *node) {
     bool changed = false;
-    std::vector<MemoryObject *> objects;
+
+    // the points-to set of this node is kept by its representative
+    if (PG->isMerged(node))
+        return false;
 
 #ifdef DEBUG_ENABLED
     size_t prev_size = node->pointsTo.size();
@@ -309,19 +423,7 @@ bool PointerAnalysis::processNode(PSNode *node) {
         changed |= processLoad(node);
         break;
     case PSNodeType::STORE:
-        for (const Pointer &ptr : node->getOperand(1)->pointsTo) {
-            assert(ptr.target && "Got nullptr as target");
-
-            if (!canBeDereferenced(ptr))
-                continue;
-
-            objects.clear();
-            getMemoryObjects(node, ptr, objects);
-            for (MemoryObject *o : objects) {
-                changed |= o->addPointsTo(ptr.offset,
-                                          node->getOperand(0)->pointsTo);
-            }
-        }
+        changed |= processStore(node);
         break;
     case PSNodeType::INVALIDATE_OBJECT:
     case PSNodeType::FREE:
@@ -389,6 +491,9 @@ bool PointerAnalysis::processNode(PSNode *node) {
 
                 if (ptr.isValid() && !ptr.isInvalidated()) {
                     functionPointerCall(node, ptr.target);
+                    graphChanged = true;
+                    if (topoOrder)
+                        newCallSites.push_back(node);
                 } else {
                     error(node, "Calling invalid pointer as a function!");
                     continue;
@@ -410,6 +515,9 @@ bool PointerAnalysis::processNode(PSNode *node) {
 
                 if (ptr.isValid() && !ptr.isInvalidated()) {
                     handleFork(node, ptr.target);
+                    graphChanged = true;
+                    if (topoOrder)
+                        newCallSites.push_back(node);
                 } else {
                     error(node, "Calling invalid pointer in fork!");
                     continue;
@@ -419,6 +527,9 @@ bool PointerAnalysis::processNode(PSNode *node) {
         break;
     case PSNodeType::JOIN:
         changed |= handleJoin(node);
+        graphChanged = true;
+        if (topoOrder)
+            newCallSites.push_back(node);
         break;
     case PSNodeType::MEMCPY:
         changed |= processMemcpy(node);
@@ -476,6 +587,196 @@ void PointerAnalysis::sanityCheck() {
 #endif // not NDEBUG
 }
 
+// Nodes of these types write only into their own points-to set
+// and read only points-to sets of their operands and memory objects
+// (that are written only by STORE and MEMCPY nodes). Moreover, they
+// only copy existing pointers, so they do not create new entries in
+// the global table of pointers (unlike GEP nodes).
+static bool writesOnlyOwnPointsTo(const PSNode *nd,
+                                  const PointerAnalysisOptions &options) {
+    switch (nd->getType()) {
+    case PSNodeType::LOAD:
+    case PSNodeType::CAST:
+    case PSNodeType::PHI:
+    case PSNodeType::RETURN:
+        return true;
+    case PSNodeType::CALL_RETURN:
+        return !options.invalidateNodes;
+    default:
+        return false;
+    }
+}
+
+// Nodes of these types do not change any points-to information
+static bool isNoopNode(const PSNode *nd) {
+    switch (nd->getType()) {
+    case PSNodeType::ALLOC:
+    case PSNodeType::FUNCTION:
+    case PSNodeType::CONSTANT:
+    case PSNodeType::CALL:
+    case PSNodeType::ENTRY:
+    case PSNodeType::NOOP:
+    case PSNodeType::FREE:
+    case PSNodeType::INVALIDATE_OBJECT:
+        return true;
+    default:
+        return false;
+    }
+}
+
+// minimal number of nodes that is processed by one task
+#define PARALLEL_MIN_CHUNK 16
+
+///
+// Process the nodes from to_process using the worker threads.
+// The sequence of nodes is split into segments of nodes that can be
+// processed in parallel (see writesOnlyOwnPointsTo() and isNoopNode()).
+// These are separated by the other nodes (stores, GEPs, calls, ...)
+// that are processed sequentially. Nodes in a segment are sorted into
+// levels such that if one of two nodes reads the points-to set
+// of the other, the node that comes first in to_process is in a lower level.
+// The levels are processed one after another, so every node reads
+// the same points-to sets as in the sequential iteration
+// and the results are identical.
+void PointerAnalysis::parallelIteration() {
+    assert(workers && "Do not have worker threads");
+    assert(changed.empty());
+
+    const size_t num = to_process.size();
+    std::vector<char> enq(num, 0);
+
+    auto process = [this, &enq](size_t idx) {
+        PSNode *cur = to_process[idx];
+        bool e = false;
+        e |= beforeProcessed(cur);
+        e |= processNode(cur);
+        e |= afterProcessed(cur);
+        enq[idx] = e;
+    };
+
+    // levels of the nodes in the current segment that write their
+    // points-to set
+    std::unordered_map<const PSNode *, unsigned> level;
+    std::vector<std::vector<size_t>> levels;
+
+    auto processSegment = [&]() {
+        for (const auto &lvl : levels) {
+            workers->parallelFor(
+                    lvl.size(), [&lvl, &process](size_t i) { process(lvl[i]); },
+                    PARALLEL_MIN_CHUNK);
+        }
+        levels.clear();
+        level.clear();
+    };
+
+    for (size_t idx = 0; idx < num; ++idx) {
+        PSNode *cur = to_process[idx];
+        const bool writes = writesOnlyOwnPointsTo(cur, options);
+        if (!writes && !isNoopNode(cur)) {
+            processSegment();
+            process(idx);
+            continue;
+        }
+
+        unsigned lvl = 0;
+        if (writes) {
+            // operands written earlier in this segment
+            for (PSNode *op : cur->getOperands()) {
+                auto it = level.find(op);
+                if (it != level.end())
+                    lvl = std::max(lvl, it->second + 1);
+            }
+            // users that read the old points-to set earlier in this segment
+            for (PSNode *user : cur->getUsers()) {
+                auto it = level.find(user);
+                if (it != level.end())
+                    lvl = std::max(lvl, it->second + 1);
+            }
+            level[cur] = lvl;
+        }
+
+        if (lvl >= levels.size())
+            levels.resize(lvl + 1);
+        levels[lvl].push_back(idx);
+    }
+    processSegment();
+
+    for (size_t idx = 0; idx < num; ++idx) {
+        if (enq[idx])
+            enqueue(to_process[idx]);
+    }
+}
+
+///
+// Process the nodes from the worklist in one pass over the topological
+// order. When a node changes, its users and the readers of the memory
+// objects that it changed are pushed into the worklist, so the nodes
+// that come later in the order are processed still in this iteration.
+void PointerAnalysis::dependenciesIteration() {
+    if (topoOrder->passDone())
+        topoOrder->nextPass();
+
+    while (!topoOrder->passDone()) {
+        PSNode *cur = topoOrder->pop();
+        if (cur->getType() == PSNodeType::JOIN &&
+            std::find(joinNodes.begin(), joinNodes.end(), cur) ==
+                    joinNodes.end())
+            joinNodes.push_back(cur);
+
+        accessedObjects.clear();
+        bool enq = false;
+        enq |= beforeProcessed(cur);
+        enq |= processNode(cur);
+        enq |= afterProcessed(cur);
+
+        if (enq) {
+            enqueue(cur);
+            for (PSNode *user : cur->getUsers())
+                topoOrder->push(user);
+        }
+
+        for (const auto &it : accessedObjects) {
+            if (it.first->version == it.second)
+                continue;
+            auto readers = objectReaders.find(it.first);
+            if (readers == objectReaders.end())
+                continue;
+            for (PSNode *reader : readers->second)
+                topoOrder->push(reader);
+        }
+    }
+
+    queuedChanged = changed.size();
+}
+
+void PointerAnalysis::queueDependencies() {
+    // put the new nodes into the order. The call sites got new
+    // successors and some nodes got new operands, so process again
+    // everything that is reachable from the call sites
+    if (!newCallSites.empty()) {
+        for (PSNode *callsite : newCallSites)
+            topoOrder->update(callsite);
+        topoOrder->getReachableNodes(newCallSites, to_process);
+        for (PSNode *nd : to_process)
+            topoOrder->push(nd);
+        to_process.clear();
+        newCallSites.clear();
+    }
+
+    // the nodes enqueued after the iteration (e.g., when collapsing
+    // cycles) got new operands
+    for (size_t i = queuedChanged; i < changed.size(); ++i)
+        topoOrder->push(changed[i]);
+
+    if (!changed.empty()) {
+        for (PSNode *join : joinNodes)
+            topoOrder->push(join);
+    }
+
+    queuedChanged = 0;
+    changed.clear();
+}
+
 static void setToEmpty(std::vector<PSNode *> &nodes) {
     for (auto *n : nodes) {
         if (n->getType() != PSNodeType::ALLOC &&
@@ -485,6 +786,230 @@ static void setToEmpty(std::vector<PSNode *> &nodes) {
     }
 }
 
+// Nodes of these types only gather the pointers from their operands,
+// so all nodes on a cycle of such nodes have the same points-to set
+static bool isCopyNode(const PSNode *nd) {
+    return nd->getType() == PSNodeType::PHI ||
+           nd->getType() == PSNodeType::CAST;
+}
+
+///
+// Find non-trivial strongly connected components of copy nodes
+// (connected by the operand -> user edges) reachable from 'start'.
+// This is the Tarjan's algorithm, just without recursion
+// as the components may be large.
+static std::vector<std::vector<PSNode *>>
+findCopyCycles(PSNode *start, const PointerGraph *PG) {
+    struct NodeInfo {
+        unsigned dfs_id;
+        unsigned lowpt;
+        bool on_stack;
+    };
+
+    std::unordered_map<PSNode *, NodeInfo> info;
+    std::vector<PSNode *> stack;
+    // nodes on the DFS path with the index of the next user to visit
+    std::vector<std::pair<PSNode *, size_t>> path;
+    std::vector<std::vector<PSNode *>> result;
+    unsigned index = 0;
+
+    auto visit = [&](PSNode *nd) {
+        ++index;
+        info[nd] = {index, index, true};
+        stack.push_back(nd);
+        path.emplace_back(nd, 0);
+    };
+
+    visit(start);
+    while (!path.empty()) {
+        PSNode *cur = path.back().first;
+        const auto &users = cur->getUsers();
+        if (path.back().second < users.size()) {
+            PSNode *succ = users[path.back().second++];
+            if (!isCopyNode(succ) || PG->isMerged(succ))
+                continue;
+
+            auto it = info.find(succ);
+            if (it == info.end())
+                visit(succ);
+            else if (it->second.on_stack)
+                info[cur].lowpt = std::min(info[cur].lowpt, it->second.dfs_id);
+            continue;
+        }
+
+        path.pop_back();
+        auto &curinfo = info[cur];
+        if (!path.empty()) {
+            auto &parent = info[path.back().first];
+            parent.lowpt = std::min(parent.lowpt, curinfo.lowpt);
+        }
+
+        if (curinfo.lowpt == curinfo.dfs_id) {
+            std::vector<PSNode *> component;
+            PSNode *w;
+            do {
+                w = stack.back();
+                stack.pop_back();
+                info[w].on_stack = false;
+                component.push_back(w);
+            } while (w != cur);
+
+            if (component.size() > 1)
+                result.push_back(std::move(component));
+        }
+    }
+
+    return result;
+}
+
+///
+// Merge the nodes of the strongly connected component of copy nodes
+// into one of the nodes (the representative). The representative
+// takes over the operands from outside of the component and all users
+// of the merged nodes. The merged nodes stay in the graph, but they have
+// only the representative as the operand and they are not processed
+// anymore.
+bool PointerAnalysis::collapseCycle(const std::vector<PSNode *> &scc) {
+    // The representative must be a PHI node as it may get more operands.
+    // If there is no PHI node, the cycle consists only of casts
+    // and no pointers can get into it, so there is nothing to do.
+    auto repit = std::find_if(scc.begin(), scc.end(), [](PSNode *nd) {
+        return nd->getType() == PSNodeType::PHI;
+    });
+    if (repit == scc.end())
+        return false;
+
+    PSNode *rep = *repit;
+    std::unordered_set<PSNode *> members(scc.begin(), scc.end());
+
+    std::vector<PSNode *> external;
+    for (PSNode *m : scc) {
+        for (PSNode *op : m->getOperands()) {
+            if (members.count(op) == 0 &&
+                std::find(external.begin(), external.end(), op) ==
+                        external.end())
+                external.push_back(op);
+        }
+    }
+
+    for (PSNode *m : scc) {
+        if (m == rep)
+            continue;
+
+        rep->addPointsTo(m->pointsTo);
+        m->pointsTo.clear();
+        // do not remove duplicate operands, it would break e.g. a store
+        // of a pointer to itself
+        m->replaceAllUsesWith(rep, false);
+    }
+
+    for (PSNode *m : scc)
+        m->removeAllOperands();
+    for (PSNode *op : external)
+        rep->addOperand(op);
+
+    for (PSNode *m : scc) {
+        if (m == rep)
+            continue;
+        m->addOperand(rep);
+        PG->setMerged(m, rep);
+    }
+
+    DBG(pta, "Collapsed a cycle of " << scc.size() << " nodes into node "
+                                     << rep->getID());
+
+    // the users of the merged nodes must see the whole points-to set
+    enqueue(rep);
+    for (PSNode *user : rep->getUsers()) {
+        if (!PG->isMerged(user))
+            enqueue(user);
+    }
+
+    return true;
+}
+
+///
+// Look for cycles of copy nodes among the nodes that changed in the last
+// iteration. The detection is lazy: we search for a cycle only when
+// a copy node has the same points-to set as its operand (which is what
+// happens on a cycle) and we do it at most once for every such edge.
+void PointerAnalysis::collapseCycles() {
+    const size_t num = changed.size();
+
+    if (graphChanged) {
+        fixMergedNodes();
+        graphChanged = false;
+    }
+
+    // collapsing cycles enqueues nodes, so do not use iterators
+    for (size_t i = 0; i < num; ++i) {
+        PSNode *cur = changed[i];
+        if (!isCopyNode(cur) || PG->isMerged(cur) || cur->pointsTo.empty())
+            continue;
+
+        for (PSNode *op : cur->getOperands()) {
+            if (op == cur || !isCopyNode(op) || PG->isMerged(op))
+                continue;
+
+            if (op->pointsTo.size() != cur->pointsTo.size() ||
+                !isSubset(op->pointsTo, cur->pointsTo))
+                continue;
+
+            const uint64_t edge =
+                    (static_cast<uint64_t>(op->getID()) << 32) | cur->getID();
+            if (!checkedCopyEdges.insert(edge).second)
+                continue;
+
+            bool collapsed = false;
+            for (const auto &scc : findCopyCycles(cur, PG))
+                collapsed |= collapseCycle(scc);
+            // the operands of 'cur' changed
+            if (collapsed)
+                break;
+        }
+    }
+
+    // the nodes may have been enqueued repeatedly
+    if (changed.size() > num) {
+        std::unordered_set<PSNode *> seen;
+        std::vector<PSNode *> tmp;
+        tmp.reserve(changed.size());
+        for (PSNode *nd : changed) {
+            if (seen.insert(nd).second)
+                tmp.push_back(nd);
+        }
+        changed.swap(tmp);
+    }
+}
+
+///
+// The analysis may add operands to the merged nodes or use the merged
+// nodes as operands of other nodes when changing the graph
+// (e.g., in functionPointerCall()). Move such edges to the representatives.
+void PointerAnalysis::fixMergedNodes() {
+    for (PSNode *m : PG->getMergedNodes()) {
+        PSNode *rep = PG->getRepresentative(m);
+        if (m->getOperandsNum() != 1 || m->getOperand(0) != rep) {
+            std::vector<PSNode *> ops = m->getOperands();
+            m->removeAllOperands();
+            for (PSNode *op : ops) {
+                op = PG->getRepresentative(op);
+                if (op != rep && !rep->hasOperand(op))
+                    rep->addOperand(op);
+            }
+            m->addOperand(rep);
+            enqueue(rep);
+        }
+
+        if (!m->getUsers().empty()) {
+            std::vector<PSNode *> users = m->getUsers();
+            m->replaceAllUsesWith(rep, false);
+            for (PSNode *user : users)
+                enqueue(user);
+        }
+    }
+}
+
 bool PointerAnalysis::run() {
     DBG_SECTION_BEGIN(pta, "Running pointer analysis");
 
@@ -493,6 +1018,17 @@ bool PointerAnalysis::run() {
     // check that the current state of pointer analysis makes sense
     sanityCheck();
 
+    if (options.solverThreads > 1 && canProcessInParallel()) {
+        DBG(pta, "Using " << options.solverThreads << " solver threads");
+        workers.reset(new ThreadPool(options.solverThreads));
+    }
+
+    propagateDifferences =
+            options.differencePropagation && canPropagateDifferences();
+    if (propagateDifferences) {
+        DBG(pta, "Using difference propagation");
+    }
+
     // process global nodes, these must reach fixpoint after one iteration
     DBG(pta, "Processing global nodes");
     queue_globals();
@@ -503,6 +1039,12 @@ bool PointerAnalysis::run() {
     to_process.clear();
     changed.clear();
 
+    if (options.topologicalScheduling) {
+        topoOrder.reset(new PointerGraphTopoOrder(PG));
+        topoOrder->compute(PG->getEntry()->getRoot());
+        scheduleByDependencies = !workers && canScheduleByDependencies();
+    }
+
     initialize_queue();
 
     // override the pre-set value
@@ -516,6 +1058,8 @@ bool PointerAnalysis::run() {
     do {
         if (options.maxIterations > 0 && n > options.maxIterations) {
             DBG(pta, "Reached the maximum number of iterations: " << n);
+            while (hasQueuedNodes())
+                to_process.push_back(topoOrder->pop());
             setToEmpty(to_process);
             to_process.clear();
             break;
@@ -529,11 +1073,25 @@ bool PointerAnalysis::run() {
         ++n;
 
         iteration();
+        if (options.collapseCycles)
+            collapseCycles();
         queue_changed();
-    } while (!to_process.empty());
+    } while (!to_process.empty() || hasQueuedNodes());
 
     DBG(pta, "Reached fixpoint after " << n << " iterations\n");
 
+    // join the worker threads
+    workers.reset();
+    diffStates.clear();
+    propagateDifferences = false;
+    checkedCopyEdges.clear();
+    topoOrder.reset();
+    newCallSites.clear();
+    scheduleByDependencies = false;
+    objectReaders.clear();
+    accessedObjects.clear();
+    joinNodes.clear();
+
     assert(to_process.empty());
     assert(changed.empty());
 
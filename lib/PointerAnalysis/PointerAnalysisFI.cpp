@@ -0,0 +1,153 @@
+#include <algorithm>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "dg/PointerAnalysis/PointerAnalysisFI.h"
+
+namespace dg {
+namespace pta {
+
+MemoryObject *PointerAnalysisFI::getObject(const Pointer &ptr) {
+    if (!ptr.isValid() || ptr.isInvalidated() || ptr.isUnknown())
+        return nullptr;
+
+    PSNode *n = getAllocation(ptr.target);
+    return n ? n->getData<MemoryObject>() : nullptr;
+}
+
+// the nodes that compute their points-to set only from their operands
+// and memory, so they can be cleared and computed again
+static bool isComputed(const PSNode *nd) {
+    switch (nd->getType()) {
+    case PSNodeType::LOAD:
+    case PSNodeType::GEP:
+    case PSNodeType::CAST:
+    case PSNodeType::PHI:
+    case PSNodeType::RETURN:
+    case PSNodeType::CALL_RETURN:
+        return true;
+    default:
+        return false;
+    }
+}
+
+void PointerAnalysisFI::invalidate(const std::set<PSNode *> &removed) {
+    auto pointsToRemoved = [&removed](const PointsToSetT &S) {
+        for (const auto &ptr : S) {
+            if (removed.count(ptr.target) > 0)
+                return true;
+        }
+        return false;
+    };
+
+    // the nodes that read the memory objects
+    std::unordered_map<const MemoryObject *, std::vector<PSNode *>> readers;
+    auto addReader = [&readers](PSNode *nd, PSNode *ptrs) {
+        for (const auto &ptr : ptrs->pointsTo) {
+            if (auto *mo = getObject(ptr))
+                readers[mo].push_back(nd);
+        }
+    };
+
+    for (const auto &nd : PG->getNodes()) {
+        if (!nd)
+            continue;
+        if (nd->getType() == PSNodeType::LOAD)
+            addReader(nd.get(), nd->getOperand(0));
+        else if (auto *M = PSNodeMemcpy::get(nd.get()))
+            addReader(M, M->getSource());
+    }
+
+    std::unordered_set<PSNode *> nodes;
+    std::unordered_set<MemoryObject *> objects;
+    std::vector<PSNode *> queue;
+
+    auto taintNode = [&nodes, &queue](PSNode *nd) {
+        if (nodes.insert(nd).second)
+            queue.push_back(nd);
+    };
+
+    auto taintObject = [&](MemoryObject *mo) {
+        if (!objects.insert(mo).second)
+            return;
+        auto it = readers.find(mo);
+        if (it != readers.end()) {
+            for (PSNode *rd : it->second)
+                taintNode(rd);
+        }
+    };
+
+    auto taintObjects = [&](PSNode *ptrs) {
+        for (const auto &ptr : ptrs->pointsTo) {
+            if (auto *mo = getObject(ptr))
+                taintObject(mo);
+        }
+    };
+
+    // start with the removed nodes and the nodes
+    // and objects that point to the removed nodes
+    for (PSNode *nd : removed)
+        taintNode(nd);
+    for (const auto &nd : PG->getNodes()) {
+        if (nd && pointsToRemoved(nd->pointsTo))
+            taintNode(nd.get());
+    }
+    for (const auto &mo : memory_objects) {
+        for (const auto &it : *mo) {
+            if (pointsToRemoved(it.second)) {
+                taintObject(mo.get());
+                break;
+            }
+        }
+    }
+
+    // the users of a tainted node may have got pointers from it
+    // and the memory written by a tainted node may contain such pointers
+    while (!queue.empty()) {
+        PSNode *cur = queue.back();
+        queue.pop_back();
+
+        if (cur->getType() == PSNodeType::STORE)
+            taintObjects(cur->getOperand(1));
+        else if (auto *M = PSNodeMemcpy::get(cur))
+            taintObjects(M->getDestination());
+
+        for (PSNode *user : cur->getUsers())
+            taintNode(user);
+    }
+
+    for (PSNode *nd : nodes) {
+        if (removed.count(nd) > 0)
+            continue;
+
+        if (isComputed(nd)) {
+            nd->pointsTo.clear();
+        } else if (nd->getType() == PSNodeType::CALL_FUNCPTR) {
+            // the resolved calls stay in the graph,
+            // just forget the removed functions
+            std::vector<PSNode *> targets;
+            for (const auto &ptr : nd->pointsTo) {
+                if (removed.count(ptr.target) > 0)
+                    targets.push_back(ptr.target);
+            }
+            for (PSNode *target : targets)
+                nd->pointsTo.removeAny(target);
+        }
+    }
+
+    for (MemoryObject *mo : objects)
+        mo->pointsTo.clear();
+
+    // the objects of the removed allocations are not needed anymore
+    memory_objects.erase(
+            std::remove_if(memory_objects.begin(), memory_objects.end(),
+                           [&removed](const std::unique_ptr<MemoryObject> &mo) {
+                               return removed.count(mo->node) > 0;
+                           }),
+            memory_objects.end());
+}
+
+} // namespace pta
+} // namespace dg
@@ -0,0 +1,153 @@
+#include <cassert>
+#include <vector>
+
+#include "dg/PointerAnalysis/PointerAnalysisPFS.h"
+
+namespace dg {
+namespace pta {
+
+// does the store strongly update some offset of the target?
+static bool isOverwritten(const PointsToSetT *overwritten, PSNode *target) {
+    if (!overwritten)
+        return false;
+
+    for (const auto &ptr : *overwritten) {
+        if (ptr.target == target)
+            return true;
+    }
+    return false;
+}
+
+PointerAnalysisPFS::SharedObject *
+PointerAnalysisPFS::createObject(PSNode *target, PSNode *owner,
+                                 const SharedObject *from) {
+    auto *obj = new SharedObject(target, owner);
+    if (from)
+        obj->pointsTo = from->pointsTo;
+    objects.emplace_back(obj);
+    return obj;
+}
+
+bool PointerAnalysisPFS::beforeProcessed(PSNode *n) {
+    if (n->getData<PersistentMemoryMapT>())
+        return false;
+
+    PersistentMemoryMapT *mm;
+    // on these nodes the memory map can change
+    if (needsMerge(n)) {
+        mm = new PersistentMemoryMapT();
+        maps.emplace_back(mm);
+    } else {
+        // this node can not change the memory map,
+        // so just use the map of the predecessor
+        PSNode *pred = n->getSinglePredecessor();
+        mm = pred->getData<PersistentMemoryMapT>();
+        assert(mm && "No memory map in the predecessor");
+    }
+
+    n->setData<PersistentMemoryMapT>(mm);
+    return true;
+}
+
+///
+// Merge the map 'from' into the map 'mm' of the node 'n'.
+// The objects that are not in 'mm' are shared, the objects
+// that 'n' owns are updated and for the rest 'n' gets its own copy.
+// If 'from' is the only source of the memory for 'n', we can
+// also replace a shared object with the (newer) one from 'from'.
+bool PointerAnalysisPFS::mergeMap(PSNode *n, PersistentMemoryMapT *mm,
+                                  const PersistentMemoryMapT *from,
+                                  unsigned sourcesNum,
+                                  PointsToSetT *overwritten) {
+    bool changed = false;
+    mm->forEachDifferent(*from, [&](PSNode *target, SharedObject *obj,
+                                    SharedObject *const *my) {
+        SharedObject *mine = my ? *my : nullptr;
+        if (mine && mine->owner == n) {
+            changed |= mergeObjects(target, mine, obj, overwritten);
+            return;
+        }
+
+        if (!isOverwritten(overwritten, target) &&
+            (!mine || sourcesNum == 1)) {
+            mm->set(target, obj);
+            changed = true;
+            return;
+        }
+
+        auto *copy = createObject(target, n, mine);
+        changed |= mergeObjects(target, copy, obj, overwritten);
+        mm->set(target, copy);
+    });
+
+    return changed;
+}
+
+bool PointerAnalysisPFS::afterProcessed(PSNode *n) {
+    // the node that does not need merge
+    // shares the map with its predecessor
+    if (!needsMerge(n))
+        return false;
+
+    PersistentMemoryMapT *mm = n->getData<PersistentMemoryMapT>();
+    assert(mm && "Do not have memory map");
+
+    // every store that stores to a memory allocated
+    // not in a loop is a strong update
+    PointsToSetT *overwritten = nullptr;
+    if (n->getType() == PSNodeType::STORE) {
+        if (!pointsToAllocationInLoop(n->getOperand(1)))
+            overwritten = &n->getOperand(1)->pointsTo;
+    }
+
+    // gather the maps that flow into this node, that is, the maps
+    // of predecessors, returns (in call-return nodes), callers
+    // (in entry nodes) and globals (in the root of the program)
+    std::vector<const PersistentMemoryMapT *> sources;
+    for (PSNode *p : n->predecessors())
+        sources.push_back(p->getData<PersistentMemoryMapT>());
+    if (auto *CR = PSNodeCallRet::get(n)) {
+        for (auto *p : CR->getReturns())
+            sources.push_back(p->getData<PersistentMemoryMapT>());
+    }
+    if (auto *E = PSNodeEntry::get(n)) {
+        for (auto *p : E->getCallers())
+            sources.push_back(p->getData<PersistentMemoryMapT>());
+    }
+    if (n == PG->getEntry()->getRoot()) {
+        for (const auto &glob : PG->getGlobals())
+            sources.push_back(glob->getData<PersistentMemoryMapT>());
+    }
+
+    bool changed = false;
+    for (const auto *pm : sources) {
+        // merge pm to mm (but only if pm was already created)
+        if (pm && pm != mm)
+            changed |= mergeMap(n, mm, pm, sources.size(), overwritten);
+    }
+
+    return changed;
+}
+
+void PointerAnalysisPFS::getMemoryObjects(
+        PSNode *where, const Pointer &pointer,
+        std::vector<MemoryObject *> &objects) {
+    PersistentMemoryMapT *mm = where->getData<PersistentMemoryMapT>();
+    assert(mm && "Node does not have memory map");
+
+    SharedObject *const *found = mm->find(pointer.target);
+    SharedObject *obj = found ? *found : nullptr;
+
+    // the nodes that write to memory must have their own copy
+    // of the object, so that the write has something to write to
+    if (canChangeMM(where) && (!obj || obj->owner != where)) {
+        obj = createObject(pointer.target, where, obj);
+        mm->set(pointer.target, obj);
+    }
+
+    if (obj)
+        objects.push_back(obj);
+}
+
+} // namespace pta
+} // namespace dg
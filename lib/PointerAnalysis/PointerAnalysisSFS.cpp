@@ -0,0 +1,376 @@
+#include <algorithm>
+#include <cassert>
+#include <unordered_map>
+#include <vector>
+
+#include "dg/PointerAnalysis/PointerAnalysis.h"
+#include "dg/PointerAnalysis/PointerAnalysisFI.h"
+#include "dg/PointerAnalysis/PointerAnalysisSFS.h"
+
+#include "dg/util/debug.h"
+
+namespace dg {
+namespace pta {
+
+///
+// The flow-insensitive pre-analysis. The changes of the graph
+// (calls via function pointers, threads) are made by the main analysis,
+// so that the backend (e.g., the LLVM graph builder) gets the callbacks.
+// We also remember the points-to sets of nodes that are created
+// or initialized by these callbacks, so that we can restore them
+// before running the flow-sensitive analysis.
+class PointerAnalysisSFS::PreAnalysis : public PointerAnalysisFI {
+    PointerAnalysisSFS *SFS;
+
+  public:
+    PreAnalysis(PointerAnalysisSFS *sfs, const PointerAnalysisOptions &opts)
+            : PointerAnalysisFI(sfs->getPG(), opts), SFS(sfs) {}
+
+    bool functionPointerCall(PSNode *callsite, PSNode *called) override {
+        const auto nodesNum = getPG()->getNodes().size();
+        PSNode *ret = callsite->getPairedNode();
+        const PointsToSetT retPointsTo = ret ? ret->pointsTo : PointsToSetT();
+
+        bool changed = SFS->functionPointerCall(callsite, called);
+
+        // the callback may have set the returned value directly
+        // (e.g., unknown pointer for undefined functions)
+        if (ret && ret->pointsTo.size() != retPointsTo.size()) {
+            PointsToSetT added;
+            for (const auto &ptr : ret->pointsTo) {
+                if (!retPointsTo.has(ptr))
+                    added.add(ptr);
+            }
+            SFS->initialPointsTo.emplace_back(ret, std::move(added));
+        }
+
+        SFS->rememberPointsTo(nodesNum);
+        return changed;
+    }
+
+    bool handleFork(PSNode *forkNode, PSNode *called) override {
+        const auto nodesNum = getPG()->getNodes().size();
+        bool changed = SFS->handleFork(forkNode, called);
+        SFS->rememberPointsTo(nodesNum);
+        return changed;
+    }
+
+    bool handleJoin(PSNode *joinNode) override {
+        const auto nodesNum = getPG()->getNodes().size();
+        bool changed = SFS->handleJoin(joinNode);
+        SFS->rememberPointsTo(nodesNum);
+        return changed;
+    }
+};
+
+// the flow-sensitive analysis merges the memory from CFG predecessors,
+// from callers (in entry nodes) and from returns (in call-return nodes)
+template <typename FunT>
+static void foreachMemorySuccessor(PSNode *n, FunT fun) {
+    for (PSNode *s : n->successors())
+        fun(s);
+
+    if (PSNodeCall *C = PSNodeCall::get(n)) {
+        for (auto *subg : C->getCallees())
+            fun(subg->root);
+    } else if (PSNodeRet *R = PSNodeRet::get(n)) {
+        for (PSNode *ret : R->getReturnSites())
+            fun(ret);
+    }
+}
+
+static inline bool accessesMemory(const Pointer &ptr) {
+    if (!ptr.isValid() || ptr.isInvalidated() || ptr.isUnknown())
+        return false;
+
+    return ptr.target->getType() != PSNodeType::FUNCTION;
+}
+
+// add the targets of pointers from 'S' that may be dereferenced to 'targets'
+static void addTargets(const PointsToSetT &S, std::vector<PSNode *> &targets) {
+    for (const auto &ptr : S) {
+        if (accessesMemory(ptr))
+            targets.push_back(ptr.target);
+    }
+}
+
+void PointerAnalysisSFS::rememberPointsTo(size_t fromID) {
+    const auto &nodes = PG->getNodes();
+    for (size_t i = fromID; i < nodes.size(); ++i) {
+        PSNode *nd = nodes[i].get();
+        if (nd && !nd->pointsTo.empty())
+            initialPointsTo.emplace_back(nd, nd->pointsTo);
+    }
+}
+
+PointerAnalysisSFS::NodeInfo *
+PointerAnalysisSFS::getOrCreateNodeInfo(const PSNode *n) {
+    if (infos.size() <= n->getID())
+        infos.resize(n->getID() + 1);
+
+    auto &info = infos[n->getID()];
+    if (!info)
+        info.reset(new NodeInfo());
+    return info.get();
+}
+
+MemoryObject *PointerAnalysisSFS::getState(PSNode *def, PSNode *target) {
+    NodeInfo *info = getNodeInfo(def);
+    assert(info && info->isDef && "The node is not a definition");
+    auto it = info->defined.find(target);
+    if (it == info->defined.end())
+        return nullptr;
+    return it->second.get();
+}
+
+void PointerAnalysisSFS::preprocess() {
+    DBG_SECTION_BEGIN(pta, "Running flow-insensitive pre-analysis");
+
+    infos.clear();
+    initialPointsTo.clear();
+    rememberPointsTo(0);
+
+    {
+        PreAnalysis FI(this, options);
+        FI.run();
+
+        // the call graph is complete now
+        PG->computeLoops();
+        buildDefUseChains();
+
+        // the memory objects of FI are deleted with FI
+        resetState();
+    }
+
+    DBG_SECTION_END(pta, "Finished the pre-analysis, "
+                                 << getDefinitionsNum() << " definitions, "
+                                 << getDefUseEdgesNum() << " def-use edges");
+}
+
+///
+// For every memory object, find the definitions of the object
+// that reach the nodes that read or define the object.
+// A definition reaches a node if there is a path from the definition
+// to the node that does not go through another definition of the object.
+void PointerAnalysisSFS::buildDefUseChains() {
+    std::unordered_map<PSNode *, std::vector<PSNode *>> defs;
+    std::unordered_map<PSNode *, std::vector<PSNode *>> uses;
+    std::vector<PSNode *> targets;
+
+    auto sortUnique = [](std::vector<PSNode *> &V) {
+        std::sort(V.begin(), V.end());
+        V.erase(std::unique(V.begin(), V.end()), V.end());
+    };
+
+    for (const auto &nd : PG->getNodes()) {
+        if (!nd || PG->isMerged(nd.get()))
+            continue;
+
+        targets.clear();
+        bool isDef = false;
+        switch (nd->getType()) {
+        case PSNodeType::STORE:
+            addTargets(nd->getOperand(1)->pointsTo, targets);
+            isDef = true;
+            break;
+        case PSNodeType::MEMCPY:
+            // memcpy reads and writes its own state (as in FS analysis)
+            addTargets(PSNodeMemcpy::get(nd.get())->getSource()->pointsTo,
+                       targets);
+            addTargets(PSNodeMemcpy::get(nd.get())->getDestination()->pointsTo,
+                       targets);
+            isDef = true;
+            break;
+        case PSNodeType::LOAD:
+            addTargets(nd->getOperand(0)->pointsTo, targets);
+            break;
+        default:
+            continue;
+        }
+
+        NodeInfo *info = getOrCreateNodeInfo(nd.get());
+        info->isDef = isDef;
+        sortUnique(targets);
+        for (PSNode *target : targets) {
+            (isDef ? defs : uses)[target].push_back(nd.get());
+            // create the entries, so that the node will be
+            // processed when searching def-use chains
+            info->reaching[target];
+            if (isDef)
+                info->defined[target];
+        }
+    }
+
+    const auto &nodes = PG->getNodes();
+    std::vector<unsigned> isGlobal(nodes.size(), 0);
+    for (PSNode *g : PG->getGlobals())
+        isGlobal[g->getID()] = 1;
+
+    PSNode *root = PG->getEntry()->getRoot();
+    std::vector<unsigned> visited(nodes.size(), 0);
+    unsigned visitNum = 0;
+    std::vector<PSNode *> stack;
+
+    for (auto &it : defs) {
+        PSNode *target = it.first;
+        for (PSNode *def : it.second) {
+            ++visitNum;
+            assert(stack.empty());
+
+            auto push = [&](PSNode *n) {
+                if (visited[n->getID()] == visitNum)
+                    return;
+                visited[n->getID()] = visitNum;
+                stack.push_back(n);
+            };
+
+            // the memory state of globals flows into the entry procedure
+            if (isGlobal[def->getID()])
+                push(root);
+            else
+                foreachMemorySuccessor(def, push);
+
+            while (!stack.empty()) {
+                PSNode *cur = stack.back();
+                stack.pop_back();
+
+                NodeInfo *info = getNodeInfo(cur);
+                if (info) {
+                    auto rit = info->reaching.find(target);
+                    if (rit != info->reaching.end()) {
+                        rit->second.push_back(def);
+                        // the definition is killed
+                        // by another definition
+                        if (info->isDef)
+                            continue;
+                    }
+                }
+
+                foreachMemorySuccessor(cur, push);
+            }
+        }
+    }
+
+    // we do not need the entries for objects that no definition reaches
+    // in the nodes that only read them
+    for (auto &info : infos) {
+        if (!info || info->isDef)
+            continue;
+        for (auto it = info->reaching.begin(); it != info->reaching.end();) {
+            if (it->second.empty())
+                it = info->reaching.erase(it);
+            else
+                ++it;
+        }
+    }
+}
+
+///
+// Restore the state of nodes from before the pre-analysis,
+// but keep the graph (and the called functions) as built by it.
+void PointerAnalysisSFS::resetState() {
+    for (const auto &nd : PG->getNodes()) {
+        if (!nd)
+            continue;
+
+        nd->setData<MemoryObject>(nullptr);
+
+        switch (nd->getType()) {
+        case PSNodeType::CALL_FUNCPTR:
+        case PSNodeType::FORK:
+        case PSNodeType::JOIN:
+            // the called functions are already in the graph
+            break;
+        default:
+            nd->pointsTo.clear();
+        }
+    }
+
+    for (auto &it : initialPointsTo) {
+        it.first->addPointsTo(it.second);
+    }
+    initialPointsTo.clear();
+}
+
+bool PointerAnalysisSFS::afterProcessed(PSNode *n) {
+    NodeInfo *info = getNodeInfo(n);
+    if (!info || !info->isDef)
+        return false;
+
+    // every store that stores to a memory allocated
+    // not in a loop is a strong update
+    PointsToSetT *overwritten = nullptr;
+    if (n->getType() == PSNodeType::STORE) {
+        if (!pointsToAllocationInLoop(n->getOperand(1)))
+            overwritten = &n->getOperand(1)->pointsTo;
+    }
+
+    bool changed = false;
+    for (auto &it : info->defined) {
+        PSNode *target = it.first;
+        auto rit = info->reaching.find(target);
+        if (rit == info->reaching.end())
+            continue;
+
+        for (PSNode *def : rit->second) {
+            MemoryObject *from = getState(def, target);
+            if (!from)
+                continue;
+
+            if (!it.second)
+                it.second.reset(new MemoryObject(target));
+            changed |= mergeObjects(target, it.second.get(), from, overwritten);
+        }
+    }
+
+    return changed;
+}
+
+void PointerAnalysisSFS::getMemoryObjects(
+        PSNode *where, const Pointer &pointer,
+        std::vector<MemoryObject *> &objects) {
+    NodeInfo *info = getNodeInfo(where);
+    if (!info)
+        return;
+
+    // the nodes that write to memory have their own state
+    if (info->isDef) {
+        auto &mo = info->defined[pointer.target];
+        if (!mo)
+            mo.reset(new MemoryObject(pointer.target));
+        objects.push_back(mo.get());
+        return;
+    }
+
+    auto it = info->reaching.find(pointer.target);
+    if (it == info->reaching.end())
+        return;
+
+    for (PSNode *def : it->second) {
+        if (MemoryObject *mo = getState(def, pointer.target))
+            objects.push_back(mo);
+    }
+}
+
+size_t PointerAnalysisSFS::getDefinitionsNum() const {
+    size_t num = 0;
+    for (const auto &info : infos) {
+        if (info)
+            num += info->defined.size();
+    }
+    return num;
+}
+
+size_t PointerAnalysisSFS::getDefUseEdgesNum() const {
+    size_t num = 0;
+    for (const auto &info : infos) {
+        if (!info)
+            continue;
+        for (const auto &it : info->reaching)
+            num += it.second.size();
+    }
+    return num;
+}
+
+} // namespace pta
+} // namespace dg
@@ -42,6 +42,18 @@ void PointerGraph::remove(PSNode *nd) {
     nodes[nd->getID()].reset();
 }
 
+void PointerGraph::setMerged(PSNode *nd, PSNode *rep) {
+    assert(nd != rep && "Merging a node into itself");
+    assert(!isMerged(nd) && "The node is already merged");
+    assert(!isMerged(rep) && "The representative is merged");
+
+    if (_representatives.size() <= nd->getID())
+        _representatives.resize(nodes.size());
+
+    _representatives[nd->getID()] = rep;
+    _merged.push_back(nd);
+}
+
 void PointerGraph::initStaticNodes() {
     NULLPTR->pointsTo.clear();
     UNKNOWN_MEMORY->pointsTo.clear();
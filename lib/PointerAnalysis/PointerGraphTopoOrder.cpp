@@ -0,0 +1,181 @@
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <unordered_map>
+
+#include "dg/PointerAnalysis/PointerGraphTopoOrder.h"
+#include "dg/util/debug.h"
+
+namespace dg {
+namespace pta {
+
+///
+// Tarjan's algorithm (without recursion) on the nodes without a position.
+// It finds the strongly connected components in the reverse topological
+// order, so we just reverse the result.
+std::vector<PSNode *> PointerGraphTopoOrder::computeOrder(PSNode *start) {
+    struct NodeInfo {
+        unsigned dfs_id;
+        unsigned lowpt;
+        bool on_stack;
+    };
+
+    struct Frame {
+        PSNode *node;
+        std::vector<PSNode *> succs;
+        size_t next{0};
+
+        Frame(PSNode *n) : node(n) {
+            foreachPSSuccessor(n, true /* interproc */,
+                               [this](PSNode *s) { succs.push_back(s); });
+        }
+    };
+
+    std::unordered_map<PSNode *, NodeInfo> info;
+    std::vector<PSNode *> stack;
+    std::vector<Frame> path;
+    std::vector<std::vector<PSNode *>> components;
+    unsigned index = 0;
+
+    auto visit = [&](PSNode *nd) {
+        ++index;
+        info[nd] = {index, index, true};
+        stack.push_back(nd);
+        path.emplace_back(nd);
+    };
+
+    visit(start);
+    while (!path.empty()) {
+        auto &frame = path.back();
+        PSNode *cur = frame.node;
+        if (frame.next < frame.succs.size()) {
+            PSNode *succ = frame.succs[frame.next++];
+            if (hasPosition(succ))
+                continue;
+
+            auto it = info.find(succ);
+            if (it == info.end())
+                visit(succ);
+            else if (it->second.on_stack)
+                info[cur].lowpt = std::min(info[cur].lowpt, it->second.dfs_id);
+            continue;
+        }
+
+        path.pop_back();
+        auto &curinfo = info[cur];
+        if (!path.empty()) {
+            auto &parent = info[path.back().node];
+            parent.lowpt = std::min(parent.lowpt, curinfo.lowpt);
+        }
+
+        if (curinfo.lowpt == curinfo.dfs_id) {
+            components.emplace_back();
+            PSNode *w;
+            do {
+                w = stack.back();
+                stack.pop_back();
+                info[w].on_stack = false;
+                components.back().push_back(w);
+            } while (w != cur);
+        }
+    }
+
+    std::vector<PSNode *> order;
+    order.reserve(info.size());
+    for (auto it = components.rbegin(), et = components.rend(); it != et;
+         ++it) {
+        // the nodes were popped from the stack,
+        // so they are in the reverse order of discovery
+        order.insert(order.end(), it->rbegin(), it->rend());
+    }
+
+    return order;
+}
+
+void PointerGraphTopoOrder::renumber(size_t from) {
+    for (size_t i = from; i < _order.size(); ++i)
+        _pos[_order[i]->getID()] = i + 1;
+}
+
+void PointerGraphTopoOrder::compute(PSNode *root) {
+    DBG_SECTION_BEGIN(pta, "Computing topological order of the graph");
+
+    _order.clear();
+    _pos.clear();
+    _pos.resize(PG->getNodes().size(), 0);
+
+    _order = computeOrder(root);
+    renumber(0);
+
+    DBG_SECTION_END(pta, "Computed the order of " << _order.size()
+                                                  << " nodes");
+}
+
+void PointerGraphTopoOrder::update(PSNode *from) {
+    if (!hasPosition(from))
+        return;
+
+    if (_pos.size() < PG->getNodes().size())
+        _pos.resize(PG->getNodes().size(), 0);
+
+    std::vector<PSNode *> newNodes;
+    foreachPSSuccessor(from, true /* interproc */, [&](PSNode *s) {
+        if (hasPosition(s))
+            return;
+
+        auto order = computeOrder(s);
+        // mark the nodes as having a position,
+        // the real positions are assigned below
+        for (PSNode *nd : order)
+            _pos[nd->getID()] = std::numeric_limits<unsigned>::max();
+        newNodes.insert(newNodes.end(), order.begin(), order.end());
+    });
+
+    if (newNodes.empty())
+        return;
+
+    DBG(pta, "Inserting " << newNodes.size() << " nodes into the order after "
+                          << from->getID());
+
+    const size_t idx = _pos[from->getID()];
+    _order.insert(_order.begin() + idx, newNodes.begin(), newNodes.end());
+    renumber(idx);
+}
+
+void PointerGraphTopoOrder::getReachableNodes(
+        const std::vector<PSNode *> &start, std::vector<PSNode *> &nodes) {
+    if (_mark.size() < PG->getNodes().size())
+        _mark.resize(PG->getNodes().size(), 0);
+    ++_markNum;
+
+    nodes.clear();
+    assert(_stack.empty());
+
+    for (PSNode *nd : start) {
+        if (_mark[nd->getID()] == _markNum)
+            continue;
+        _mark[nd->getID()] = _markNum;
+        _stack.push_back(nd);
+    }
+
+    while (!_stack.empty()) {
+        PSNode *cur = _stack.back();
+        _stack.pop_back();
+        nodes.push_back(cur);
+
+        foreachPSSuccessor(cur, true /* interproc */, [this](PSNode *s) {
+            if (_mark[s->getID()] == _markNum)
+                return;
+            _mark[s->getID()] = _markNum;
+            _stack.push_back(s);
+        });
+    }
+
+    std::sort(nodes.begin(), nodes.end(),
+              [this](const PSNode *a, const PSNode *b) {
+                  return getPosition(a) < getPosition(b);
+              });
+}
+
+} // namespace pta
+} // namespace dg
@@ -15,7 +15,11 @@ std::vector<PSNode *> SmallOffsetsPointsToSet::idVector;
 std::vector<PSNode *> AlignedSmallOffsetsPointsToSet::idVector;
 std::vector<Pointer> AlignedPointerIdPointsToSet::idVector;
 std::map<PSNode *, size_t> SeparateOffsetsPointsToSet::ids;
-dg::PointerIDLookupTable PointerIdPointsToSet::lookupTable;
+template <>
+dg::PointerIDLookupTable PointerIdPointsToSet::lookupTable{};
+template <>
+dg::PointerIDLookupTable BlockPointerIdPointsToSet::lookupTable{};
+dg::PointerIDLookupTable SharedPointerIdPointsToSet::lookupTable;
 std::map<PSNode *, size_t> SmallOffsetsPointsToSet::ids;
 std::map<PSNode *, size_t> AlignedSmallOffsetsPointsToSet::ids;
 std::map<Pointer, size_t> AlignedPointerIdPointsToSet::ids;
@@ -1,7 +1,6 @@
 #include <set>
 #include <vector>
 
-#include "dg/BBlocksBuilder.h"
 #include "dg/ReadWriteGraph/ReadWriteGraph.h"
 
 namespace dg {
@@ -69,37 +68,11 @@ void RWNodeCall::addCallee(RWSubgraph *s) {
 
 void ReadWriteGraph::removeUselessNodes() {}
 
-void RWSubgraph::buildBBlocks(bool /*dce*/) {
-    assert(getRoot() && "No root node");
-    DBG(dda, "Building basic blocks");
-
-    BBlocksBuilder<RWBBlock> builder;
-    _bblocks = std::move(builder.buildAndGetBlocks(getRoot()));
-
-    assert(getRoot()->getBBlock() && "Root node has no BBlock");
-
-    // should we eliminate dead code?
-    // The dead code are the nodes that have no basic block assigned
-    // (follows from the DFS nature of the block builder algorithm)
-    /*
-    if (!dce)
-        return;
-
-    for (auto& nd : _nodes) {
-        if (nd->getBBlock() == nullptr) {
-            nd->isolate();
-            nd.reset();
-        }
-    }
-    */
-}
-
 // split the block on the first call and return the
 // block containing the rest of the instructions
 // (or nullptr if there's nothing else to do)
-static RWBBlock *
-splitBlockOnFirstCall(RWBBlock *block,
-                      std::vector<std::unique_ptr<RWBBlock>> &newblocks) {
+RWBBlock *RWSubgraph::splitBlockOnFirstCall(RWBBlock *block,
+                                            BBlocksVecT &newblocks) {
     for (auto *node : block->getNodes()) {
         if (auto *call = RWNodeCall::get(node)) {
             if (call->callsOneUndefined()) {
@@ -108,12 +81,13 @@ splitBlockOnFirstCall(RWBBlock *block,
                 continue;
             }
             DBG(dda, "Splitting basic block around " << node->getID());
-            auto blks = block->splitAround(node);
+            auto blks =
+                    block->splitAround(node, [this]() { return newBBlock(); });
             if (blks.first)
-                newblocks.push_back(std::move(blks.first));
+                newblocks.push_back(blks.first);
             if (blks.second) {
-                newblocks.push_back(std::move(blks.second));
-                return newblocks.back().get();
+                newblocks.push_back(blks.second);
+                return blks.second;
             }
             return nullptr;
         }
@@ -129,23 +103,21 @@ void RWSubgraph::splitBBlocksOnCalls() {
     }
 
 #ifndef NDEBUG
-    auto *entry = _bblocks[0].get();
+    auto *entry = _bblocks[0];
 #endif
 
-    std::vector<std::unique_ptr<RWBBlock>> newblocks;
+    BBlocksVecT newblocks;
 
-    for (auto &bblock : _bblocks) {
-        auto *cur = bblock.get();
+    for (auto *bblock : _bblocks) {
+        auto *cur = bblock;
         while (cur) {
             cur = splitBlockOnFirstCall(cur, newblocks);
         }
     }
 
-    for (auto &bblock : newblocks) {
-        _bblocks.push_back(std::move(bblock));
-    }
+    _bblocks.insert(_bblocks.end(), newblocks.begin(), newblocks.end());
 
-    assert(entry == _bblocks[0].get() &&
+    assert(entry == _bblocks[0] &&
            "splitBBlocksOnCalls() changed the entry");
     DBG_SECTION_END(dda, "Splitting basic blocks on calls finished");
 }
@@ -0,0 +1,215 @@
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include <llvm/ADT/SmallString.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/raw_ostream.h>
+
+#include "CDCache.h"
+#include "dg/util/debug.h"
+
+namespace dg {
+namespace llvmdg {
+
+namespace {
+
+///
+// The file consists of the header followed by an array of numbers:
+// for every node, the number of its successors and their IDs, and then
+// for every node, the number of nodes it depends on and their IDs.
+// All numbers are in the byte order of the machine that created the file.
+struct Header {
+    char magic[8];
+    uint32_t version;
+    uint32_t algorithm;
+    uint32_t nodesNum;
+    uint32_t edgesNum;
+    uint32_t depsNum;
+    uint32_t reserved;
+};
+
+const char MAGIC[8] = {'D', 'G', 'C', 'D', 'A', 0, 0, 0};
+const uint32_t VERSION = 1;
+
+// FNV-1a
+void hashNum(uint64_t &hash, uint32_t num) {
+    for (unsigned i = 0; i < 4; ++i) {
+        hash ^= (num >> (8 * i)) & 0xff;
+        hash *= 1099511628211ULL;
+    }
+}
+
+unsigned getEdgesNum(CDGraph &graph) {
+    unsigned num = 0;
+    for (auto *nd : graph)
+        num += nd->successors().size();
+    return num;
+}
+
+} // anonymous namespace
+
+uint64_t CDCache::getFingerprint(CDGraph &graph, unsigned algorithm) {
+    uint64_t hash = 14695981039346656037ULL;
+    hashNum(hash, VERSION);
+    hashNum(hash, algorithm);
+    hashNum(hash, graph.size());
+    for (auto *nd : graph) {
+        hashNum(hash, nd->successors().size());
+        for (auto *succ : nd->successors())
+            hashNum(hash, succ->getID());
+    }
+    return hash;
+}
+
+std::string CDCache::getPath(uint64_t fingerprint) const {
+    char name[32];
+    snprintf(name, sizeof(name), "%016llx.cd",
+             static_cast<unsigned long long>(fingerprint));
+    return _dir + "/" + name;
+}
+
+bool CDCache::load(CDGraph &graph, CDResult &CD, CDResult &revCD) {
+    if (!isEnabled())
+        return false;
+
+    const auto path = getPath(getFingerprint(graph, _algorithm));
+    auto miss = [&](const char *msg) {
+        DBG(cda, "Cache miss for " << graph.getName() << ": " << msg);
+        (void) msg;
+        ++_misses;
+        return false;
+    };
+
+    auto buf = llvm::MemoryBuffer::getFile(path);
+    if (!buf)
+        return miss("no entry");
+
+    const char *data = (*buf)->getBufferStart();
+    const size_t size = (*buf)->getBufferSize();
+    if (size < sizeof(Header))
+        return miss("the entry is corrupted");
+
+    Header header;
+    memcpy(&header, data, sizeof(header));
+    if (memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 ||
+        header.version != VERSION)
+        return miss("unsupported entry");
+    if (header.algorithm != _algorithm || header.nodesNum != graph.size() ||
+        header.edgesNum != getEdgesNum(graph))
+        return miss("a collision of fingerprints");
+
+    const size_t numbersNum =
+            2 * header.nodesNum + header.edgesNum + header.depsNum;
+    if (size != sizeof(Header) + numbersNum * sizeof(uint32_t))
+        return miss("the entry is corrupted");
+
+    std::vector<uint32_t> numbers(numbersNum);
+    memcpy(numbers.data(), data + sizeof(Header),
+           numbersNum * sizeof(uint32_t));
+
+    size_t pos = 0;
+    for (auto *nd : graph) {
+        if (numbers[pos++] != nd->successors().size())
+            return miss("a collision of fingerprints");
+        for (auto *succ : nd->successors()) {
+            if (numbers[pos++] != succ->getID())
+                return miss("a collision of fingerprints");
+        }
+    }
+
+    std::vector<std::vector<unsigned>> deps(graph.size());
+    for (auto &nddeps : deps) {
+        if (pos == numbersNum)
+            return miss("the entry is corrupted");
+        auto num = numbers[pos++];
+        if (num > numbersNum - pos)
+            return miss("the entry is corrupted");
+        for (unsigned i = 0; i < num; ++i) {
+            auto id = numbers[pos++];
+            if (id == 0 || id > graph.size())
+                return miss("the entry is corrupted");
+            nddeps.push_back(id - 1);
+        }
+    }
+    if (pos != numbersNum)
+        return miss("the entry is corrupted");
+
+    DBG(cda, "Cache hit for " << graph.getName());
+    ++_hits;
+    CD = CDResult(graph, deps);
+    revCD = CD.reverse(graph);
+    return true;
+}
+
+void CDCache::store(CDGraph &graph, const CDResult &CD) {
+    if (!isEnabled())
+        return;
+
+    const auto path = getPath(getFingerprint(graph, _algorithm));
+    auto fail = [&path](const std::string &msg) {
+        llvm::errs() << "Failed storing control dependencies to " << path
+                     << ": " << msg << "\n";
+    };
+
+    Header header;
+    memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = VERSION;
+    header.algorithm = _algorithm;
+    header.nodesNum = graph.size();
+    header.edgesNum = getEdgesNum(graph);
+    header.depsNum = CD.size();
+    header.reserved = 0;
+
+    std::vector<uint32_t> numbers;
+    numbers.reserve(2 * header.nodesNum + header.edgesNum + header.depsNum);
+    for (auto *nd : graph) {
+        numbers.push_back(nd->successors().size());
+        for (auto *succ : nd->successors())
+            numbers.push_back(succ->getID());
+    }
+    for (auto *nd : graph) {
+        auto deps = CD[nd];
+        numbers.push_back(deps.size());
+        for (auto *dep : deps)
+            numbers.push_back(dep->getID());
+    }
+
+    if (auto ec = llvm::sys::fs::create_directories(_dir)) {
+        fail(ec.message());
+        return;
+    }
+
+    // write into a temporary file and rename it, so that concurrent
+    // runs never see a partially written entry
+    int fd;
+    llvm::SmallString<128> tmpPath;
+    if (auto ec = llvm::sys::fs::createUniqueFile(path + ".%%%%%%", fd,
+                                                  tmpPath)) {
+        fail(ec.message());
+        return;
+    }
+
+    {
+        llvm::raw_fd_ostream out(fd, /* shouldClose = */ true);
+        out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+        out.write(reinterpret_cast<const char *>(numbers.data()),
+                  numbers.size() * sizeof(uint32_t));
+        out.close();
+        if (out.has_error()) {
+            fail(out.error().message());
+            out.clear_error();
+            llvm::sys::fs::remove(tmpPath);
+            return;
+        }
+    }
+
+    if (auto ec = llvm::sys::fs::rename(tmpPath, path)) {
+        fail(ec.message());
+        llvm::sys::fs::remove(tmpPath);
+    }
+}
+
+} // namespace llvmdg
+} // namespace dg
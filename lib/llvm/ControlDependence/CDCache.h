@@ -0,0 +1,53 @@
+#ifndef DG_LLVM_CDCACHE_H_
+#define DG_LLVM_CDCACHE_H_
+
+#include <cstdint>
+#include <string>
+
+#include "ControlDependence/CDGraph.h"
+#include "ControlDependence/CDResult.h"
+
+namespace dg {
+namespace llvmdg {
+
+///
+// Persistent cache of control dependencies of functions. The results are
+// stored in files in the given directory and they are keyed by the
+// fingerprint of the CDGraph of the function (the structure of the graph
+// and the used algorithm). The control dependencies depend only on these,
+// so the results can be reused for the same function in a different run
+// or for an identical function in another module. A file contains also
+// the whole graph, so a collision of fingerprints is detected and treated
+// as a miss. If the directory is empty, the cache is disabled.
+class CDCache {
+    std::string _dir;
+    unsigned _algorithm;
+
+    unsigned _hits{0};
+    unsigned _misses{0};
+
+    std::string getPath(uint64_t fingerprint) const;
+
+  public:
+    CDCache(std::string dir, unsigned algorithm)
+            : _dir(std::move(dir)), _algorithm(algorithm) {}
+
+    bool isEnabled() const { return !_dir.empty(); }
+
+    static uint64_t getFingerprint(CDGraph &graph, unsigned algorithm);
+
+    // Load the control dependencies for the graph (and their reverse).
+    // Return false if the cache does not have them.
+    bool load(CDGraph &graph, CDResult &CD, CDResult &revCD);
+    // Store the control dependencies for the graph. Failures are
+    // reported, but they are not fatal (the cache is just not updated).
+    void store(CDGraph &graph, const CDResult &CD);
+
+    unsigned getHits() const { return _hits; }
+    unsigned getMisses() const { return _misses; }
+};
+
+} // namespace llvmdg
+} // namespace dg
+
+#endif
@@ -110,6 +110,15 @@ class StrongControlClosure : public LLVMControlDependenceAnalysisImpl {
         /* we run on demand */
     }
 
+    // the graph is built again on demand
+    void invalidate(const llvm::Function *F) override {
+        auto it = _graphs.find(F);
+        if (it == _graphs.end())
+            return;
+        graphBuilder.forget(it->second.graph);
+        _graphs.erase(it);
+    }
+
     CDGraph *getGraph(const llvm::Function *f) override { return _getGraph(f); }
     const CDGraph *getGraph(const llvm::Function *f) const override {
         return _getGraph(f);
@@ -19,6 +19,7 @@ void LLVMControlDependenceAnalysis::initializeImpl(LLVMPointerAnalysis *pta,
         }
         _impl.reset(new llvmdg::SCD(_module, _options));
     } else if (getOptions().ntscdCD() || getOptions().ntscd2CD() ||
+               getOptions().ntscdFastCD() ||
                getOptions().ntscdRanganathCD() ||
                getOptions().ntscdRanganathOrigCD()) {
         if (icfg) {
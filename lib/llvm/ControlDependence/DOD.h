@@ -3,10 +3,12 @@
 
 #include <llvm/IR/Module.h>
 
+#include "CDCache.h"
 #include "GraphBuilder.h"
 #include "IGraphBuilder.h"
 #include "dg/llvm/ControlDependence/ControlDependence.h"
 
+#include "ControlDependence/CDResult.h"
 #include "ControlDependence/DOD.h"
 #include "ControlDependence/DODNTSCD.h"
 
@@ -23,13 +25,14 @@ namespace llvmdg {
 
 class DOD : public LLVMControlDependenceAnalysisImpl {
     CDGraphBuilder graphBuilder{};
+    CDCache cache;
 
     // although DOD is a ternary relation, we treat it as binary relation
     // by forgetting the connection between dependant nodes. That is,
     // for each p -> {a, b}, we have (p, a) and (p, b).
     // This has no effect on slicing. If we will need that in the future,
     // we can change this.
-    using CDResultT = std::map<CDNode *, std::set<CDNode *>>;
+    using CDResultT = CDResult;
 
     struct Info {
         CDGraph graph;
@@ -49,7 +52,8 @@ class DOD : public LLVMControlDependenceAnalysisImpl {
 
     DOD(const llvm::Module *module,
         const LLVMControlDependenceAnalysisOptions &opts = {})
-            : LLVMControlDependenceAnalysisImpl(module, opts) {
+            : LLVMControlDependenceAnalysisImpl(module, opts),
+              cache(opts.cacheDir, static_cast<unsigned>(opts.algorithm)) {
         _graphs.reserve(module->size());
     }
 
@@ -76,12 +80,8 @@ class DOD : public LLVMControlDependenceAnalysisImpl {
         auto *info = _getFunInfo(f);
         assert(info && "Did not compute CD");
 
-        auto dit = info->controlDependence.find(node);
-        if (dit == info->controlDependence.end())
-            return {};
-
         std::set<llvm::Value *> ret;
-        for (auto *dep : dit->second) {
+        for (auto *dep : info->controlDependence[node]) {
             const auto *val = graphBuilder.getValue(dep);
             assert(val && "Invalid value");
             ret.insert(const_cast<llvm::Value *>(val));
@@ -113,12 +113,8 @@ class DOD : public LLVMControlDependenceAnalysisImpl {
         auto *info = _getFunInfo(b->getParent());
         assert(info && "Did not compute CD");
 
-        auto dit = info->controlDependence.find(block);
-        if (dit == info->controlDependence.end())
-            return {};
-
         std::set<llvm::Value *> ret;
-        for (auto *dep : dit->second) {
+        for (auto *dep : info->controlDependence[block]) {
             const auto *val = graphBuilder.getValue(dep);
             assert(val && "Invalid value");
             ret.insert(const_cast<llvm::Value *>(val));
@@ -146,6 +142,15 @@ class DOD : public LLVMControlDependenceAnalysisImpl {
         }
     }
 
+    // the graph is built again and the results are computed again on demand
+    void invalidate(const llvm::Function *F) override {
+        auto it = _graphs.find(F);
+        if (it == _graphs.end())
+            return;
+        graphBuilder.forget(it->second.graph);
+        _graphs.erase(it);
+    }
+
     CDGraph *getGraph(const llvm::Function *f) override { return _getGraph(f); }
     const CDGraph *getGraph(const llvm::Function *f) const override {
         return _getGraph(f);
@@ -186,19 +191,22 @@ class DOD : public LLVMControlDependenceAnalysisImpl {
         auto it = _graphs.emplace(F, std::move(tmpgraph));
 
         auto &info = it.first->second;
+        if (cache.load(info.graph, info.controlDependence,
+                       info.revControlDependence))
+            return;
 
         if (getOptions().dodRanganathCD()) {
             dg::DODRanganath dod;
             auto result = dod.compute(info.graph);
-            info.controlDependence = std::move(result.first);
-            info.revControlDependence = std::move(result.second);
+            info.controlDependence = CDResult(info.graph, result.first);
+            info.revControlDependence = CDResult(info.graph, result.second);
         } else if (getOptions().dodCD()) {
-            dg::DOD dod;
+            dg::DOD dod(getOptions().computeThreads);
             auto result = dod.compute(info.graph);
             info.controlDependence = std::move(result.first);
             info.revControlDependence = std::move(result.second);
         } else if (getOptions().dodntscdCD()) {
-            dg::DODNTSCD dodntscd;
+            dg::DODNTSCD dodntscd(getOptions().computeThreads);
             auto result = dodntscd.compute(info.graph);
             info.controlDependence = std::move(result.first);
             info.revControlDependence = std::move(result.second);
@@ -206,6 +214,8 @@ class DOD : public LLVMControlDependenceAnalysisImpl {
             assert(false && "Wrong analysis type");
             abort();
         }
+
+        cache.store(info.graph, info.controlDependence);
     }
 };
 
@@ -215,7 +225,7 @@ class InterproceduralDOD : public LLVMControlDependenceAnalysisImpl {
     ICDGraphBuilder igraphBuilder{};
     CDGraph graph;
 
-    using CDResultT = std::map<CDNode *, std::set<CDNode *>>;
+    using CDResultT = CDResult;
     // forward edges (from branchings to dependent blocks)
     CDResultT controlDependence{};
     // reverse edges (from dependent blocks to branchings)
@@ -250,12 +260,8 @@ class InterproceduralDOD : public LLVMControlDependenceAnalysisImpl {
         }
 
         assert(_computed && "CD is not computed");
-        auto dit = controlDependence.find(node);
-        if (dit == controlDependence.end())
-            return {};
-
         std::set<llvm::Value *> ret;
-        for (auto *dep : dit->second) {
+        for (auto *dep : controlDependence[node]) {
             const auto *val = igraphBuilder.getValue(dep);
             assert(val && "Invalid value");
             ret.insert(const_cast<llvm::Value *>(val));
@@ -282,12 +288,8 @@ class InterproceduralDOD : public LLVMControlDependenceAnalysisImpl {
         }
 
         assert(_computed && "Did not compute CD");
-        auto dit = controlDependence.find(block);
-        if (dit == controlDependence.end())
-            return {};
-
         std::set<llvm::Value *> ret;
-        for (auto *dep : dit->second) {
+        for (auto *dep : controlDependence[block]) {
             const auto *val = igraphBuilder.getValue(dep);
             assert(val && "Invalid value");
             ret.insert(const_cast<llvm::Value *>(val));
@@ -310,6 +312,16 @@ class InterproceduralDOD : public LLVMControlDependenceAnalysisImpl {
         abort();
     }
 
+    // The graph is the ICFG of the whole module, so a change of any
+    // function means building it again. It is done on demand.
+    void invalidate(const llvm::Function * /*unused*/) override {
+        igraphBuilder.clear();
+        graph = CDGraph();
+        controlDependence = CDResultT();
+        revControlDependence = CDResultT();
+        _computed = false;
+    }
+
     CDGraph *getGraph(const llvm::Function * /*unused*/) override {
         return &graph;
     }
@@ -330,15 +342,15 @@ class InterproceduralDOD : public LLVMControlDependenceAnalysisImpl {
         if (getOptions().dodRanganathCD()) {
             dg::DODRanganath dod;
             auto result = dod.compute(graph);
-            controlDependence = std::move(result.first);
-            revControlDependence = std::move(result.second);
+            controlDependence = CDResult(graph, result.first);
+            revControlDependence = CDResult(graph, result.second);
         } else if (getOptions().dodCD()) {
-            dg::DOD dod;
+            dg::DOD dod(getOptions().computeThreads);
             auto result = dod.compute(graph);
             controlDependence = std::move(result.first);
             revControlDependence = std::move(result.second);
         } else if (getOptions().dodntscdCD()) {
-            dg::DODNTSCD dodntscd;
+            dg::DODNTSCD dodntscd(getOptions().computeThreads);
             auto result = dodntscd.compute(graph);
             controlDependence = std::move(result.first);
             revControlDependence = std::move(result.second);
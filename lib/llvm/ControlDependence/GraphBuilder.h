@@ -138,6 +138,20 @@ class CDGraphBuilder {
         auto it = _rev_mapping.find(n);
         return it == _rev_mapping.end() ? nullptr : it->second;
     }
+
+    // Forget the mapping for the nodes of the graph (call this before
+    // the graph is destroyed, the values may be gone already)
+    void forget(CDGraph &graph) {
+        for (auto *nd : graph) {
+            auto it = _rev_mapping.find(nd);
+            if (it == _rev_mapping.end())
+                continue;
+            auto nit = _nodes.find(it->second);
+            if (nit != _nodes.end() && nit->second == nd)
+                _nodes.erase(nit);
+            _rev_mapping.erase(it);
+        }
+    }
 };
 
 } // namespace llvmdg
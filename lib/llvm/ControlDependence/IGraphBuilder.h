@@ -311,6 +311,13 @@ class ICDGraphBuilder {
         auto it = _rev_mapping.find(n);
         return it == _rev_mapping.end() ? nullptr : it->second;
     }
+
+    // forget everything about the built graph
+    void clear() {
+        _nodes.clear();
+        _rev_mapping.clear();
+        calls.clear();
+    }
 };
 
 } // namespace llvmdg
@@ -129,6 +129,14 @@ class LLVMInterprocCD : public LLVMControlDependenceAnalysisImpl {
         return {};
     }
 
+    // Whether a function returns depends also on the functions that it
+    // calls, so just forget everything, it is computed again on demand.
+    void invalidate(const llvm::Function * /*unused*/) override {
+        _instrCD.clear();
+        _blockCD.clear();
+        _funcInfos.clear();
+    }
+
     void compute(const llvm::Function *F = nullptr) override {
         if (F && !F->isDeclaration()) {
             if (!hasFuncInfo(F)) {
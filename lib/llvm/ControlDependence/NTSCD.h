@@ -3,11 +3,14 @@
 
 #include <llvm/IR/Module.h>
 
+#include "CDCache.h"
 #include "GraphBuilder.h"
 #include "IGraphBuilder.h"
 #include "dg/llvm/ControlDependence/ControlDependence.h"
 
+#include "ControlDependence/CDResult.h"
 #include "ControlDependence/NTSCD.h"
+#include "ControlDependence/NTSCDFast.h"
 
 #include <map>
 #include <set>
@@ -22,8 +25,9 @@ namespace llvmdg {
 
 class NTSCD : public LLVMControlDependenceAnalysisImpl {
     CDGraphBuilder graphBuilder{};
+    CDCache cache;
 
-    using CDResultT = std::map<CDNode *, std::set<CDNode *>>;
+    using CDResultT = CDResult;
 
     struct Info {
         CDGraph graph;
@@ -43,7 +47,8 @@ class NTSCD : public LLVMControlDependenceAnalysisImpl {
 
     NTSCD(const llvm::Module *module,
           const LLVMControlDependenceAnalysisOptions &opts = {})
-            : LLVMControlDependenceAnalysisImpl(module, opts) {
+            : LLVMControlDependenceAnalysisImpl(module, opts),
+              cache(opts.cacheDir, static_cast<unsigned>(opts.algorithm)) {
         _graphs.reserve(module->size());
     }
 
@@ -70,12 +75,8 @@ class NTSCD : public LLVMControlDependenceAnalysisImpl {
         auto *info = _getFunInfo(f);
         assert(info && "Did not compute CD");
 
-        auto dit = info->controlDependence.find(node);
-        if (dit == info->controlDependence.end())
-            return {};
-
         std::set<llvm::Value *> ret;
-        for (auto *dep : dit->second) {
+        for (auto *dep : info->controlDependence[node]) {
             const auto *val = graphBuilder.getValue(dep);
             assert(val && "Invalid value");
             ret.insert(const_cast<llvm::Value *>(val));
@@ -109,12 +110,8 @@ class NTSCD : public LLVMControlDependenceAnalysisImpl {
         auto *info = _getFunInfo(b->getParent());
         assert(info && "Did not compute CD");
 
-        auto dit = info->controlDependence.find(block);
-        if (dit == info->controlDependence.end())
-            return {};
-
         std::set<llvm::Value *> ret;
-        for (auto *dep : dit->second) {
+        for (auto *dep : info->controlDependence[block]) {
             const auto *val = graphBuilder.getValue(dep);
             assert(val && "Invalid value");
             ret.insert(const_cast<llvm::Value *>(val));
@@ -142,6 +139,15 @@ class NTSCD : public LLVMControlDependenceAnalysisImpl {
         }
     }
 
+    // the graph is built again and the results are computed again on demand
+    void invalidate(const llvm::Function *F) override {
+        auto it = _graphs.find(F);
+        if (it == _graphs.end())
+            return;
+        graphBuilder.forget(it->second.graph);
+        _graphs.erase(it);
+    }
+
     CDGraph *getGraph(const llvm::Function *f) override { return _getGraph(f); }
     const CDGraph *getGraph(const llvm::Function *f) const override {
         return _getGraph(f);
@@ -182,11 +188,20 @@ class NTSCD : public LLVMControlDependenceAnalysisImpl {
         auto it = _graphs.emplace(F, std::move(tmpgraph));
 
         auto &info = it.first->second;
+        if (cache.load(info.graph, info.controlDependence,
+                       info.revControlDependence))
+            return;
 
         const auto &opts = getOptions();
         if (opts.ntscd2CD()) {
             DBG(cda, "Using the NTSCD 2 algorithm");
-            dg::NTSCD2 ntscd;
+            dg::NTSCD2 ntscd(getOptions().computeThreads);
+            auto result = ntscd.compute(info.graph);
+            info.controlDependence = std::move(result.first);
+            info.revControlDependence = std::move(result.second);
+        } else if (opts.ntscdFastCD()) {
+            DBG(cda, "Using the fast NTSCD algorithm");
+            dg::NTSCDFast ntscd;
             auto result = ntscd.compute(info.graph);
             info.controlDependence = std::move(result.first);
             info.revControlDependence = std::move(result.second);
@@ -196,20 +211,22 @@ class NTSCD : public LLVMControlDependenceAnalysisImpl {
             if (opts.ntscdRanganathOrigCD()) {
                 auto result =
                         ntscd.compute(info.graph, /* doFixpoint= */ false);
-                info.controlDependence = std::move(result.first);
-                info.revControlDependence = std::move(result.second);
+                info.controlDependence = CDResult(info.graph, result.first);
+                info.revControlDependence = CDResult(info.graph, result.second);
             } else {
                 auto result = ntscd.compute(info.graph);
-                info.controlDependence = std::move(result.first);
-                info.revControlDependence = std::move(result.second);
+                info.controlDependence = CDResult(info.graph, result.first);
+                info.revControlDependence = CDResult(info.graph, result.second);
             }
         } else {
             assert(opts.ntscdCD() && "Wrong analysis type");
-            dg::NTSCD ntscd;
+            dg::NTSCD ntscd(getOptions().computeThreads);
             auto result = ntscd.compute(info.graph);
             info.controlDependence = std::move(result.first);
             info.revControlDependence = std::move(result.second);
         }
+
+        cache.store(info.graph, info.controlDependence);
     }
 };
 
@@ -217,7 +234,7 @@ class InterproceduralNTSCD : public LLVMControlDependenceAnalysisImpl {
     ICDGraphBuilder igraphBuilder{};
     CDGraph graph;
 
-    using CDResultT = std::map<CDNode *, std::set<CDNode *>>;
+    using CDResultT = CDResult;
     // forward edges (from branchings to dependent blocks)
     CDResultT controlDependence{};
     // reverse edges (from dependent blocks to branchings)
@@ -252,12 +269,8 @@ class InterproceduralNTSCD : public LLVMControlDependenceAnalysisImpl {
         }
 
         assert(_computed && "CD is not computed");
-        auto dit = controlDependence.find(node);
-        if (dit == controlDependence.end())
-            return {};
-
         std::set<llvm::Value *> ret;
-        for (auto *dep : dit->second) {
+        for (auto *dep : controlDependence[node]) {
             const auto *val = igraphBuilder.getValue(dep);
             assert(val && "Invalid value");
             ret.insert(const_cast<llvm::Value *>(val));
@@ -284,12 +297,8 @@ class InterproceduralNTSCD : public LLVMControlDependenceAnalysisImpl {
         }
 
         assert(_computed && "Did not compute CD");
-        auto dit = controlDependence.find(block);
-        if (dit == controlDependence.end())
-            return {};
-
         std::set<llvm::Value *> ret;
-        for (auto *dep : dit->second) {
+        for (auto *dep : controlDependence[block]) {
             const auto *val = igraphBuilder.getValue(dep);
             assert(val && "Invalid value");
             ret.insert(const_cast<llvm::Value *>(val));
@@ -312,6 +321,16 @@ class InterproceduralNTSCD : public LLVMControlDependenceAnalysisImpl {
         abort();
     }
 
+    // The graph is the ICFG of the whole module, so a change of any
+    // function means building it again. It is done on demand.
+    void invalidate(const llvm::Function * /*unused*/) override {
+        igraphBuilder.clear();
+        graph = CDGraph();
+        controlDependence = CDResultT();
+        revControlDependence = CDResultT();
+        _computed = false;
+    }
+
     CDGraph *getGraph(const llvm::Function * /*unused*/) override {
         return &graph;
     }
@@ -331,7 +350,13 @@ class InterproceduralNTSCD : public LLVMControlDependenceAnalysisImpl {
 
         if (getOptions().ntscd2CD()) {
             DBG(cda, "Using the NTSCD 2 algorithm");
-            dg::NTSCD2 ntscd;
+            dg::NTSCD2 ntscd(getOptions().computeThreads);
+            auto result = ntscd.compute(graph);
+            controlDependence = std::move(result.first);
+            revControlDependence = std::move(result.second);
+        } else if (getOptions().ntscdFastCD()) {
+            DBG(cda, "Using the fast NTSCD algorithm");
+            dg::NTSCDFast ntscd;
             auto result = ntscd.compute(graph);
             controlDependence = std::move(result.first);
             revControlDependence = std::move(result.second);
@@ -339,11 +364,11 @@ class InterproceduralNTSCD : public LLVMControlDependenceAnalysisImpl {
             DBG(cda, "Using the NTSCD Ranganath algorithm");
             dg::NTSCDRanganath ntscd;
             auto result = ntscd.compute(graph);
-            controlDependence = std::move(result.first);
-            revControlDependence = std::move(result.second);
+            controlDependence = CDResult(graph, result.first);
+            revControlDependence = CDResult(graph, result.second);
         } else {
             assert(getOptions().ntscdCD() && "Wrong analysis type");
-            dg::NTSCD ntscd;
+            dg::NTSCD ntscd(getOptions().computeThreads);
             auto result = ntscd.compute(graph);
             controlDependence = std::move(result.first);
             revControlDependence = std::move(result.second);
@@ -72,30 +72,114 @@ class PostDominanceFrontiers {
     }
 };
 
-void SCD::computePostDominators(llvm::Function &F) {
-    DBG_SECTION_BEGIN(cda, "Computing post dominators for function "
-                                   << F.getName().str());
-    using namespace llvm;
+SCD::PostDomInfo::PostDomInfo() = default;
+SCD::PostDomInfo::PostDomInfo(PostDomInfo &&) = default;
+SCD::PostDomInfo::~PostDomInfo() = default;
 
-    PostDominatorTree *pdtree = nullptr;
-
-    DBG(cda, "Computing post dominator tree");
+static void recalculate(llvm::PostDominatorTree &pdtree, llvm::Function &F) {
 #if ((LLVM_VERSION_MAJOR == 3) && (LLVM_VERSION_MINOR < 9))
+    pdtree.runOnFunction(F); // compute post-dominator tree for this function
+#else
+    pdtree.recalculate(F);
+#endif
+}
 
-    auto pdtreeptr =
-            std::unique_ptr<PostDominatorTree>(new PostDominatorTree());
-    pdtree = pdtreeptr.get();
-    pdtree->runOnFunction(F); // compute post-dominator tree for this function
+void SCD::clearDependencies(const llvm::Function *F) {
+    auto it = _postDoms.find(F);
+    if (it == _postDoms.end())
+        return;
 
-#else // LLVM >= 3.9
+    for (const auto *B : it->second.blocks) {
+        dependencies.erase(B);
+        dependentBlocks.erase(B);
+    }
+    it->second.blocks.clear();
+}
+
+void SCD::invalidate(const llvm::Function *F) {
+    clearDependencies(F);
+    _postDoms.erase(F);
+    _computed.erase(F);
+}
 
-    PostDominatorTreeWrapperPass wrapper;
-    wrapper.runOnFunction(F);
-    pdtree = &wrapper.getPostDomTree();
+void SCD::updateCFG(const llvm::Function *F,
+                    const std::vector<CFGUpdate> &updates) {
+    auto it = _postDoms.find(F);
+    if (it == _postDoms.end()) {
+        // nothing computed yet, it will be computed on demand
+        return;
+    }
+
+    DBG_SECTION_BEGIN(cda, "Updating post dominators for function "
+                                   << F->getName().str());
+    auto &info = it->second;
+    // the tree can be updated only if the function has still the same
+    // blocks, otherwise we must compute it again
+    bool sameBlocks = info.blocks.size() == F->size();
+    clearDependencies(F);
+    _computed.erase(F);
+
+    auto &pdtree = *info.tree;
+    auto &fun = *const_cast<llvm::Function *>(F);
+#if LLVM_VERSION_MAJOR >= 6
+    if (sameBlocks) {
+        for (const auto &B : fun) {
+            if (!pdtree.getNode(&B)) {
+                sameBlocks = false;
+                break;
+            }
+        }
+    }
 
-#ifndef NDEBUG
-    wrapper.verifyAnalysis();
+    if (sameBlocks) {
+        using UpdateT = llvm::PostDominatorTree::UpdateType;
+        using UpdateKind = llvm::PostDominatorTree::UpdateKind;
+        std::vector<UpdateT> treeUpdates;
+        treeUpdates.reserve(updates.size());
+        for (const auto &update : updates) {
+            auto *from = const_cast<llvm::BasicBlock *>(update.from);
+            auto *to = const_cast<llvm::BasicBlock *>(update.to);
+            treeUpdates.emplace_back(update.kind == CFGUpdate::Kind::INSERT
+                                             ? UpdateKind::Insert
+                                             : UpdateKind::Delete,
+                                     from, to);
+        }
+        DBG(cda, "Applying " << treeUpdates.size() << " updates");
+        pdtree.applyUpdates(treeUpdates);
+        assert(pdtree.verify() && "Updated post dominator tree is invalid");
+    } else
 #endif
+    {
+        (void) sameBlocks;
+        (void) updates;
+        DBG(cda, "Computing post dominator tree again");
+        recalculate(pdtree, fun);
+    }
+
+    DBG_SECTION_END(cda, "Done updating post dominators for function "
+                                 << F->getName().str());
+}
+
+void SCD::computePostDominators(llvm::Function &F) {
+    DBG_SECTION_BEGIN(cda, "Computing post dominators for function "
+                                   << F.getName().str());
+    using namespace llvm;
+
+    // reuse the tree if we have it (it is kept up-to-date in updateCFG)
+    auto &info = _postDoms[&F];
+    if (!info.tree) {
+        DBG(cda, "Computing post dominator tree");
+        info.tree.reset(new PostDominatorTree());
+        recalculate(*info.tree, F);
+    }
+
+    info.blocks.clear();
+    info.blocks.reserve(F.size());
+    for (const auto &B : F)
+        info.blocks.push_back(&B);
+
+#if ((LLVM_VERSION_MAJOR > 3) || (LLVM_VERSION_MINOR >= 9))
+    PostDominatorTree *pdtree = info.tree.get();
 
     DBG(cda, "Computing post dominator frontiers and adding CD");
 
@@ -129,7 +213,7 @@ void SCD::computePostDominators(llvm::Function &F) {
         }
     }
 
-#endif // LLVM < 3.9
+#endif // LLVM >= 3.9
 
     DBG_SECTION_END(cda, "Done computing post dominators for function "
                                  << F.getName().str());
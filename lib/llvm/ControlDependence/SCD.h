@@ -7,12 +7,15 @@
 #include "dg/util/debug.h"
 
 #include <map>
+#include <memory>
 #include <set>
 #include <unordered_map>
+#include <vector>
 
 namespace llvm {
 class Function;
-}
+class PostDominatorTree;
+} // namespace llvm
 
 namespace dg {
 
@@ -26,6 +29,7 @@ namespace llvmdg {
 // like the other classes (we use the post-dominance computation from LLVM).
 class SCD : public LLVMControlDependenceAnalysisImpl {
     void computePostDominators(llvm::Function &F);
+    void clearDependencies(const llvm::Function *F);
 
     std::unordered_map<const llvm::BasicBlock *, std::set<llvm::BasicBlock *>>
             dependentBlocks;
@@ -33,6 +37,20 @@ class SCD : public LLVMControlDependenceAnalysisImpl {
             dependencies;
     std::set<const llvm::Function *> _computed;
 
+    // Post-dominator trees are kept so that they can be updated after
+    // changes of CFG instead of being computed again. We also remember
+    // the blocks for which we have the dependencies, as the blocks
+    // may be removed from the function in the meantime.
+    struct PostDomInfo {
+        std::unique_ptr<llvm::PostDominatorTree> tree;
+        std::vector<const llvm::BasicBlock *> blocks;
+
+        PostDomInfo();
+        PostDomInfo(PostDomInfo &&);
+        ~PostDomInfo();
+    };
+    std::unordered_map<const llvm::Function *, PostDomInfo> _postDoms;
+
     void computeOnDemand(const llvm::Function *F) {
         if (_computed.insert(F).second) {
             computePostDominators(*const_cast<llvm::Function *>(F));
@@ -69,6 +87,10 @@ class SCD : public LLVMControlDependenceAnalysisImpl {
         return ValVec{S.begin(), S.end()};
     }
 
+    void invalidate(const llvm::Function *F) override;
+    void updateCFG(const llvm::Function *F,
+                   const std::vector<CFGUpdate> &updates) override;
+
     void compute(const llvm::Function *F = nullptr) override {
         DBG(cda, "Triggering computation of all dependencies");
         if (F && !F->isDeclaration()) {
@@ -23,10 +23,14 @@ GraphBuilder::GraphBuilder(dg::LLVMPointerAnalysis *pointsToAnalysis)
           threads(pointsToAnalysis ? pointsToAnalysis->getOptions().threads
                                    : false) {}
 
-GraphBuilder::~GraphBuilder() {
+GraphBuilder::~GraphBuilder() { clear(); }
+
+void GraphBuilder::clear() {
     for (auto function : _functions) {
         delete function.second;
     }
+    _functions.clear();
+    _mapping.clear();
 }
 
 bool isExit(const TarjanAnalysis<Block>::StronglyConnectedComponent *component,
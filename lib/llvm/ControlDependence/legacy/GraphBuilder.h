@@ -61,6 +61,9 @@ class GraphBuilder {
         return it == _mapping.end() ? nullptr : &it->second;
     }
 
+    // delete all the built functions
+    void clear();
+
     void dumpNodes(std::ostream &ostream) const;
     void dumpEdges(std::ostream &ostream) const;
     void dump(std::ostream &ostream) const;
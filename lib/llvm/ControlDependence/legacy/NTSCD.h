@@ -100,6 +100,16 @@ class NTSCD : public LLVMControlDependenceAnalysisImpl {
     // Compute dependencies for the whole ICFG (used in legacy code)
     void computeDependencies();
 
+    // The graph is interprocedural, so forget everything,
+    // it is built again on demand.
+    void invalidate(const llvm::Function * /*unused*/) override {
+        graphBuilder.clear();
+        controlDependency.clear();
+        revControlDependency.clear();
+        nodeInfo.clear();
+        _computed.clear();
+    }
+
   private:
     GraphBuilder graphBuilder;
 
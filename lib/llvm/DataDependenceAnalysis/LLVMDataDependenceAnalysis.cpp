@@ -125,5 +125,39 @@ LLVMDataDependenceAnalysis::getLLVMDefinitions(llvm::Value *use) {
     return defs;
 }
 
+std::vector<llvm::Value *> LLVMDataDependenceAnalysis::getLLVMDefinitions(
+        llvm::Value *use, const DefinitionsQueryBudget &budget, bool &exact) {
+    std::vector<llvm::Value *> defs;
+    exact = true;
+
+    auto *loc = getNode(use);
+    if (!loc) {
+        llvm::errs() << "[DDA] error: no node for: " << *use << "\n";
+        return defs;
+    }
+
+    if (loc->getUses().empty()) {
+        llvm::errs() << "[DDA] error: the queried value has empty uses: "
+                     << *use << "\n";
+        return defs;
+    }
+
+    auto result = DDA->getDefinitions(loc, budget);
+    exact = result.exact;
+
+    // map the values
+    for (RWNode *nd : result.definitions) {
+        if (nd->isUnknown()) {
+            assert(!exact && "Unknown memory in exact definitions");
+            continue;
+        }
+        const auto *llvmvalue = getValue(nd);
+        assert(llvmvalue && "Have no value for a node");
+        defs.push_back(const_cast<llvm::Value *>(llvmvalue));
+    }
+
+    return defs;
+}
+
 } // namespace dda
 } // namespace dg
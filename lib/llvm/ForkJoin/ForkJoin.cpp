@@ -8,8 +8,8 @@ std::vector<const llvm::Value *>
 ForkJoinAnalysis::matchJoin(const llvm::Value *joinVal) {
     using namespace llvm;
 
-    if (_PTA->getOptions().isSVF()) {
-        errs() << "ForkJoin analysis does not support SVF yet\n";
+    if (!_PTA->getOptions().isDG()) {
+        errs() << "ForkJoin analysis needs the DG pointer analysis\n";
         abort();
     }
 
@@ -42,8 +42,8 @@ std::vector<const llvm::Value *>
 ForkJoinAnalysis::joinFunctions(const llvm::Value *joinVal) {
     using namespace llvm;
 
-    if (_PTA->getOptions().isSVF()) {
-        errs() << "ForkJoin analysis does not support SVF yet\n";
+    if (!_PTA->getOptions().isDG()) {
+        errs() << "ForkJoin analysis needs the DG pointer analysis\n";
         abort();
     }
 
@@ -905,7 +905,7 @@ void LLVMDependenceGraph::computeNTSCD(
         const LLVMControlDependenceAnalysisOptions &opts) {
     DBG_SECTION_BEGIN(llvmdg, "Filling in CDA edges (NTSCD)");
     dg::LLVMControlDependenceAnalysis ntscd(this->module, opts);
-    assert(opts.ntscdCD() || opts.ntscd2CD());
+    assert(opts.ntscdCD() || opts.ntscd2CD() || opts.ntscdFastCD());
 
     for (const auto &it : getConstructedFunctions()) {
         auto &blocks = it.second->getBlocks();
@@ -1151,7 +1151,8 @@ void LLVMDependenceGraph::computeControlDependencies(
         tmpopts.algorithm =
                 ControlDependenceAnalysisOptions::CDAlgorithm::NTSCD2;
         computeNTSCD(tmpopts);
-    } else if (opts.ntscdCD() || opts.ntscd2CD() || opts.ntscdRanganathCD()) {
+    } else if (opts.ntscdCD() || opts.ntscd2CD() || opts.ntscdFastCD() ||
+               opts.ntscdRanganathCD()) {
         computeNTSCD(opts);
     } else
         abort();
@@ -1187,7 +1188,8 @@ void LLVMDependenceGraph::addNoreturnDependencies(LLVMNode *noret,
 
 void LLVMDependenceGraph::addNoreturnDependencies(
         const LLVMControlDependenceAnalysisOptions &opts) {
-    if (opts.ntscdCD() || opts.ntscd2CD() || opts.ntscdLegacyCD()) {
+    if (opts.ntscdCD() || opts.ntscd2CD() || opts.ntscdFastCD() ||
+        opts.ntscdLegacyCD()) {
         llvmdg::LLVMInterprocCD interprocCD(this->module);
         for (const auto &F : getConstructedFunctions()) {
             auto *dg = F.second;
@@ -87,7 +87,8 @@ PSNode *LLVMPointerGraphBuilder::tryGetOperand(const llvm::Value *val) {
         op = op->getPairedNode();
     }
 
-    return op;
+    // the node may have been merged into another node by the analysis
+    return PS.getRepresentative(op);
 }
 
 PSNode *LLVMPointerGraphBuilder::getOperand(const llvm::Value *val) {
@@ -546,13 +547,6 @@ LLVMPointerGraphBuilder::buildFunction(const llvm::Function &F) {
     assert(!getSubgraph(&F) && "We already built this function");
     assert(!F.isDeclaration() && "Cannot build an undefined function");
 
-    // create root and later (an unified) return nodes of this subgraph.
-    // These are just for our convenience when building the graph,
-    // they can be optimized away later since they are noops
-    PSNodeEntry *root = PSNodeEntry::get(PS.create<PSNodeType::ENTRY>());
-    assert(root);
-    root->setFunctionName(F.getName().str());
-
     // if the function has variable arguments,
     // then create the node for it
     PSNode *vararg = nullptr;
@@ -560,10 +554,29 @@ LLVMPointerGraphBuilder::buildFunction(const llvm::Function &F) {
         vararg = PS.create<PSNodeType::PHI>();
     }
 
+    PSNodeEntry *root;
+    PointerSubgraph *subg;
+    auto it = detached_subgraphs.find(&F);
+    if (it != detached_subgraphs.end()) {
+        // we are building a changed function again. Keep its subgraph
+        // (with the root), the rest of the graph may call it
+        subg = it->second;
+        detached_subgraphs.erase(it);
+        root = PSNodeEntry::cast(subg->root);
+        subg->vararg = vararg;
+    } else {
+        // create root and later (an unified) return nodes of this subgraph.
+        // These are just for our convenience when building the graph,
+        // they can be optimized away later since they are noops
+        root = PSNodeEntry::get(PS.create<PSNodeType::ENTRY>());
+        subg = PS.createSubgraph(root, vararg);
+    }
+    assert(root);
+    root->setFunctionName(F.getName().str());
+
     // add record to built graphs here, so that subsequent call of this function
     // from buildPointerGraphBlock won't get stuck in infinite recursive call
     // when this function is recursive
-    PointerSubgraph *subg = PS.createSubgraph(root, vararg);
     subgraphs_map[&F] = subg;
 
     assert(subg->root == root && subg->vararg == vararg);
@@ -0,0 +1,680 @@
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <llvm/IR/Constants.h>
+#include <llvm/IR/DataLayout.h>
+#include <llvm/IR/InstIterator.h>
+#include <llvm/IR/Operator.h>
+#include <llvm/Support/raw_ostream.h>
+
+#include "dg/llvm/PointerAnalysis/StoredPointerAnalysis.h"
+#include "dg/util/debug.h"
+
+#include "llvm/llvm-utils.h"
+
+namespace dg {
+
+///
+// The file consists of the header followed by the arrays of functions,
+// pointers, points-to sets and values, and by the names of functions
+// and globals. All numbers are in the byte order of the machine
+// that created the file.
+struct StoredPointerAnalysis::Header {
+    char magic[8];
+    uint32_t version;
+    uint32_t functionsNum;
+    uint32_t pointersNum;
+    uint32_t setsNum;
+    uint32_t valuesNum;
+    uint32_t namesSize;
+    // the fingerprint of global variables (see getGlobalsFingerprint())
+    uint64_t globalsFingerprint;
+};
+
+// a defined function of the module (in the order of the module),
+// so that we can detect that the results were computed
+// for a different module
+struct StoredPointerAnalysis::FunctionEntry {
+    uint32_t name;
+    uint32_t reserved;
+    // see getFingerprint()
+    uint64_t fingerprint;
+};
+
+// a pointer in a points-to set, 'value' is the index of the target
+struct StoredPointerAnalysis::PointerEntry {
+    uint64_t offset;
+    uint32_t value;
+    uint32_t reserved;
+};
+
+// the points-to set of the value 'value', the pointers
+// of the set are the pointers [first, first + num)
+struct StoredPointerAnalysis::SetEntry {
+    uint32_t value;
+    uint32_t flags;
+    uint32_t size;
+    uint32_t first;
+    uint32_t num;
+    uint32_t reserved;
+};
+
+// a global value (by its name or its position among global variables),
+// or an argument or an instruction of the function 'name'
+struct StoredPointerAnalysis::ValueEntry {
+    uint32_t kind;
+    uint32_t name;
+    uint32_t index;
+};
+
+namespace {
+
+const char MAGIC[8] = {'D', 'G', 'P', 'T', 'A', '\0', '\0', '\0'};
+const uint32_t VERSION = 2;
+const uint32_t NONE = ~static_cast<uint32_t>(0);
+
+enum Flags : uint32_t {
+    UNKNOWN = 1,
+    NULLPTR = 1 << 1,
+    NULL_WITH_OFFSET = 1 << 2,
+    INVALIDATED = 1 << 3,
+};
+
+enum ValueKind : uint32_t {
+    GLOBAL = 0,
+    ARGUMENT = 1,
+    INSTRUCTION = 2,
+};
+
+// FNV-1a
+void hashNum(uint64_t &hash, uint64_t num) {
+    for (unsigned i = 0; i < 8; ++i) {
+        hash ^= (num >> (8 * i)) & 0xff;
+        hash *= 1099511628211ULL;
+    }
+}
+
+void hashString(uint64_t &hash, llvm::StringRef str) {
+    hashNum(hash, str.size());
+    for (char c : str) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ULL;
+    }
+}
+
+// the types that pointers point to are not hashed,
+// so the types cannot form a cycle
+void hashType(uint64_t &hash, const llvm::Type *type) {
+    using namespace llvm;
+
+    hashNum(hash, type->getTypeID());
+    if (const auto *IT = dyn_cast<IntegerType>(type)) {
+        hashNum(hash, IT->getBitWidth());
+    } else if (const auto *PT = dyn_cast<PointerType>(type)) {
+        hashNum(hash, PT->getAddressSpace());
+    } else if (const auto *AT = dyn_cast<ArrayType>(type)) {
+        hashNum(hash, AT->getNumElements());
+        hashType(hash, AT->getElementType());
+    } else {
+        // structures, vectors and functions
+        hashNum(hash, type->getNumContainedTypes());
+        for (const Type *sub : type->subtypes())
+            hashType(hash, sub);
+    }
+}
+
+void hashConstant(uint64_t &hash, const llvm::Constant *C) {
+    using namespace llvm;
+
+    hashNum(hash, C->getValueID());
+    hashType(hash, C->getType());
+    if (const auto *G = dyn_cast<GlobalValue>(C)) {
+        // the global values are resolved by their names
+        hashString(hash, G->getName());
+    } else if (const auto *CI = dyn_cast<ConstantInt>(C)) {
+        hashNum(hash, CI->getValue().getLimitedValue());
+    } else {
+        // constant expressions and aggregates
+        if (const auto *CE = dyn_cast<ConstantExpr>(C))
+            hashNum(hash, CE->getOpcode());
+        hashNum(hash, C->getNumOperands());
+        for (const auto &op : C->operands()) {
+            // block addresses have basic blocks as operands
+            if (const auto *opC = dyn_cast<Constant>(op))
+                hashConstant(hash, opC);
+            else
+                hashNum(hash, op->getValueID());
+        }
+    }
+}
+
+///
+// The fingerprint of a function is the hash of the opcodes, types
+// and operands of its instructions. The operands are hashed
+// by their kind and position (or by their value if they are constants),
+// so the fingerprint changes whenever the instructions change in a way
+// that can change the results of pointer analysis or the positions
+// of the instructions.
+uint64_t getFingerprint(const llvm::Function &F) {
+    using namespace llvm;
+
+    std::unordered_map<const Value *, uint32_t> positions;
+    uint32_t idx = 0;
+    for (const auto &B : F) {
+        positions.emplace(&B, idx++);
+        for (const auto &I : B)
+            positions.emplace(&I, idx++);
+    }
+
+    uint64_t hash = 14695981039346656037ULL;
+    hashType(hash, F.getFunctionType());
+    hashNum(hash, F.isVarArg());
+    for (const auto &B : F) {
+        hashNum(hash, B.size());
+        for (const auto &I : B) {
+            hashNum(hash, I.getOpcode());
+            hashType(hash, I.getType());
+            hashNum(hash, I.getNumOperands());
+            for (const auto &op : I.operands()) {
+                hashNum(hash, op->getValueID());
+                if (const auto *A = dyn_cast<Argument>(op)) {
+                    hashNum(hash, A->getArgNo());
+                } else if (const auto *C = dyn_cast<Constant>(op)) {
+                    hashConstant(hash, C);
+                } else {
+                    auto it = positions.find(op);
+                    if (it != positions.end())
+                        hashNum(hash, it->second);
+                }
+            }
+        }
+    }
+
+    return hash;
+}
+
+// the hash of names, types and initializers of global variables
+uint64_t getGlobalsFingerprint(const llvm::Module *M) {
+    uint64_t hash = 14695981039346656037ULL;
+    for (auto I = M->global_begin(), E = M->global_end(); I != E; ++I) {
+        hashString(hash, I->getName());
+        hashType(hash, I->getValueType());
+        hashNum(hash, I->hasInitializer());
+        if (I->hasInitializer())
+            hashConstant(hash, I->getInitializer());
+    }
+    return hash;
+}
+
+const llvm::GlobalVariable *getGlobalVariable(const llvm::Module *M,
+                                              uint32_t idx) {
+    for (auto I = M->global_begin(), E = M->global_end(); I != E; ++I) {
+        if (idx-- == 0)
+            return &*I;
+    }
+    return nullptr;
+}
+
+///
+// Implementation of LLVMPointsToSet that iterates
+// over the pointers stored in the file
+class StoredLLVMPointsToSet : public LLVMPointsToSetImpl {
+    using PointerEntry = StoredPointerAnalysis::PointerEntry;
+
+    const PointerEntry *_it;
+    const PointerEntry *_end;
+    const std::vector<const llvm::Value *> &_values;
+    const uint32_t _flags;
+    const size_t _size;
+    const Offset _shift;
+    int _position{0};
+
+    LLVMPointer toPointer(const PointerEntry *ptr) const {
+        return {const_cast<llvm::Value *>(_values[ptr->value]),
+                Offset(ptr->offset) + _shift};
+    }
+
+  public:
+    StoredLLVMPointsToSet(const PointerEntry *b, const PointerEntry *e,
+                          const std::vector<const llvm::Value *> &values,
+                          uint32_t flags, size_t size, Offset shift = 0)
+            : _it(b), _end(e), _values(values), _flags(flags), _size(size),
+              _shift(shift) {}
+
+    bool hasUnknown() const override { return _flags & UNKNOWN; }
+    bool hasNull() const override { return _flags & NULLPTR; }
+    bool hasNullWithOffset() const override {
+        return _flags & NULL_WITH_OFFSET;
+    }
+    bool hasInvalidated() const override { return _flags & INVALIDATED; }
+    size_t size() const override { return _size; }
+
+    LLVMPointer getKnownSingleton() const override {
+        assert(_size == 1 && _flags == 0 && _it != _end);
+        return toPointer(_it);
+    }
+
+    int position() const override { return _position; }
+    bool end() const override { return _it == _end; }
+    void shift() override {
+        assert(_it != _end && "Tried to shift end() iterator");
+        ++_it;
+        ++_position;
+    }
+
+    LLVMPointer get() const override {
+        assert(_it != _end && "Dereferenced end() iterator");
+        return toPointer(_it);
+    }
+
+    // NOTE: LLVMPointsToSet will overtake the ownership of this
+    // object and will delete it on destruction.
+    LLVMPointsToSet toLLVMPointsToSet() { return LLVMPointsToSet(this); }
+};
+
+///
+// Gathers the points-to sets and the identities of the values
+class ResultsWriter {
+    using PointerEntry = StoredPointerAnalysis::PointerEntry;
+    using SetEntry = StoredPointerAnalysis::SetEntry;
+    using ValueEntry = StoredPointerAnalysis::ValueEntry;
+
+    const llvm::Module *_module;
+    std::unordered_map<const llvm::Value *, uint32_t> _ids;
+    std::unordered_map<const llvm::Instruction *, uint32_t> _positions;
+    std::unordered_map<const llvm::GlobalVariable *, uint32_t> _globals;
+    std::unordered_map<std::string, uint32_t> _nameIds;
+
+    uint32_t getName(const std::string &name) {
+        auto it = _nameIds.find(name);
+        if (it != _nameIds.end())
+            return it->second;
+
+        auto id = static_cast<uint32_t>(names.size());
+        names.append(name);
+        names.push_back('\0');
+        _nameIds.emplace(name, id);
+        return id;
+    }
+
+    uint32_t createId(const llvm::Value *val) {
+        using namespace llvm;
+
+        if (const auto *G = dyn_cast<GlobalValue>(val)) {
+            if (G->hasName())
+                return addValue(GLOBAL, G->getName().str(), 0);
+            auto it = _globals.find(dyn_cast<GlobalVariable>(G));
+            if (it == _globals.end())
+                return NONE;
+            return addValue(GLOBAL, "", it->second);
+        }
+
+        if (const auto *A = dyn_cast<Argument>(val)) {
+            if (!A->getParent()->hasName())
+                return NONE;
+            return addValue(ARGUMENT, A->getParent()->getName().str(),
+                            A->getArgNo());
+        }
+
+        if (const auto *I = dyn_cast<Instruction>(val)) {
+            const auto *F = I->getParent()->getParent();
+            if (!F->hasName())
+                return NONE;
+            assert(_positions.count(I) > 0);
+            return addValue(INSTRUCTION, F->getName().str(), _positions[I]);
+        }
+
+        return NONE;
+    }
+
+    uint32_t addValue(uint32_t kind, const std::string &name, uint32_t idx) {
+        values.push_back(ValueEntry{kind, getName(name), idx});
+        return static_cast<uint32_t>(values.size() - 1);
+    }
+
+  public:
+    std::vector<StoredPointerAnalysis::FunctionEntry> functions;
+    std::vector<PointerEntry> pointers;
+    std::vector<SetEntry> sets;
+    std::vector<ValueEntry> values;
+    std::string names;
+
+    ResultsWriter(const llvm::Module *M) : _module(M) {
+        // the empty name
+        names.push_back('\0');
+        _nameIds.emplace("", 0);
+
+        uint32_t idx = 0;
+        for (auto I = M->global_begin(), E = M->global_end(); I != E; ++I)
+            _globals.emplace(&*I, idx++);
+
+        for (const auto &F : *M) {
+            if (F.isDeclaration())
+                continue;
+            functions.push_back(StoredPointerAnalysis::FunctionEntry{
+                    getName(F.getName().str()), 0, getFingerprint(F)});
+
+            idx = 0;
+            for (auto I = llvm::inst_begin(F), E = llvm::inst_end(F); I != E;
+                 ++I)
+                _positions.emplace(&*I, idx++);
+        }
+    }
+
+    // get the index of the value or NONE if the value cannot be identified
+    uint32_t getId(const llvm::Value *val) {
+        auto it = _ids.find(val);
+        if (it != _ids.end())
+            return it->second;
+
+        auto id = createId(val);
+        _ids.emplace(val, id);
+        return id;
+    }
+
+    void addSet(LLVMPointerAnalysis &PTA, const llvm::Value *val) {
+        auto pts = PTA.getLLVMPointsToChecked(val);
+        if (!pts.first)
+            return;
+
+        auto id = getId(val);
+        if (id == NONE)
+            return;
+
+        const auto &S = pts.second;
+        uint32_t flags = 0;
+        if (S.hasUnknown())
+            flags |= UNKNOWN;
+        if (S.hasNull())
+            flags |= NULLPTR;
+        if (S.hasNullWithOffset())
+            flags |= NULL_WITH_OFFSET;
+        if (S.hasInvalidated())
+            flags |= INVALIDATED;
+
+        auto first = static_cast<uint32_t>(pointers.size());
+        for (const auto &ptr : S) {
+            auto target = getId(ptr.value);
+            if (target == NONE) {
+                // we cannot find this value again,
+                // so say that we do not know where it points
+                flags |= UNKNOWN;
+                continue;
+            }
+            pointers.push_back(PointerEntry{*ptr.offset, target, 0});
+        }
+
+        sets.push_back(SetEntry{id, flags, static_cast<uint32_t>(S.size()),
+                                first,
+                                static_cast<uint32_t>(pointers.size() - first),
+                                0});
+    }
+
+    void addSets(LLVMPointerAnalysis &PTA) {
+        for (auto I = _module->global_begin(), E = _module->global_end();
+             I != E; ++I)
+            addSet(PTA, &*I);
+
+        for (const auto &F : *_module) {
+            addSet(PTA, &F);
+            for (auto A = F.arg_begin(), E = F.arg_end(); A != E; ++A)
+                addSet(PTA, &*A);
+            for (auto I = llvm::inst_begin(F), E = llvm::inst_end(F); I != E;
+                 ++I)
+                addSet(PTA, &*I);
+        }
+    }
+};
+
+template <typename T>
+void writeArray(std::ofstream &out, const std::vector<T> &arr) {
+    out.write(reinterpret_cast<const char *>(arr.data()),
+              static_cast<std::streamsize>(arr.size() * sizeof(T)));
+}
+
+// strip the casts and constant offsets from a constant expression
+const llvm::Value *stripConstantExpr(const llvm::Value *val,
+                                     const llvm::DataLayout &DL,
+                                     Offset &shift) {
+    using namespace llvm;
+
+    while (const auto *CE = dyn_cast<ConstantExpr>(val)) {
+        if (CE->isCast()) {
+            val = CE->getOperand(0);
+        } else if (const auto *GEP = dyn_cast<GEPOperator>(CE)) {
+            APInt off(DL.getPointerSizeInBits(GEP->getPointerAddressSpace()),
+                      0);
+            if (GEP->accumulateConstantOffset(DL, off) && !off.isNegative())
+                shift += off.getZExtValue();
+            else
+                shift = Offset::UNKNOWN;
+            val = GEP->getPointerOperand();
+        } else {
+            break;
+        }
+    }
+
+    return val;
+}
+
+} // anonymous namespace
+
+bool StoredPointerAnalysis::store(LLVMPointerAnalysis &PTA,
+                                  const llvm::Module *M,
+                                  const std::string &path) {
+    DBG_SECTION_BEGIN(pta, "Storing pointer analysis results to " << path);
+
+    ResultsWriter writer(M);
+    writer.addSets(PTA);
+
+    Header header;
+    memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = VERSION;
+    header.functionsNum = static_cast<uint32_t>(writer.functions.size());
+    header.pointersNum = static_cast<uint32_t>(writer.pointers.size());
+    header.setsNum = static_cast<uint32_t>(writer.sets.size());
+    header.valuesNum = static_cast<uint32_t>(writer.values.size());
+    header.namesSize = static_cast<uint32_t>(writer.names.size());
+    header.globalsFingerprint = getGlobalsFingerprint(M);
+
+    std::ofstream out(path, std::ios::binary);
+    out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    writeArray(out, writer.functions);
+    writeArray(out, writer.pointers);
+    writeArray(out, writer.sets);
+    writeArray(out, writer.values);
+    out.write(writer.names.data(),
+              static_cast<std::streamsize>(writer.names.size()));
+    out.close();
+
+    DBG_SECTION_END(pta, "Stored " << header.setsNum << " points-to sets");
+
+    if (!out) {
+        llvm::errs() << "Failed writing pointer analysis results to " << path
+                     << "\n";
+        return false;
+    }
+
+    return true;
+}
+
+bool StoredPointerAnalysis::load(const std::string &path) {
+    using namespace llvm;
+
+    auto fail = [&path](const char *msg) {
+        llvm::errs() << "Failed loading pointer analysis results from " << path
+                     << ": " << msg << "\n";
+        return false;
+    };
+
+    auto buf = MemoryBuffer::getFile(path);
+    if (!buf)
+        return fail(buf.getError().message().c_str());
+    _buffer = std::move(buf.get());
+
+    const char *data = _buffer->getBufferStart();
+    const size_t size = _buffer->getBufferSize();
+    if (size < sizeof(Header))
+        return fail("the file is too short");
+    if (reinterpret_cast<uintptr_t>(data) % alignof(PointerEntry) != 0)
+        return fail("the file is not aligned in memory");
+
+    const auto *header = reinterpret_cast<const Header *>(data);
+    if (memcmp(header->magic, MAGIC, sizeof(MAGIC)) != 0)
+        return fail("not a file with pointer analysis results");
+    if (header->version != VERSION)
+        return fail("unsupported version of the file");
+
+    const size_t functionsStart = sizeof(Header);
+    const size_t pointersStart =
+            functionsStart + header->functionsNum * sizeof(FunctionEntry);
+    const size_t setsStart =
+            pointersStart + header->pointersNum * sizeof(PointerEntry);
+    const size_t valuesStart = setsStart + header->setsNum * sizeof(SetEntry);
+    const size_t namesStart =
+            valuesStart + header->valuesNum * sizeof(ValueEntry);
+    if (size != namesStart + header->namesSize || header->namesSize == 0 ||
+        data[size - 1] != '\0')
+        return fail("the file is corrupted");
+
+    const auto *functions =
+            reinterpret_cast<const FunctionEntry *>(data + functionsStart);
+    _pointers = reinterpret_cast<const PointerEntry *>(data + pointersStart);
+    const auto *sets = reinterpret_cast<const SetEntry *>(data + setsStart);
+    const auto *values = reinterpret_cast<const ValueEntry *>(data + valuesStart);
+    const char *names = data + namesStart;
+
+    // the module must have the same global variables and the same
+    // functions (in the same order) with the same instructions
+    if (header->globalsFingerprint != getGlobalsFingerprint(_module))
+        return fail("the results were computed for a different module");
+    uint32_t fidx = 0;
+    for (const auto &F : *_module) {
+        if (F.isDeclaration())
+            continue;
+        if (fidx == header->functionsNum)
+            return fail("the results were computed for a different module");
+        const FunctionEntry &FE = functions[fidx++];
+        if (FE.name >= header->namesSize)
+            return fail("the file is corrupted");
+        if (F.getName() != names + FE.name ||
+            FE.fingerprint != getFingerprint(F))
+            return fail("the results were computed for a different module");
+    }
+    if (fidx != header->functionsNum)
+        return fail("the results were computed for a different module");
+
+    // resolve the values, the instructions of the functions
+    // are gathered only for the functions that we need
+    std::unordered_map<const Function *, std::vector<const Instruction *>>
+            instructions;
+    _values.clear();
+    _values.reserve(header->valuesNum);
+    for (uint32_t i = 0; i < header->valuesNum; ++i) {
+        const ValueEntry &V = values[i];
+        if (V.name >= header->namesSize)
+            return fail("the file is corrupted");
+        const char *name = names + V.name;
+
+        const Value *val = nullptr;
+        if (V.kind == GLOBAL) {
+            if (*name == '\0')
+                val = getGlobalVariable(_module, V.index);
+            else
+                val = _module->getNamedValue(name);
+        } else if (const auto *F = _module->getFunction(name)) {
+            if (V.kind == ARGUMENT && V.index < F->arg_size()) {
+                val = &*std::next(F->arg_begin(), V.index);
+            } else if (V.kind == INSTRUCTION) {
+                auto &insts = instructions[F];
+                if (insts.empty()) {
+                    for (auto I = inst_begin(F), E = inst_end(F); I != E; ++I)
+                        insts.push_back(&*I);
+                }
+                if (V.index < insts.size())
+                    val = insts[V.index];
+            }
+        }
+
+        if (!val)
+            return fail("the results were computed for a different module");
+        _values.push_back(val);
+    }
+
+    for (uint32_t i = 0; i < header->pointersNum; ++i) {
+        if (_pointers[i].value >= header->valuesNum)
+            return fail("the file is corrupted");
+    }
+
+    _sets.clear();
+    _sets.reserve(header->setsNum);
+    for (uint32_t i = 0; i < header->setsNum; ++i) {
+        const SetEntry &S = sets[i];
+        if (S.value >= header->valuesNum || S.first > header->pointersNum ||
+            S.num > header->pointersNum - S.first)
+            return fail("the file is corrupted");
+        _sets[_values[S.value]] = &S;
+    }
+
+    DBG(pta, "Loaded " << header->setsNum << " points-to sets from " << path);
+    return true;
+}
+
+const StoredPointerAnalysis::SetEntry *
+StoredPointerAnalysis::getSet(const llvm::Value *val, Offset &shift) const {
+    shift = 0;
+    if (llvm::isa<llvm::ConstantExpr>(val))
+        val = stripConstantExpr(val, _module->getDataLayout(), shift);
+
+    auto it = _sets.find(val);
+    return it == _sets.end() ? nullptr : it->second;
+}
+
+std::pair<bool, LLVMPointsToSet>
+StoredPointerAnalysis::getLLVMPointsToChecked(const llvm::Value *val) {
+    Offset shift;
+    if (const auto *S = getSet(val, shift)) {
+        auto *pts = new StoredLLVMPointsToSet(_pointers + S->first,
+                                              _pointers + S->first + S->num,
+                                              _values, S->flags, S->size,
+                                              shift);
+        return {true, pts->toLLVMPointsToSet()};
+    }
+
+    // the same as the constants in the pointer graph
+    if (llvm::isa<llvm::ConstantPointerNull>(val) ||
+        llvmutils::isConstantZero(val)) {
+        auto *pts = new StoredLLVMPointsToSet(nullptr, nullptr, _values,
+                                              NULLPTR, 1);
+        return {true, pts->toLLVMPointsToSet()};
+    }
+
+    auto *pts = new StoredLLVMPointsToSet(nullptr, nullptr, _values, UNKNOWN,
+                                          1);
+    return {llvm::isa<llvm::Constant>(val), pts->toLLVMPointsToSet()};
+}
+
+bool StoredPointerAnalysis::hasPointsTo(const llvm::Value *val) {
+    return getLLVMPointsToChecked(val).first;
+}
+
+LLVMPointsToSet StoredPointerAnalysis::getLLVMPointsTo(const llvm::Value *val) {
+    return std::move(getLLVMPointsToChecked(val).second);
+}
+
+bool StoredPointerAnalysis::run() {
+    if (!load(options.storedResults)) {
+        llvm::errs() << "Pointer analysis results were not loaded, aborting\n";
+        abort();
+    }
+
+    return true;
+}
+
+} // namespace dg
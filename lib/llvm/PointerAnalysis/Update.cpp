@@ -0,0 +1,263 @@
+#include <algorithm>
+#include <cassert>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+#include <llvm/IR/Function.h>
+#include <llvm/IR/Instructions.h>
+
+#include "dg/llvm/PointerAnalysis/PointerGraph.h"
+#include "dg/util/debug.h"
+
+namespace dg {
+namespace pta {
+
+// can the node stay in the graph when some of its operands are removed?
+// These nodes just gather pointers from their operands.
+static bool canLoseOperand(const PSNode *nd) {
+    return nd->getType() == PSNodeType::PHI ||
+           nd->getType() == PSNodeType::CALL_RETURN;
+}
+
+void LLVMPointerGraphBuilder::removeNodes(const std::set<PSNode *> &nodes) {
+    for (auto it = nodes_map.begin(); it != nodes_map.end();) {
+        bool removed = false;
+        for (PSNode *nd : it->second) {
+            if (nodes.count(nd) > 0) {
+                removed = true;
+                break;
+            }
+        }
+
+        if (removed)
+            it = nodes_map.erase(it);
+        else
+            ++it;
+    }
+
+    // remove the call and return edges
+    for (PSNode *nd : nodes) {
+        if (PSNodeCall *C = PSNodeCall::get(nd)) {
+            for (PointerSubgraph *callee : C->getCallees())
+                PSNodeEntry::cast(callee->root)->removeCaller(nd);
+        } else if (PSNodeCallRet *CR = PSNodeCallRet::get(nd)) {
+            for (PSNode *ret : CR->getReturns())
+                PSNodeRet::get(ret)->removeReturnSite(nd);
+        } else if (PSNodeRet *R = PSNodeRet::get(nd)) {
+            for (PSNode *site : R->getReturnSites())
+                PSNodeCallRet::get(site)->removeReturn(nd);
+        }
+    }
+
+    for (PSNode *nd : nodes) {
+        // copy the users, we change them
+        auto users = nd->getUsers();
+        for (PSNode *user : users) {
+            if (nodes.count(user) == 0)
+                user->removeOperand(nd);
+        }
+    }
+
+    for (PSNode *nd : nodes) {
+        nd->removeAllOperands();
+        nd->removeAllEdges();
+    }
+
+    for (PSNode *nd : nodes)
+        PS.remove(nd);
+}
+
+bool LLVMPointerGraphBuilder::updateFunctions(
+        const FunctionsT &changed, const FunctionsT &added,
+        const FunctionsT &removed,
+        const std::function<void(const std::set<PSNode *> &)> &invalidate) {
+    // we do not know how to remove fork and join nodes
+    // and the nodes merged by the analysis
+    if (threads_ || invalidate_nodes || !PS.getMergedNodes().empty())
+        return false;
+
+    assert(ad_hoc_building && "Updating a graph that is not built");
+
+    std::unordered_map<const PointerSubgraph *, const llvm::Function *>
+            functions;
+    for (auto &it : subgraphs_map)
+        functions.emplace(it.second, it.first);
+
+    // the changed functions that we have built
+    std::set<const llvm::Function *> rebuild;
+    for (const auto *F : changed) {
+        // a function that lost its body must be removed
+        // from the graph together with its callers
+        if (F->isDeclaration())
+            return false;
+        if (getSubgraph(F))
+            rebuild.insert(F);
+    }
+
+    // the calls of a newly defined function were built
+    // as calls of an undefined function, so build the callers again
+    for (const auto *F : added) {
+        for (const auto *U : F->users()) {
+            const auto *CI = llvm::dyn_cast<llvm::CallInst>(U);
+            if (!CI || CI->getCalledFunction() != F)
+                continue;
+            const auto *caller = CI->getParent()->getParent();
+            if (getSubgraph(caller))
+                rebuild.insert(caller);
+        }
+    }
+
+    // the direct calls of removed functions must be gone
+    std::vector<std::pair<const llvm::Function *, PointerSubgraph *>> gone;
+    for (const auto *F : removed) {
+        auto it = subgraphs_map.find(F);
+        if (it == subgraphs_map.end())
+            continue;
+        if (it->second == PS.getEntry())
+            return false;
+
+        gone.emplace_back(F, it->second);
+    }
+
+    for (auto &it : gone) {
+        for (PSNode *caller : PSNodeEntry::cast(it.second->root)->getCallers()) {
+            if (caller->getType() != PSNodeType::CALL)
+                continue;
+            const auto *callerF = functions[caller->getParent()];
+            if (std::find(removed.begin(), removed.end(), callerF) ==
+                removed.end())
+                rebuild.insert(callerF);
+        }
+    }
+
+    // gather the nodes of the changed and removed functions,
+    // that is, the nodes with the parent and the nodes reachable
+    // from these nodes (e.g., calls of undefined functions via pointers)
+    std::set<PointerSubgraph *> outdated;
+    for (const auto *F : rebuild)
+        outdated.insert(subgraphs_map[F]);
+    for (auto &it : gone)
+        outdated.insert(it.second);
+
+    std::set<PSNode *> nodes;
+    std::vector<PSNode *> queue;
+    auto addNode = [&nodes, &queue](PSNode *nd) {
+        if (nodes.insert(nd).second)
+            queue.push_back(nd);
+    };
+
+    for (const auto &nd : PS.getNodes()) {
+        if (nd && outdated.count(nd->getParent()) > 0 &&
+            nd->getParent()->root != nd.get())
+            addNode(nd.get());
+    }
+    for (const auto *subg : outdated) {
+        for (PSNode *succ : subg->root->successors())
+            addNode(succ);
+    }
+    while (!queue.empty()) {
+        PSNode *cur = queue.back();
+        queue.pop_back();
+        for (PSNode *succ : cur->successors())
+            addNode(succ);
+    }
+
+    // the removed functions and the constants that point to them
+    for (const auto *F : removed) {
+        auto it = nodes_map.find(F);
+        if (it == nodes_map.end())
+            continue;
+        PSNode *func = it->second.getFirst();
+        nodes.insert(func);
+        for (PSNode *user : func->getUsers()) {
+            if (user->getType() == PSNodeType::CONSTANT)
+                nodes.insert(user);
+        }
+    }
+
+    // the nodes that stay in the graph must stay well-formed
+    for (PSNode *nd : nodes) {
+        for (PSNode *user : nd->getUsers()) {
+            if (nodes.count(user) == 0 && !canLoseOperand(user))
+                return false;
+        }
+    }
+
+    DBG_SECTION_BEGIN(pta, "Updating the pointer graph, removing "
+                                   << nodes.size() << " nodes");
+
+    invalidate(nodes);
+
+    for (const auto *F : rebuild) {
+        PointerSubgraph *subg = subgraphs_map[F];
+        subgraphs_map.erase(F);
+        detached_subgraphs[F] = subg;
+        _funcInfo.erase(F);
+        // the calls will be registered again when building the function
+        if (auto *seq = getNodes(F))
+            PS.getCallGraph().removeCalls(seq->getFirst());
+    }
+
+    for (auto &it : gone) {
+        PointerSubgraph *subg = it.second;
+        // the calls via pointers from the unchanged functions
+        auto *root = PSNodeEntry::cast(subg->root);
+        auto callers = root->getCallers();
+        for (PSNode *caller : callers) {
+            if (nodes.count(caller) == 0) {
+                PSNodeCall::cast(caller)->removeCallee(subg);
+                root->removeCaller(caller);
+            }
+        }
+
+        subgraphs_map.erase(it.first);
+        _funcInfo.erase(it.first);
+        if (auto *seq = getNodes(it.first))
+            PS.getCallGraph().remove(seq->getFirst());
+    }
+
+    removeNodes(nodes);
+
+    for (auto *subg : outdated) {
+        subg->returnNodes.clear();
+        subg->vararg = nullptr;
+        subg->resetLoops();
+    }
+
+    // build the changed functions (some of them may have been built
+    // already as they are called from other changed functions)
+    for (const auto *F : rebuild) {
+        if (detached_subgraphs.count(F) > 0)
+            createOrGetSubgraph(F);
+    }
+    assert(detached_subgraphs.empty());
+
+    // connect the rebuilt functions with the unchanged callers
+    for (const auto *F : rebuild) {
+        PointerSubgraph *subg = getSubgraph(F);
+        addInterproceduralOperands(F, *subg);
+
+        auto callers = PSNodeEntry::cast(subg->root)->getCallers();
+        for (PSNode *caller : callers) {
+            if (caller->getType() != PSNodeType::CALL_FUNCPTR)
+                continue;
+            addInterproceduralOperands(F, *subg,
+                                       caller->getUserData<llvm::CallInst>(),
+                                       caller);
+        }
+    }
+
+#ifndef NDEBUG
+    if (!validateSubgraph(true)) {
+        llvm::errs() << "Pointer Subgraph is broken after the update!\n";
+        abort();
+    }
+#endif // NDEBUG
+
+    DBG_SECTION_END(pta, "Updating the pointer graph done");
+    return true;
+}
+
+} // namespace pta
+} // namespace dg
@@ -1,5 +1,8 @@
 #include <catch2/catch.hpp>
 
+#include <algorithm>
+#include <vector>
+
 #include "dg/ADT/Bitvector.h"
 #include "dg/ADT/Queue.h"
 #include "dg/ReadWriteGraph/DefSite.h"
@@ -182,3 +185,138 @@ TEST_CASE("TSL Hopscotch collision test", "HashMap") {
     hashCollisionTest<dg::HopscotchHashMap<MyInt, int>>();
 }
 #endif
+
+#include "dg/ADT/PersistentMap.h"
+
+TEST_CASE("Persistent map basic manip", "PersistentMap") {
+    PersistentMap<int, int> M;
+    REQUIRE(M.empty());
+    REQUIRE(M.find(1) == nullptr);
+
+    for (int i = 0; i < 1000; ++i)
+        REQUIRE(M.set(i, i));
+    REQUIRE(M.size() == 1000);
+    // setting the same value does not change the map
+    REQUIRE(!M.set(7, 7));
+
+    auto M2 = M;
+    REQUIRE(M2.same(M));
+    REQUIRE(M2.set(7, 8));
+    REQUIRE(M2.set(1000, 1000));
+    REQUIRE(!M2.same(M));
+
+    // the original map did not change
+    REQUIRE(M.size() == 1000);
+    REQUIRE(*M.find(7) == 7);
+    REQUIRE(M.find(1000) == nullptr);
+    REQUIRE(M2.size() == 1001);
+    REQUIRE(*M2.find(7) == 8);
+    REQUIRE(*M2.find(1000) == 1000);
+
+    for (int i = 0; i < 1000; ++i) {
+        if (i != 7)
+            REQUIRE(*M2.find(i) == i);
+    }
+
+    int sum = 0;
+    M.forEach([&sum](int k, int v) {
+        REQUIRE(k == v);
+        sum += v;
+    });
+    REQUIRE(sum == 999 * 1000 / 2);
+}
+
+TEST_CASE("Persistent map differences", "PersistentMap") {
+    PersistentMap<int, int> M;
+    for (int i = 0; i < 1000; ++i)
+        M.set(i, i);
+
+    auto M2 = M;
+    M2.set(3, 4);
+    M2.set(2000, 1);
+
+    std::vector<std::pair<int, int>> diff;
+    M.forEachDifferent(M2, [&](int k, int v, const int *my) {
+        diff.emplace_back(k, v);
+        if (k == 3)
+            REQUIRE(*my == 3);
+        else
+            REQUIRE(my == nullptr);
+        // changing the map during the walk
+        M.set(k, v);
+    });
+
+    std::sort(diff.begin(), diff.end());
+    REQUIRE(diff == std::vector<std::pair<int, int>>{{3, 4}, {2000, 1}});
+    REQUIRE(*M.find(3) == 4);
+    REQUIRE(*M.find(2000) == 1);
+
+    diff.clear();
+    M.forEachDifferent(M2, [&](int k, int v, const int * /*unused*/) {
+        diff.emplace_back(k, v);
+    });
+    REQUIRE(diff.empty());
+}
+
+TEST_CASE("Persistent map collision test", "PersistentMap") {
+    PersistentMap<MyInt, int> M;
+    for (int i = 0; i < 10; ++i)
+        REQUIRE(M.set(MyInt(i), i));
+    REQUIRE(M.size() == 10);
+
+    auto M2 = M;
+    REQUIRE(M2.set(MyInt(4), 5));
+    REQUIRE(!M2.set(MyInt(5), 5));
+    for (int i = 0; i < 10; ++i) {
+        REQUIRE(*M.find(MyInt(i)) == i);
+        REQUIRE(*M2.find(MyInt(i)) == (i == 4 ? 5 : i));
+    }
+
+    int diffs = 0;
+    M.forEachDifferent(M2, [&diffs](const MyInt &k, int v, const int *my) {
+        REQUIRE(k.x == 4);
+        REQUIRE(v == 5);
+        REQUIRE(*my == 4);
+        ++diffs;
+    });
+    REQUIRE(diffs == 1);
+}
+
+#include "dg/ADT/Arena.h"
+
+namespace {
+struct Tracked {
+    std::vector<int> &destroyed;
+    int id;
+    Tracked(std::vector<int> &d, int i) : destroyed(d), id(i) {}
+    ~Tracked() { destroyed.push_back(id); }
+};
+} // namespace
+
+TEST_CASE("Arena allocation", "Arena") {
+    std::vector<int> destroyed;
+    {
+        Arena arena(128);
+        for (int i = 0; i < 100; ++i) {
+            auto *t = arena.create<Tracked>(destroyed, i);
+            REQUIRE(t->id == i);
+            REQUIRE(reinterpret_cast<uintptr_t>(t) % alignof(Tracked) == 0);
+
+            auto *c = arena.create<char>('a');
+            REQUIRE(*c == 'a');
+            auto *d = arena.create<double>(1.5);
+            REQUIRE(reinterpret_cast<uintptr_t>(d) % alignof(double) == 0);
+            REQUIRE(*d == 1.5);
+        }
+        // bigger than a chunk
+        auto *big = static_cast<char *>(arena.allocate(1000));
+        std::fill(big, big + 1000, 'x');
+        REQUIRE(arena.capacity() >= 1000);
+        REQUIRE(destroyed.empty());
+    }
+
+    // everything was destroyed in the reverse order
+    REQUIRE(destroyed.size() == 100);
+    for (int i = 0; i < 100; ++i)
+        REQUIRE(destroyed[i] == 99 - i);
+}
@@ -1,10 +1,16 @@
 #include <catch2/catch.hpp>
 
+#include <algorithm>
+#include <iterator>
 #include <random>
 #include <set>
+#include <vector>
 
+#include "dg/ADT/BitsKernels.h"
 #include "dg/ADT/Bitvector.h"
+#include "dg/ADT/BlockBitvector.h"
 
+using dg::ADT::BlockSparseBitvector;
 using dg::ADT::SparseBitvector;
 
 TEST_CASE("Querying empty set", "SparseBitvector") {
@@ -205,3 +211,124 @@ TEST_CASE("Merge random bitvectors (union)", "SparseBitvector") {
     //    B2.merge(B1);
     //    REQUIRE(B1 == B2);
 }
+
+static std::vector<uint64_t> toVector(const BlockSparseBitvector &B) {
+    std::vector<uint64_t> elems;
+    for (auto x : B)
+        elems.push_back(x);
+    return elems;
+}
+
+TEST_CASE("Block bitvector set and unset", "BlockSparseBitvector") {
+    BlockSparseBitvector B;
+    REQUIRE(B.empty());
+    REQUIRE(B.begin() == B.end());
+
+    for (uint64_t i : {uint64_t{0}, uint64_t{1}, uint64_t{63}, uint64_t{64},
+                       uint64_t{255}, uint64_t{256}, uint64_t{100000},
+                       ~uint64_t{0}}) {
+        REQUIRE(B.get(i) == false);
+        REQUIRE(B.set(i) == false);
+        REQUIRE(B.get(i) == true);
+        REQUIRE(B.set(i) == true);
+    }
+    REQUIRE(B.size() == 8);
+
+    REQUIRE(toVector(B) == std::vector<uint64_t>({0, 1, 63, 64, 255, 256, 100000,
+                                            ~uint64_t{0}}));
+
+    REQUIRE(B.unset(64) == true);
+    REQUIRE(B.unset(64) == false);
+    REQUIRE(B.unset(100000) == true);
+    REQUIRE(B.unset(~uint64_t{0}) == true);
+    REQUIRE(B.size() == 5);
+    for (uint64_t i : {0, 1, 63, 255, 256})
+        REQUIRE(B.unset(i) == true);
+    REQUIRE(B.empty());
+}
+
+TEST_CASE("Block bitvector random union and intersection",
+          "BlockSparseBitvector") {
+    std::default_random_engine generator;
+    // small range so that the bitvectors share some blocks
+    std::uniform_int_distribution<uint64_t> distribution(0, 5000);
+
+    for (int round = 0; round < 20; ++round) {
+        BlockSparseBitvector B1;
+        BlockSparseBitvector B2;
+        std::set<uint64_t> S1;
+        std::set<uint64_t> S2;
+        for (int i = 0; i < 300; ++i) {
+            auto x = distribution(generator);
+            auto y = distribution(generator);
+            B1.set(x);
+            S1.insert(x);
+            B2.set(y);
+            S2.insert(y);
+        }
+
+        std::set<uint64_t> U;
+        std::set_union(S1.begin(), S1.end(), S2.begin(), S2.end(),
+                       std::inserter(U, U.end()));
+        std::set<uint64_t> I;
+        std::set_intersection(S1.begin(), S1.end(), S2.begin(), S2.end(),
+                              std::inserter(I, I.end()));
+
+        auto Bu = B1;
+        REQUIRE(Bu.includes(B1));
+        REQUIRE(Bu.includes(B2) == (U == S1));
+        REQUIRE(Bu.set(B2) == (U != S1));
+        REQUIRE(toVector(Bu) == std::vector<uint64_t>(U.begin(), U.end()));
+        REQUIRE(Bu.size() == U.size());
+        REQUIRE(Bu.includes(B1));
+        REQUIRE(Bu.includes(B2));
+        // nothing new now
+        REQUIRE(Bu.set(B1) == false);
+        REQUIRE(Bu.set(B2) == false);
+
+        auto Bi = B1;
+        REQUIRE(Bi.intersect(B2) == (I != S1));
+        REQUIRE(toVector(Bi) == std::vector<uint64_t>(I.begin(), I.end()));
+        REQUIRE(Bi.intersect(B2) == false);
+        REQUIRE(B1.includes(Bi));
+        REQUIRE(B2.includes(Bi));
+    }
+}
+
+TEST_CASE("Bits kernels", "BlockSparseBitvector") {
+    using namespace dg::ADT::kernels;
+
+    std::default_random_engine generator;
+    std::uniform_int_distribution<uint64_t> distribution(0, ~uint64_t{0});
+
+    // odd length to test also the tails of the SIMD kernels
+    const size_t N = 13;
+    std::vector<uint64_t> A(N), B(N);
+    for (size_t i = 0; i < N; ++i) {
+        A[i] = distribution(generator);
+        B[i] = distribution(generator) & A[i];
+    }
+    // B has a bit that A does not have only in the last word
+    B[N - 1] |= ~A[N - 1] & -~A[N - 1];
+
+    for (ISA isa : {ISA::SCALAR, ISA::SSE41, ISA::AVX2}) {
+        if (!isSupported(isa))
+            continue;
+
+        REQUIRE(hasNewBits(A.data(), B.data(), N, isa));
+        REQUIRE(!hasNewBits(A.data(), B.data(), N - 1, isa));
+        REQUIRE(!hasNewBits(A.data(), A.data(), N, isa));
+
+        auto R = A;
+        REQUIRE(orWords(R.data(), B.data(), N, isa));
+        for (size_t i = 0; i < N; ++i)
+            REQUIRE(R[i] == (A[i] | B[i]));
+        REQUIRE(!orWords(R.data(), B.data(), N, isa));
+
+        R = A;
+        REQUIRE(andWords(R.data(), B.data(), N, isa));
+        for (size_t i = 0; i < N; ++i)
+            REQUIRE(R[i] == (A[i] & B[i]));
+        REQUIRE(!andWords(R.data(), B.data(), N, isa));
+    }
+}
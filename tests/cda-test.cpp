@@ -0,0 +1,128 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "ControlDependence/CDGraph.h"
+#include "ControlDependence/CompactCDGraph.h"
+#include "ControlDependence/DOD.h"
+#include "ControlDependence/DODNTSCD.h"
+#include "ControlDependence/NTSCD.h"
+#include "ControlDependence/NTSCDFast.h"
+
+using namespace dg;
+
+// a random graph where every node has at most two successors
+static void generateRandomGraph(CDGraph &G, unsigned seed, unsigned Vnum,
+                                unsigned Enum) {
+    std::vector<CDNode *> nodes{nullptr};
+    for (unsigned i = 0; i < Vnum; ++i) {
+        nodes.push_back(&G.createNode());
+    }
+
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<unsigned> ids(1, Vnum);
+    for (unsigned n = 0; Enum > 0 && n < 10 * Vnum; ++n) {
+        auto id1 = ids(rng);
+        if (nodes[id1]->successors().size() > 1)
+            continue;
+        G.addNodeSuccessor(*nodes[id1], *nodes[ids(rng)]);
+        --Enum;
+    }
+}
+
+TEST_CASE("Compact CD graph", "[cda]") {
+    // 1 -> 2 -> 3, 2 -> 2
+    CDGraph G;
+    auto &n1 = G.createNode();
+    auto &n2 = G.createNode();
+    auto &n3 = G.createNode();
+    G.addNodeSuccessor(n1, n2);
+    G.addNodeSuccessor(n2, n2);
+    G.addNodeSuccessor(n2, n3);
+
+    CompactCDGraph C(G);
+    REQUIRE(C.size() == 3);
+    REQUIRE(C.getIndex(&n2) == 1);
+    REQUIRE(C.successors(0).size() == 1);
+    REQUIRE(C.successors(0)[0] == 1);
+    REQUIRE(C.successors(1).size() == 2);
+    REQUIRE(C.successors(2).empty());
+    REQUIRE(C.predecessors(1).size() == 2);
+    REQUIRE(C.predicates() == std::vector<unsigned>{1});
+    REQUIRE(!C.isPredicate(0));
+}
+
+TEST_CASE("NTSCD of a loop", "[cda]") {
+    // 1 -> 2 -> 3, 2 -> 2
+    CDGraph G;
+    auto &n1 = G.createNode();
+    auto &n2 = G.createNode();
+    auto &n3 = G.createNode();
+    G.addNodeSuccessor(n1, n2);
+    G.addNodeSuccessor(n2, n2);
+    G.addNodeSuccessor(n2, n3);
+
+    for (unsigned threads : {1, 4}) {
+        auto result = NTSCD(threads).compute(G);
+        // 3 is not reached if the loop does not terminate
+        auto deps = result.first[&n3];
+        REQUIRE(std::vector<CDNode *>(deps.begin(), deps.end()) ==
+                std::vector<CDNode *>{&n2});
+        auto rdeps = result.second[&n2];
+        REQUIRE(std::find(rdeps.begin(), rdeps.end(), &n3) != rdeps.end());
+        REQUIRE(result.first[&n1].empty());
+    }
+}
+
+TEST_CASE("Parallel NTSCD and DOD are the same as sequential", "[cda]") {
+    for (unsigned seed = 0; seed < 20; ++seed) {
+        CDGraph G;
+        generateRandomGraph(G, seed, 100, 150);
+        INFO("seed " << seed);
+
+        REQUIRE(NTSCD(4).compute(G) == NTSCD().compute(G));
+        REQUIRE(NTSCD2(4).compute(G) == NTSCD2().compute(G));
+        REQUIRE(DOD(4).compute(G) == DOD().compute(G));
+        REQUIRE(DODNTSCD(4).compute(G) == DODNTSCD().compute(G));
+    }
+}
+
+TEST_CASE("Fast NTSCD of an infinite loop", "[cda]") {
+    // 1 -> 2 -> 3 -> 2, 2 -> 4 -> 4, 3 -> 5
+    CDGraph G;
+    auto &n1 = G.createNode();
+    auto &n2 = G.createNode();
+    auto &n3 = G.createNode();
+    auto &n4 = G.createNode();
+    auto &n5 = G.createNode();
+    G.addNodeSuccessor(n1, n2);
+    G.addNodeSuccessor(n2, n3);
+    G.addNodeSuccessor(n3, n2);
+    G.addNodeSuccessor(n2, n4);
+    G.addNodeSuccessor(n4, n4);
+    G.addNodeSuccessor(n3, n5);
+
+    auto result = NTSCDFast().compute(G);
+    REQUIRE(result == NTSCD().compute(G));
+    REQUIRE(result.first[&n1].empty());
+    auto n4deps = result.first[&n4];
+    REQUIRE(std::vector<CDNode *>(n4deps.begin(), n4deps.end()) ==
+            std::vector<CDNode *>{&n2});
+    auto deps = result.first[&n5];
+    REQUIRE(std::vector<CDNode *>(deps.begin(), deps.end()) ==
+            std::vector<CDNode *>{&n3});
+}
+
+TEST_CASE("Fast NTSCD is the same as NTSCD", "[cda]") {
+    // small graphs have many loops without exits
+    for (unsigned seed = 0; seed < 2000; ++seed) {
+        CDGraph G;
+        const unsigned Vnum = 1 + seed % 30;
+        generateRandomGraph(G, seed, Vnum, Vnum * (2 + seed % 4) / 3);
+        INFO("seed " << seed);
+
+        REQUIRE(NTSCDFast().compute(G) == NTSCD().compute(G));
+    }
+}
@@ -0,0 +1,66 @@
+#!/usr/bin/env python3
+
+# Smoke test of exporting def-use pairs from llvm-dda-dump
+# (run from the directory with the tools)
+
+from os.path import join
+from struct import iter_unpack
+from subprocess import DEVNULL, run
+from sys import exit
+from tempfile import TemporaryDirectory
+
+# IDs: @g = 0, then the instructions of main from 1
+CODE = """
+@g = global i32 0
+
+define i32 @main() {
+entry:
+  %n = load i32, i32* @g
+  store i32 1, i32* @g
+  %c = icmp eq i32 %n, 0
+  br i1 %c, label %a, label %b
+a:
+  store i32 2, i32* @g
+  br label %b
+b:
+  %v = load i32, i32* @g
+  ret i32 %v
+}
+"""
+
+# the last load reads the values of both stores
+EXPECTED = [(7, 2), (7, 5)]
+
+
+def export(tmp, code, binary):
+    src = join(tmp, 'code.ll')
+    with open(src, 'w') as f:
+        f.write(code)
+
+    out = join(tmp, 'out')
+    cmd = ['./llvm-dda-dump', '-export-def-use', out, src]
+    if binary:
+        cmd.append('-export-binary')
+    if run(cmd, stdout=DEVNULL).returncode != 0:
+        print(f"Running {' '.join(cmd)} failed")
+        exit(1)
+
+    if binary:
+        with open(out, 'rb') as f:
+            return list(iter_unpack('<II', f.read()))
+    with open(out) as f:
+        return [tuple(map(int, line.split())) for line in f]
+
+
+failed = False
+with TemporaryDirectory() as tmp:
+    for binary in (False, True):
+        pairs = export(tmp, CODE, binary)
+        fmt = 'binary' if binary else 'text'
+        if sorted(pairs) != EXPECTED:
+            print(f"{fmt}\u001b[31m NOK\u001b[0m: {pairs} != {EXPECTED}")
+            failed = True
+        else:
+            print(f"{fmt}\u001b[32m OK\u001b[0m")
+
+exit(failed)
@@ -1,16 +1,19 @@
 #include <catch2/catch.hpp>
 
 #include <random>
+#include <set>
 #include <sstream>
 #include <vector>
 
 #undef NDEBUG
 
 #include "dg/ADT/DisjunctiveIntervalMap.h"
+#include "dg/ADT/FlatDisjunctiveIntervalMap.h"
 #include "dg/Offset.h"
 
 using namespace dg;
 using dg::ADT::DisjunctiveIntervalMap;
+using dg::ADT::FlatDisjunctiveIntervalMap;
 
 static std::ostream &
 operator<<(std::ostream &os, const std::vector<std::tuple<int, int, int>> &v) {
@@ -573,3 +576,79 @@ TEST_CASE("Uncovered - regression 1", "DisjunctiveIntervalMap") {
     ret = M.uncovered(0, 3);
     REQUIRE(ret.empty());
 }
+
+// check that the flat map has the same structure and answers
+// the same queries as the std::map-based one
+template <typename MapT, typename FlatMapT>
+static void checkSame(const MapT &M, const FlatMapT &F) {
+    REQUIRE(M.size() == F.size());
+    auto fit = F.begin();
+    for (const auto &it : M) {
+        REQUIRE(it.first == fit->first);
+        REQUIRE(std::vector<int>(it.second.begin(), it.second.end()) ==
+                std::vector<int>(fit->second.begin(), fit->second.end()));
+        ++fit;
+    }
+}
+
+TEST_CASE("Flat map is the same as map", "FlatDisjunctiveIntervalMap") {
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> bound(0, 40);
+    std::uniform_int_distribution<int> val(0, 5);
+
+    for (int round = 0; round < 100; ++round) {
+        DisjunctiveIntervalMap<int, int> M;
+        FlatDisjunctiveIntervalMap<int, int> F;
+
+        for (int i = 0; i < 30; ++i) {
+            int a = bound(gen);
+            int b = bound(gen);
+            if (a > b)
+                std::swap(a, b);
+            int v = val(gen);
+
+            if (i % 3 == 0) {
+                REQUIRE(M.update(a, b, v) == F.update(a, b, v));
+            } else {
+                REQUIRE(M.add(a, b, v) == F.add(a, b, v));
+            }
+            checkSame(M, F);
+
+            int qa = bound(gen);
+            int qb = bound(gen);
+            if (qa > qb)
+                std::swap(qa, qb);
+            REQUIRE(M.overlaps(qa, qb) == F.overlaps(qa, qb));
+            REQUIRE(M.overlapsFull(qa, qb) == F.overlapsFull(qa, qb));
+            REQUIRE(M.gather(qa, qb) == F.gather(qa, qb));
+            REQUIRE(M.uncovered(qa, qb) == F.uncovered(qa, qb));
+        }
+    }
+}
+
+TEST_CASE("Flat map with offsets", "FlatDisjunctiveIntervalMap") {
+    FlatDisjunctiveIntervalMap<int> F;
+    using IntT = decltype(F)::IntervalT;
+
+    F.add(0, Offset::UNKNOWN, 1);
+    F.update(4, 7, 2);
+    REQUIRE(F.size() == 3);
+    REQUIRE(F.overlapsFull(0, Offset::UNKNOWN));
+    REQUIRE(F.gather(4, 7) == std::set<int>{2});
+    REQUIRE(F.gather(0, 4) == std::set<int>{1, 2});
+    REQUIRE(F.uncovered(0, Offset::UNKNOWN).empty());
+
+    F.add(8, Offset::UNKNOWN, 3);
+    REQUIRE(F.gather(8, 8) == std::set<int>{1, 3});
+    REQUIRE(F.addAll(4));
+    REQUIRE(F.gather(0, 0) == std::set<int>{1, 4});
+
+    FlatDisjunctiveIntervalMap<int> G;
+    G.add(2, 5, 1);
+    G.add(2, 5, 2);
+    auto I = F.intersection(G);
+    REQUIRE(I.size() == 2);
+    REQUIRE(I.begin()->first == IntT{2, 3});
+    REQUIRE(I.gather(2, 3) == std::set<int>{1});
+    REQUIRE(I.gather(4, 5) == std::set<int>{2});
+}
@@ -0,0 +1,103 @@
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "dg/ADT/DisjunctiveIntervalMap.h"
+#include "dg/ADT/FlatDisjunctiveIntervalMap.h"
+#include "dg/util/TimeMeasure.h"
+
+using namespace dg;
+using namespace dg::ADT;
+
+// count the allocations
+static size_t allocations = 0;
+
+void *operator new(size_t size) {
+    ++allocations;
+    auto *mem = std::malloc(size);
+    if (!mem)
+        std::abort();
+    return mem;
+}
+
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+
+void operator delete(void *ptr, size_t /*unused*/) noexcept {
+    std::free(ptr);
+}
+
+///
+// Simulate what the data dependence analysis does with the maps:
+// every "block" has its own map that is filled by a sequence of (mostly
+// strong) updates of small objects, then the maps of the predecessors
+// are queried for definitions and for uncovered bytes.
+template <typename MapT>
+static size_t run(unsigned blocks, unsigned writes, const char *msg) {
+    std::mt19937 gen(1);
+    std::uniform_int_distribution<int> field(0, 15);
+    std::uniform_int_distribution<int> kind(0, 9);
+
+    size_t result = 0;
+    const size_t before = allocations;
+
+    dg::debug::TimeMeasure tm;
+    tm.start();
+    {
+        std::vector<MapT> maps(blocks);
+        for (unsigned b = 0; b < blocks; ++b) {
+            auto &M = maps[b];
+            for (unsigned w = 0; w < writes; ++w) {
+                Offset off = 4 * field(gen);
+                auto k = kind(gen);
+                if (k == 0) {
+                    // write to unknown offset
+                    M.add(0, Offset::UNKNOWN, w);
+                } else if (k < 3) {
+                    // weak update
+                    M.add(off, off + 3, w);
+                } else {
+                    M.update(off, off + 7, w);
+                }
+            }
+
+            // query the predecessor
+            if (b > 0) {
+                const auto &P = maps[b - 1];
+                for (unsigned q = 0; q < writes; ++q) {
+                    Offset off = 4 * field(gen);
+                    result += P.gather(off, off + 3).size();
+                    result += P.uncovered(off, off + 63).size();
+                }
+            }
+        }
+    }
+    tm.stop();
+
+    std::cout << " -- " << msg << ": " << (allocations - before)
+              << " allocations\n";
+    tm.report(std::string(" -- ") + msg + " took", std::cout);
+    return result;
+}
+
+static void compare(unsigned blocks, unsigned writes) {
+    std::cout << "Running " << blocks << " blocks, " << writes
+              << " writes per block\n";
+
+    auto map = run<DisjunctiveIntervalMap<unsigned>>(blocks, writes,
+                                                     "std::map intervals");
+    auto flat = run<FlatDisjunctiveIntervalMap<unsigned>>(blocks, writes,
+                                                          "flat intervals");
+    if (map != flat) {
+        std::cout << "The results differ!\n";
+        std::abort();
+    }
+}
+
+int main() {
+    compare(100000, 4);
+    compare(10000, 32);
+    compare(1000, 256);
+}
@@ -0,0 +1,204 @@
+#include <catch2/catch.hpp>
+
+#include <fstream>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <llvm/IR/Function.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Module.h>
+#include <llvm/IRReader/IRReader.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/SourceMgr.h>
+
+#include "dg/llvm/ControlDependence/ControlDependence.h"
+
+#include "ControlDependence/NTSCD.h"
+#include "llvm/ControlDependence/CDCache.h"
+
+using namespace dg;
+
+// two functions with the same control flow graph
+static const char *code = R"(
+define i32 @f(i32 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %body ]
+  %c = icmp slt i32 %i, %n
+  br i1 %c, label %body, label %exit
+body:
+  %inc = add i32 %i, 1
+  %d = icmp eq i32 %inc, 10
+  br i1 %d, label %inf, label %loop
+inf:
+  br label %inf
+exit:
+  ret i32 %i
+}
+
+define i32 @g(i32 %m) {
+entry:
+  br label %loop
+loop:
+  %j = phi i32 [ 0, %entry ], [ %dec, %body ]
+  %c = icmp sgt i32 %j, %m
+  br i1 %c, label %body, label %exit
+body:
+  %dec = sub i32 %j, 1
+  %d = icmp eq i32 %dec, 3
+  br i1 %d, label %inf, label %loop
+inf:
+  br label %inf
+exit:
+  ret i32 %j
+}
+)";
+
+static const std::string cacheDir = "llvm-cda-cache-test-dir";
+
+static std::unique_ptr<llvm::Module> parse(llvm::LLVMContext &ctx,
+                                           const char *code) {
+    llvm::SMDiagnostic err;
+    auto M = llvm::parseIR(llvm::MemoryBufferRef(code, "test"), err, ctx);
+    REQUIRE(M);
+    return M;
+}
+
+// the dependencies of blocks of a function by the names of blocks
+static std::map<std::string, std::set<std::string>>
+getDependencies(const llvm::Module *M, const char *fun,
+                const LLVMControlDependenceAnalysisOptions &opts) {
+    LLVMControlDependenceAnalysis CDA(M, opts);
+    std::map<std::string, std::set<std::string>> ret;
+    for (const auto &B : *M->getFunction(fun)) {
+        auto &deps = ret[B.getName().str()];
+        for (auto *dep : CDA.getDependencies(&B))
+            deps.insert(dep->getName().str());
+    }
+    return ret;
+}
+
+static unsigned getEntriesNum() {
+    unsigned num = 0;
+    std::error_code ec;
+    for (llvm::sys::fs::directory_iterator it(cacheDir, ec), et;
+         it != et && !ec; it.increment(ec))
+        ++num;
+    return num;
+}
+
+static void generateGraph(CDGraph &G) {
+    // 1 -> 2 -> 3 -> 2, 2 -> 4 -> 4, 3 -> 5
+    std::vector<CDNode *> nodes;
+    for (unsigned i = 0; i < 5; ++i)
+        nodes.push_back(&G.createNode());
+    G.addNodeSuccessor(*nodes[0], *nodes[1]);
+    G.addNodeSuccessor(*nodes[1], *nodes[2]);
+    G.addNodeSuccessor(*nodes[2], *nodes[1]);
+    G.addNodeSuccessor(*nodes[1], *nodes[3]);
+    G.addNodeSuccessor(*nodes[3], *nodes[3]);
+    G.addNodeSuccessor(*nodes[2], *nodes[4]);
+}
+
+TEST_CASE("Store and load a graph", "[cda-cache]") {
+    llvm::sys::fs::remove_directories(cacheDir);
+
+    CDGraph G;
+    generateGraph(G);
+    auto result = NTSCD().compute(G);
+
+    llvmdg::CDCache cache(cacheDir, 1);
+    CDResult CD, revCD;
+    REQUIRE(!cache.load(G, CD, revCD));
+    cache.store(G, result.first);
+    REQUIRE(getEntriesNum() == 1);
+
+    // the graph is equal, but it is a different object
+    CDGraph G2;
+    generateGraph(G2);
+    llvmdg::CDCache cache2(cacheDir, 1);
+    REQUIRE(cache2.load(G2, CD, revCD));
+    REQUIRE(cache2.getHits() == 1);
+    REQUIRE(CD.size() == result.first.size());
+    for (auto *nd : G2) {
+        auto deps = CD[nd];
+        auto expected = result.first[G.getNode(nd->getID())];
+        REQUIRE(deps.size() == expected.size());
+        for (size_t i = 0; i < deps.size(); ++i)
+            REQUIRE(deps.begin()[i]->getID() == expected.begin()[i]->getID());
+    }
+    REQUIRE(revCD == CD.reverse(G2));
+
+    // a different algorithm
+    llvmdg::CDCache cache3(cacheDir, 2);
+    REQUIRE(!cache3.load(G2, CD, revCD));
+    REQUIRE(cache3.getMisses() == 1);
+
+    // a different graph
+    G2.addNodeSuccessor(*G2.getNode(5), *G2.getNode(1));
+    REQUIRE(!cache2.load(G2, CD, revCD));
+
+    llvm::sys::fs::remove_directories(cacheDir);
+}
+
+TEST_CASE("Corrupted entries are ignored", "[cda-cache]") {
+    llvm::sys::fs::remove_directories(cacheDir);
+
+    CDGraph G;
+    generateGraph(G);
+    auto result = NTSCD().compute(G);
+    llvmdg::CDCache cache(cacheDir, 1);
+    cache.store(G, result.first);
+
+    std::error_code ec;
+    llvm::sys::fs::directory_iterator it(cacheDir, ec);
+    REQUIRE(!ec);
+    const std::string path = it->path();
+    std::ofstream(path, std::ios::binary | std::ios::app) << "garbage";
+
+    CDResult CD, revCD;
+    REQUIRE(!cache.load(G, CD, revCD));
+    std::ofstream(path, std::ios::binary | std::ios::trunc) << "garbage";
+    REQUIRE(!cache.load(G, CD, revCD));
+
+    // storing the results again fixes the entry
+    cache.store(G, result.first);
+    REQUIRE(cache.load(G, CD, revCD));
+    REQUIRE(CD == result.first);
+
+    llvm::sys::fs::remove_directories(cacheDir);
+}
+
+TEST_CASE("Cached results of functions", "[cda-cache]") {
+    llvm::sys::fs::remove_directories(cacheDir);
+
+    llvm::LLVMContext ctx;
+    auto M = parse(ctx, code);
+
+    using CDAlgorithm = ControlDependenceAnalysisOptions::CDAlgorithm;
+    for (auto algorithm : {CDAlgorithm::NTSCD, CDAlgorithm::NTSCD_FAST,
+                           CDAlgorithm::DOD, CDAlgorithm::DODNTSCD}) {
+        LLVMControlDependenceAnalysisOptions opts;
+        opts.algorithm = algorithm;
+        const auto expected = getDependencies(M.get(), "f", opts);
+        if (algorithm == CDAlgorithm::NTSCD)
+            REQUIRE(expected.at("inf") == std::set<std::string>{"body"});
+
+        opts.cacheDir = cacheDir;
+        const auto entries = getEntriesNum();
+        // the first run fills the cache, the second uses it
+        REQUIRE(getDependencies(M.get(), "f", opts) == expected);
+        REQUIRE(getEntriesNum() == entries + 1);
+        REQUIRE(getDependencies(M.get(), "f", opts) == expected);
+        // 'g' has the same graph as 'f'
+        REQUIRE(getDependencies(M.get(), "g", opts) == expected);
+        REQUIRE(getEntriesNum() == entries + 1);
+    }
+
+    llvm::sys::fs::remove_directories(cacheDir);
+}
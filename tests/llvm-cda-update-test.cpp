@@ -0,0 +1,290 @@
+#include <catch2/catch.hpp>
+
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <llvm/IR/BasicBlock.h>
+#include <llvm/IR/Constants.h>
+#include <llvm/IR/Function.h>
+#include <llvm/IR/Instructions.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Module.h>
+#include <llvm/IRReader/IRReader.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/SourceMgr.h>
+
+#include "dg/llvm/ControlDependence/ControlDependence.h"
+#include "dg/llvm/LLVMDependenceGraphBuilder.h"
+#include "dg/llvm/LLVMSlicer.h"
+
+using namespace dg;
+
+static const char *code = R"(
+define i32 @f(i32 %n) {
+entry:
+  %c = icmp slt i32 %n, 0
+  br i1 %c, label %neg, label %loop
+neg:
+  br label %exit
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %body ]
+  %d = icmp slt i32 %i, %n
+  br i1 %d, label %body, label %exit
+body:
+  %inc = add i32 %i, 1
+  br label %loop
+exit:
+  ret i32 %n
+}
+)";
+
+static std::unique_ptr<llvm::Module> parse(llvm::LLVMContext &ctx,
+                                           const char *code) {
+    llvm::SMDiagnostic err;
+    auto M = llvm::parseIR(llvm::MemoryBufferRef(code, "test"), err, ctx);
+    REQUIRE(M);
+    return M;
+}
+
+static llvm::BasicBlock *getBlock(llvm::Function *F, const char *name) {
+    for (auto &B : *F) {
+        if (B.getName() == name)
+            return &B;
+    }
+    REQUIRE(false);
+    return nullptr;
+}
+
+// the dependencies of blocks of a function by the names of blocks
+static std::map<std::string, std::set<std::string>>
+getDependencies(LLVMControlDependenceAnalysis &CDA, const llvm::Function *F) {
+    std::map<std::string, std::set<std::string>> ret;
+    for (const auto &B : *F) {
+        auto &deps = ret[B.getName().str()];
+        for (auto *dep : CDA.getDependencies(&B))
+            deps.insert(dep->getName().str());
+    }
+    return ret;
+}
+
+static LLVMControlDependenceAnalysisOptions getStandardOptions() {
+    LLVMControlDependenceAnalysisOptions opts;
+    opts.algorithm = ControlDependenceAnalysisOptions::CDAlgorithm::STANDARD;
+    opts.interprocedural = false;
+    return opts;
+}
+
+static std::map<std::string, std::set<std::string>>
+getFreshDependencies(const llvm::Module *M, const llvm::Function *F,
+                     const LLVMControlDependenceAnalysisOptions &opts =
+                             getStandardOptions()) {
+    LLVMControlDependenceAnalysis CDA(M, opts);
+    return getDependencies(CDA, F);
+}
+
+// make the loop in 'f' infinite: loop -> body only
+static void makeLoopInfinite(llvm::Function *F) {
+    auto *loop = getBlock(F, "loop");
+    auto *br = llvm::cast<llvm::BranchInst>(loop->getTerminator());
+    llvm::BranchInst::Create(getBlock(F, "body"), br);
+    br->eraseFromParent();
+}
+
+TEST_CASE("Update standard CD after changes of edges", "[cda-update]") {
+    llvm::LLVMContext ctx;
+    auto M = parse(ctx, code);
+    auto *F = M->getFunction("f");
+
+    LLVMControlDependenceAnalysis CDA(M.get(), getStandardOptions());
+    CDA.compute();
+    REQUIRE(getDependencies(CDA, F).at("body") ==
+            std::set<std::string>{"loop"});
+
+    auto *entry = getBlock(F, "entry");
+    auto *neg = getBlock(F, "neg");
+    auto *loop = getBlock(F, "loop");
+    auto *body = getBlock(F, "body");
+    auto *exit = getBlock(F, "exit");
+
+    makeLoopInfinite(F);
+    CDA.updateCFG(F, {{CFGUpdate::Kind::DELETE, loop, exit}});
+    REQUIRE(getDependencies(CDA, F) == getFreshDependencies(M.get(), F));
+    REQUIRE(getDependencies(CDA, F).at("exit") ==
+            std::set<std::string>{"entry"});
+
+    // jump from the body also to the exit
+    auto *br = llvm::cast<llvm::BranchInst>(body->getTerminator());
+    llvm::BranchInst::Create(loop, exit,
+                             llvm::ConstantInt::getTrue(ctx), br);
+    br->eraseFromParent();
+    CDA.updateCFG(F, {{CFGUpdate::Kind::INSERT, body, exit}});
+    REQUIRE(getDependencies(CDA, F) == getFreshDependencies(M.get(), F));
+    REQUIRE(getDependencies(CDA, F).at("loop") ==
+            std::set<std::string>{"entry", "body"});
+
+    // more changes at once: entry -> exit instead of entry -> neg
+    // (neg is unreachable now)
+    llvm::cast<llvm::BranchInst>(entry->getTerminator())->setSuccessor(0, exit);
+    CDA.updateCFG(F, {{CFGUpdate::Kind::DELETE, entry, neg},
+                      {CFGUpdate::Kind::INSERT, entry, exit}});
+    REQUIRE(getDependencies(CDA, F) == getFreshDependencies(M.get(), F));
+}
+
+TEST_CASE("Invalidate standard CD after adding blocks", "[cda-update]") {
+    llvm::LLVMContext ctx;
+    auto M = parse(ctx, code);
+    auto *F = M->getFunction("f");
+
+    LLVMControlDependenceAnalysis CDA(M.get(), getStandardOptions());
+    CDA.compute();
+
+    // split the edge body -> loop by a new block
+    auto *loop = getBlock(F, "loop");
+    auto *body = getBlock(F, "body");
+    auto *latch = llvm::BasicBlock::Create(ctx, "latch", F);
+    auto *neg = getBlock(F, "neg");
+    llvm::BranchInst::Create(loop, neg, llvm::ConstantInt::getTrue(ctx),
+                             latch);
+    body->getTerminator()->setSuccessor(0, latch);
+    llvm::cast<llvm::PHINode>(&*loop->begin())->setIncomingBlock(1, latch);
+
+    CDA.invalidate(F);
+    REQUIRE(getDependencies(CDA, F) == getFreshDependencies(M.get(), F));
+    REQUIRE(getDependencies(CDA, F).at("latch") ==
+            std::set<std::string>{"loop"});
+    REQUIRE(getDependencies(CDA, F).at("loop") ==
+            std::set<std::string>{"entry", "latch"});
+}
+
+TEST_CASE("Forget results of other algorithms", "[cda-update]") {
+    using CDAlgorithm = ControlDependenceAnalysisOptions::CDAlgorithm;
+    struct Config {
+        CDAlgorithm algorithm;
+        bool icfg;
+    };
+    for (auto config : {Config{CDAlgorithm::NTSCD, false},
+                        Config{CDAlgorithm::NTSCD, true},
+                        Config{CDAlgorithm::NTSCD_FAST, true},
+                        Config{CDAlgorithm::DODNTSCD, false},
+                        Config{CDAlgorithm::DODNTSCD, true},
+                        Config{CDAlgorithm::NTSCD_LEGACY, false}}) {
+        llvm::LLVMContext ctx;
+        auto M = parse(ctx, code);
+        auto *F = M->getFunction("f");
+
+        LLVMControlDependenceAnalysisOptions opts;
+        opts.algorithm = config.algorithm;
+        opts._icfg = config.icfg;
+        LLVMControlDependenceAnalysis CDA(M.get(), opts);
+        const auto before = getDependencies(CDA, F);
+
+        // the default update is to forget the results
+        makeLoopInfinite(F);
+        CDA.updateCFG(F, {{CFGUpdate::Kind::DELETE, getBlock(F, "loop"),
+                           getBlock(F, "exit")}});
+        const auto after = getDependencies(CDA, F);
+        REQUIRE(after == getFreshDependencies(M.get(), F, opts));
+        INFO("algorithm " << static_cast<int>(config.algorithm)
+                          << ", ICFG " << config.icfg);
+        REQUIRE(after != before);
+    }
+}
+
+TEST_CASE("Forget results of strong control closure", "[cda-update]") {
+    llvm::LLVMContext ctx;
+    auto M = parse(ctx, code);
+    auto *F = M->getFunction("f");
+
+    LLVMControlDependenceAnalysisOptions opts;
+    opts.algorithm = ControlDependenceAnalysisOptions::CDAlgorithm::STRONG_CC;
+    opts.interprocedural = false;
+    LLVMControlDependenceAnalysis CDA(M.get(), opts);
+    const std::set<llvm::Value *> X{getBlock(F, "neg"), getBlock(F, "body")};
+    const auto before = CDA.getClosure(F, X);
+
+    makeLoopInfinite(F);
+    CDA.invalidate(F);
+    const auto after = CDA.getClosure(F, X);
+    LLVMControlDependenceAnalysis fresh(M.get(), opts);
+    const auto expected = fresh.getClosure(F, X);
+    REQUIRE(std::set<llvm::Value *>(after.begin(), after.end()) ==
+            std::set<llvm::Value *>(expected.begin(), expected.end()));
+    REQUIRE(std::set<llvm::Value *>(after.begin(), after.end()) !=
+            std::set<llvm::Value *>(before.begin(), before.end()));
+}
+
+static const char *slicedCode = R"(
+declare void @crit(i32)
+declare i32 @nondet()
+
+define i32 @main() {
+entry:
+  %n = call i32 @nondet()
+  %s = alloca i32
+  store i32 0, i32* %s
+  br label %loop
+loop:
+  %i = phi i32 [ 0, %entry ], [ %inc, %latch ]
+  %c = icmp slt i32 %i, %n
+  br i1 %c, label %body, label %exit
+body:
+  %m = call i32 @nondet()
+  %d = icmp eq i32 %m, 3
+  br i1 %d, label %then, label %else
+then:
+  %v = load i32, i32* %s
+  %v2 = add i32 %v, 1
+  store i32 %v2, i32* %s
+  br label %latch
+else:
+  %q = call i32 @nondet()
+  br label %latch
+latch:
+  %inc = add i32 %i, 1
+  br label %loop
+exit:
+  %f = load i32, i32* %s
+  call void @crit(i32 %f)
+  %k = call i32 @nondet()
+  %e = icmp eq i32 %k, 0
+  br i1 %e, label %inf, label %ret
+inf:
+  br label %inf
+ret:
+  ret i32 0
+}
+)";
+
+TEST_CASE("Update CD after slicing", "[cda-update]") {
+    llvm::LLVMContext ctx;
+    auto M = parse(ctx, slicedCode);
+    auto *F = M->getFunction("main");
+
+    LLVMControlDependenceAnalysis CDA(M.get(), getStandardOptions());
+    CDA.compute();
+
+    llvmdg::LLVMDependenceGraphBuilder builder(M.get());
+    auto dg = builder.build();
+    REQUIRE(dg);
+
+    LLVMNode *crit = nullptr;
+    for (auto &I : *getBlock(F, "exit")) {
+        if (auto *C = llvm::dyn_cast<llvm::CallInst>(&I)) {
+            if (C->getCalledFunction()->getName() == "crit")
+                crit = dg->getNode(C);
+        }
+    }
+    REQUIRE(crit);
+
+    llvmdg::LLVMSlicer slicer;
+    slicer.setRecordCFGChanges();
+    auto slid = slicer.mark(crit);
+    slicer.slice(dg.get(), nullptr, slid);
+    REQUIRE(slicer.getStatistics().blocksRemoved > 0);
+
+    slicer.updateControlDependencies(CDA);
+    REQUIRE(getDependencies(CDA, F) == getFreshDependencies(M.get(), F));
+}
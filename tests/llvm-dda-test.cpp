@@ -0,0 +1,360 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+
+#include <llvm/IR/Function.h>
+#include <llvm/IR/Instructions.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Module.h>
+#include <llvm/IRReader/IRReader.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/SourceMgr.h>
+
+#include "dg/MemorySSA/MemorySSA.h"
+#include "dg/llvm/DataDependence/DataDependence.h"
+#include "dg/llvm/PointerAnalysis/PointerAnalysis.h"
+
+using namespace dg;
+using namespace dg::dda;
+
+static const char *code = R"(
+@g = global i32 0
+@h = global i32 0
+
+define void @setg(i32 %v) {
+  store i32 %v, i32* @g
+  ret void
+}
+
+define i32 @loop(i32 %n) {
+entry:
+  %i = alloca i32
+  %s = alloca i32
+  store i32 0, i32* %i
+  store i32 0, i32* %s
+  br label %cond
+cond:
+  %iv = load i32, i32* %i
+  %c = icmp slt i32 %iv, %n
+  br i1 %c, label %body, label %end
+body:
+  %sv = load i32, i32* %s
+  %sn = add i32 %sv, %iv
+  store i32 %sn, i32* %s
+  %in = add i32 %iv, 1
+  store i32 %in, i32* %i
+  br label %cond
+end:
+  %r = load i32, i32* %s
+  ret i32 %r
+}
+
+define i32 @readg() {
+  %x = load i32, i32* @g
+  %y = load i32, i32* @h
+  %z = add i32 %x, %y
+  ret i32 %z
+}
+
+define i32 @main() {
+entry:
+  %a = alloca i32
+  %p = alloca i32*
+  store i32 1, i32* %a
+  store i32* %a, i32** %p
+  %l = call i32 @loop(i32 10)
+  call void @setg(i32 %l)
+  %c = icmp eq i32 %l, 0
+  br i1 %c, label %then, label %join
+then:
+  store i32 2, i32* %a
+  store i32 3, i32* @h
+  br label %join
+join:
+  %pv = load i32*, i32** %p
+  %av = load i32, i32* %pv
+  %av2 = load i32, i32* %a
+  %r = call i32 @readg()
+  ret i32 %r
+}
+)";
+
+static std::unique_ptr<llvm::Module> parse(llvm::LLVMContext &ctx,
+                                           const char *code) {
+    llvm::SMDiagnostic err;
+    auto M = llvm::parseIR(llvm::MemoryBufferRef(code, "test"), err, ctx);
+    REQUIRE(M);
+    return M;
+}
+
+static std::string toString(const llvm::Value *val) {
+    std::string str;
+    llvm::raw_string_ostream os(str);
+    os << *val;
+    return os.str();
+}
+
+// definitions of all loads in the module, if 'reverse' is set,
+// the loads are queried in the reverse order and each one twice
+static std::map<std::string, std::set<std::string>>
+getDefinitions(const llvm::Module *M, unsigned threads, bool reverse = false,
+               bool summaries = false, bool scalars = false) {
+    DGLLVMPointerAnalysis PTA(M);
+    PTA.run();
+
+    LLVMDataDependenceAnalysisOptions opts;
+    opts.eagerThreads = threads;
+    opts.summaries = summaries;
+    opts.scalarObjects = scalars;
+    LLVMDataDependenceAnalysis DDA(M, &PTA, opts);
+    DDA.run();
+
+    std::vector<const llvm::Instruction *> loads;
+    for (const auto &F : *M) {
+        for (const auto &B : F) {
+            for (const auto &I : B) {
+                if (llvm::isa<llvm::LoadInst>(I))
+                    loads.push_back(&I);
+            }
+        }
+    }
+    if (reverse)
+        std::reverse(loads.begin(), loads.end());
+
+    std::map<std::string, std::set<std::string>> ret;
+    for (const auto *I : loads) {
+        auto &defs = ret[I->getFunction()->getName().str() + ": " +
+                         toString(I)];
+        auto *use = const_cast<llvm::Instruction *>(I);
+        for (auto *def : DDA.getLLVMDefinitions(use)) {
+            defs.insert(toString(def));
+        }
+        if (reverse) {
+            std::set<std::string> again;
+            for (auto *def : DDA.getLLVMDefinitions(use)) {
+                again.insert(toString(def));
+            }
+            REQUIRE(again == defs);
+        }
+    }
+    return ret;
+}
+
+TEST_CASE("Eager definitions are the same as on-demand", "[dda]") {
+    llvm::LLVMContext ctx;
+    auto M = parse(ctx, code);
+
+    auto ondemand = getDefinitions(M.get(), 0);
+    REQUIRE(ondemand.size() == 8);
+    // every load reads some initialized memory
+    for (const auto &it : ondemand) {
+        INFO(it.first);
+        REQUIRE(!it.second.empty());
+    }
+
+    REQUIRE(getDefinitions(M.get(), 1) == ondemand);
+    REQUIRE(getDefinitions(M.get(), 4) == ondemand);
+}
+
+TEST_CASE("Definitions do not depend on the order of queries", "[dda]") {
+    llvm::LLVMContext ctx;
+    auto M = parse(ctx, code);
+
+    // querying in the reverse order creates phi nodes
+    // in between the queries of the same load
+    REQUIRE(getDefinitions(M.get(), 0, /* reverse = */ true) ==
+            getDefinitions(M.get(), 0));
+}
+
+TEST_CASE("Queries with a budget", "[dda]") {
+    llvm::LLVMContext ctx;
+    auto M = parse(ctx, code);
+    auto ondemand = getDefinitions(M.get(), 0);
+
+    for (size_t budget : {1, 2, 3, 5, 8, 100000}) {
+        DGLLVMPointerAnalysis PTA(M.get());
+        PTA.run();
+        LLVMDataDependenceAnalysis DDA(M.get(), &PTA);
+        DDA.run();
+
+        unsigned inexact = 0;
+        for (const auto &F : *M) {
+            for (const auto &B : F) {
+                for (const auto &I : B) {
+                    if (!llvm::isa<llvm::LoadInst>(I))
+                        continue;
+                    auto *use = const_cast<llvm::Instruction *>(&I);
+                    const auto &expected =
+                            ondemand[F.getName().str() + ": " + toString(&I)];
+                    INFO(budget << ": " << toString(&I));
+
+                    bool exact;
+                    std::set<std::string> defs;
+                    for (auto *def : DDA.getLLVMDefinitions(use, budget, exact))
+                        defs.insert(toString(def));
+                    if (exact) {
+                        REQUIRE(defs == expected);
+                    } else {
+                        // what we found are real definitions
+                        ++inexact;
+                        for (const auto &def : defs)
+                            REQUIRE(expected.count(def) > 0);
+                    }
+
+                    // the postponed search is finished by the query
+                    // without a budget
+                    defs.clear();
+                    for (auto *def : DDA.getLLVMDefinitions(use))
+                        defs.insert(toString(def));
+                    REQUIRE(defs == expected);
+                }
+            }
+        }
+
+        if (budget == 1)
+            REQUIRE(inexact > 0);
+        if (budget == 100000)
+            REQUIRE(inexact == 0);
+    }
+}
+
+TEST_CASE("LVN is performed only for blocks that queries reach", "[dda]") {
+    llvm::LLVMContext ctx;
+    auto M = parse(ctx, code);
+
+    DGLLVMPointerAnalysis PTA(M.get());
+    PTA.run();
+    LLVMDataDependenceAnalysis DDA(M.get(), &PTA);
+    DDA.run();
+
+    const auto *SSA = static_cast<MemorySSATransformation *>(
+            DDA.getDDA()->getImpl());
+    REQUIRE(SSA->getBBlocksNum() > 0);
+    REQUIRE(SSA->getLvnBBlocksNum() == 0);
+
+    // the search goes from @readg to its caller,
+    // but it does not need the blocks of @loop
+    auto *load = &*M->getFunction("readg")->getEntryBlock().begin();
+    REQUIRE(llvm::isa<llvm::LoadInst>(load));
+    REQUIRE(!DDA.getLLVMDefinitions(load).empty());
+
+    auto lvn = SSA->getLvnBBlocksNum();
+    REQUIRE(lvn > 0);
+    REQUIRE(lvn < SSA->getBBlocksNum());
+
+    // the results of LVN are cached
+    REQUIRE(!DDA.getLLVMDefinitions(load).empty());
+    REQUIRE(SSA->getLvnBBlocksNum() == lvn);
+
+    auto *loop = M->getFunction("loop");
+    for (const auto &B : *loop) {
+        for (const auto &I : B) {
+            auto *inst = const_cast<llvm::Instruction *>(&I);
+            if (DDA.isUse(inst))
+                DDA.getLLVMDefinitions(inst);
+        }
+    }
+    REQUIRE(SSA->getLvnBBlocksNum() > lvn);
+    REQUIRE(SSA->getLvnBBlocksNum() <= SSA->getBBlocksNum());
+}
+
+static const char *recursive = R"(
+@g = global i32 0
+
+define void @even(i32 %n) {
+entry:
+  %c = icmp eq i32 %n, 0
+  br i1 %c, label %end, label %rec
+rec:
+  store i32 %n, i32* @g
+  %m = sub i32 %n, 1
+  call void @odd(i32 %m)
+  br label %end
+end:
+  ret void
+}
+
+define void @odd(i32 %n) {
+entry:
+  %x = load i32, i32* @g
+  %m = sub i32 %n, 1
+  call void @even(i32 %m)
+  ret void
+}
+
+define void @set(i32* %p, i32 %v) {
+  store i32 %v, i32* %p
+  ret void
+}
+
+define i32 @main() {
+entry:
+  %a = alloca [2 x i32]
+  %a0 = getelementptr [2 x i32], [2 x i32]* %a, i32 0, i32 0
+  %a1 = getelementptr [2 x i32], [2 x i32]* %a, i32 0, i32 1
+  store i32 0, i32* %a0
+  store i32 1, i32* %a1
+  call void @set(i32* %a0, i32 2)
+  call void @even(i32 10)
+  %x = load i32, i32* @g
+  %y = load i32, i32* %a0
+  %z = load i32, i32* %a1
+  %s = add i32 %x, %y
+  %r = add i32 %s, %z
+  ret i32 %r
+}
+)";
+
+TEST_CASE("Definitions with summaries", "[dda]") {
+    llvm::LLVMContext ctx;
+    for (const char *c : {code, recursive}) {
+        auto M = parse(ctx, c);
+        auto ondemand = getDefinitions(M.get(), 0);
+
+        REQUIRE(getDefinitions(M.get(), 0, false, /* summaries = */ true) ==
+                ondemand);
+        REQUIRE(getDefinitions(M.get(), 4, false, /* summaries = */ true) ==
+                ondemand);
+        REQUIRE(getDefinitions(M.get(), 0, true, /* summaries = */ true) ==
+                ondemand);
+    }
+}
+
+TEST_CASE("Definitions with scalar objects", "[dda]") {
+    llvm::LLVMContext ctx;
+    for (const char *c : {code, recursive}) {
+        auto M = parse(ctx, c);
+        auto ondemand = getDefinitions(M.get(), 0);
+
+        REQUIRE(getDefinitions(M.get(), 0, false, false,
+                               /* scalars = */ true) == ondemand);
+        REQUIRE(getDefinitions(M.get(), 0, true, false,
+                               /* scalars = */ true) == ondemand);
+        REQUIRE(getDefinitions(M.get(), 4, false, /* summaries = */ true,
+                               /* scalars = */ true) == ondemand);
+    }
+
+    auto M = parse(ctx, code);
+    DGLLVMPointerAnalysis PTA(M.get());
+    PTA.run();
+    LLVMDataDependenceAnalysisOptions opts;
+    opts.scalarObjects = true;
+    LLVMDataDependenceAnalysis DDA(M.get(), &PTA, opts);
+    DDA.run();
+
+    auto &loop = M->getFunction("loop")->getEntryBlock();
+    auto &main = M->getFunction("main")->getEntryBlock();
+    // %i is a scalar, the address of %a is taken
+    REQUIRE(DDA.getNode(&*loop.begin())->isScalar());
+    REQUIRE(!DDA.getNode(&*main.begin())->isScalar());
+
+    // a query that reads the scalar partially
+    auto *i = &*loop.begin();
+    auto *ret = loop.getParent()->back().getTerminator();
+    REQUIRE(!DDA.getLLVMDefinitions(ret, i, 0, 2).empty());
+    REQUIRE(!DDA.getNode(i)->isScalar());
+}
@@ -0,0 +1,196 @@
+#include <catch2/catch.hpp>
+
+#include <cstdio>
+#include <memory>
+#include <set>
+#include <string>
+
+#include <llvm/IR/Constants.h>
+#include <llvm/IR/Function.h>
+#include <llvm/IR/Instructions.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Module.h>
+#include <llvm/IRReader/IRReader.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/SourceMgr.h>
+
+#include "dg/llvm/PointerAnalysis/PointerAnalysis.h"
+#include "dg/llvm/PointerAnalysis/StoredPointerAnalysis.h"
+
+using namespace dg;
+
+static const char *code = R"(
+@a = global i32 0
+@b = global [4 x i32] zeroinitializer
+@g = global i32* @a
+
+define i32* @id(i32* %p) {
+  ret i32* %p
+}
+
+define void @set(i32** %p, i32* %v) {
+  store i32* %v, i32** %p
+  ret void
+}
+
+define i32* @main() {
+  %p = alloca i32*
+  %m = call i8* @malloc(i64 8)
+  %mc = bitcast i8* %m to i32*
+  call void @set(i32** %p, i32* %mc)
+  call void @set(i32** %p, i32* getelementptr ([4 x i32], [4 x i32]* @b, i64 0, i64 2))
+  %v = load i32*, i32** %p
+  %r = call i32* @id(i32* %v)
+  %l = load i32*, i32** @g
+  store i32* null, i32** %p
+  %n = load i32*, i32** %p
+  ret i32* %r
+}
+
+declare i8* @malloc(i64)
+)";
+
+static std::unique_ptr<llvm::Module> parse(llvm::LLVMContext &ctx,
+                                           const char *code) {
+    llvm::SMDiagnostic err;
+    auto M = llvm::parseIR(llvm::MemoryBufferRef(code, "test"), err, ctx);
+    REQUIRE(M);
+    return M;
+}
+
+// the points-to set as a set of strings
+static std::set<std::string> toStrings(LLVMPointerAnalysis &PTA,
+                                       const llvm::Value *val) {
+    std::set<std::string> ret;
+    auto pts = PTA.getLLVMPointsToChecked(val);
+    if (pts.first)
+        ret.insert("has-points-to");
+    for (const auto &ptr : pts.second) {
+        std::string str;
+        llvm::raw_string_ostream os(str);
+        os << *ptr.value << " + " << *ptr.offset;
+        ret.insert(os.str());
+    }
+    if (pts.second.hasUnknown())
+        ret.insert("unknown");
+    if (pts.second.hasNull())
+        ret.insert("null");
+    if (pts.second.hasInvalidated())
+        ret.insert("invalidated");
+    ret.insert("size " + std::to_string(pts.second.size()));
+    return ret;
+}
+
+static void checkSame(LLVMPointerAnalysis &PTA, LLVMPointerAnalysis &stored,
+                      const llvm::Value *val) {
+    INFO("Value " << val->getName().str());
+    REQUIRE(toStrings(PTA, val) == toStrings(stored, val));
+}
+
+TEST_CASE("Store and load results", "[pta-stored]") {
+    llvm::LLVMContext ctx;
+    auto M = parse(ctx, code);
+    const std::string path = "llvm-pta-stored-test.pta";
+
+    DGLLVMPointerAnalysis PTA(M.get());
+    PTA.run();
+    REQUIRE(StoredPointerAnalysis::store(PTA, M.get(), path));
+
+    LLVMPointerAnalysisOptions opts;
+    opts.storedResults = path;
+    StoredPointerAnalysis stored(M.get(), opts);
+    REQUIRE(stored.load(path));
+
+    for (const auto &G : M->globals())
+        checkSame(PTA, stored, &G);
+
+    for (const auto &F : *M) {
+        checkSame(PTA, stored, &F);
+        for (const auto &A : F.args())
+            checkSame(PTA, stored, &A);
+        for (const auto &B : F) {
+            for (const auto &I : B) {
+                checkSame(PTA, stored, &I);
+                // constant expressions and other constants
+                for (const auto &op : I.operands()) {
+                    if (llvm::isa<llvm::Constant>(op))
+                        checkSame(PTA, stored, op);
+                }
+            }
+        }
+    }
+
+    std::remove(path.c_str());
+}
+
+TEST_CASE("Load results of another module", "[pta-stored]") {
+    llvm::LLVMContext ctx;
+    auto M = parse(ctx, code);
+    const std::string path = "llvm-pta-stored-test-other.pta";
+
+    DGLLVMPointerAnalysis PTA(M.get());
+    PTA.run();
+    REQUIRE(StoredPointerAnalysis::store(PTA, M.get(), path));
+
+    // the same module without the last store and load
+    auto *main = M->getFunction("main");
+    auto *ret = main->back().getTerminator();
+    ret->getPrevNode()->eraseFromParent();
+    ret->getPrevNode()->eraseFromParent();
+
+    LLVMPointerAnalysisOptions opts;
+    StoredPointerAnalysis stored(M.get(), opts);
+    REQUIRE(!stored.load(path));
+    REQUIRE(!stored.load("llvm-pta-stored-test-nonexistent.pta"));
+
+    std::remove(path.c_str());
+}
+
+TEST_CASE("Load results of a changed module", "[pta-stored]") {
+    llvm::LLVMContext ctx;
+    auto M = parse(ctx, code);
+    const std::string path = "llvm-pta-stored-test-changed.pta";
+
+    DGLLVMPointerAnalysis PTA(M.get());
+    PTA.run();
+    REQUIRE(StoredPointerAnalysis::store(PTA, M.get(), path));
+
+    LLVMPointerAnalysisOptions opts;
+    {
+        StoredPointerAnalysis stored(M.get(), opts);
+        REQUIRE(stored.load(path));
+    }
+
+    // the same instructions, just 'set' stores @a instead of malloc
+    auto *main = M->getFunction("main");
+    llvm::CallInst *call = nullptr;
+    for (auto &I : main->front()) {
+        call = llvm::dyn_cast<llvm::CallInst>(&I);
+        if (call && call->getCalledFunction() == M->getFunction("set"))
+            break;
+    }
+    REQUIRE(call);
+    auto *old = call->getArgOperand(1);
+    call->setArgOperand(1, M->getNamedValue("a"));
+    {
+        StoredPointerAnalysis stored(M.get(), opts);
+        REQUIRE(!stored.load(path));
+    }
+    call->setArgOperand(1, old);
+
+    // a different initializer of a global variable
+    auto *G = M->getGlobalVariable("g");
+    auto *init = G->getInitializer();
+    G->setInitializer(llvm::ConstantPointerNull::get(
+            llvm::cast<llvm::PointerType>(G->getValueType())));
+    {
+        StoredPointerAnalysis stored(M.get(), opts);
+        REQUIRE(!stored.load(path));
+    }
+    G->setInitializer(init);
+
+    StoredPointerAnalysis stored(M.get(), opts);
+    REQUIRE(stored.load(path));
+
+    std::remove(path.c_str());
+}
@@ -0,0 +1,229 @@
+#include <catch2/catch.hpp>
+
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <utility>
+
+#include <llvm/IR/Function.h>
+#include <llvm/IR/Instructions.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Module.h>
+#include <llvm/IRReader/IRReader.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/SourceMgr.h>
+
+#include "dg/llvm/PointerAnalysis/PointerAnalysis.h"
+
+using namespace dg;
+
+static std::unique_ptr<llvm::Module> parse(llvm::LLVMContext &ctx,
+                                           const char *code) {
+    llvm::SMDiagnostic err;
+    auto M = llvm::parseIR(llvm::MemoryBufferRef(code, "test"), err, ctx);
+    REQUIRE(M);
+    return M;
+}
+
+static llvm::Instruction *findInst(llvm::Function *F, unsigned opcode) {
+    for (auto &B : *F) {
+        for (auto &I : B) {
+            if (I.getOpcode() == opcode)
+                return &I;
+        }
+    }
+    return nullptr;
+}
+
+// the names of the memory that the value points to
+static std::set<std::string> pointsTo(DGLLVMPointerAnalysis &PTA,
+                                      const llvm::Value *val) {
+    std::set<std::string> ret;
+    auto pts = PTA.getLLVMPointsTo(val);
+    for (const auto &ptr : pts)
+        ret.insert(ptr.value->getName().str());
+    if (pts.hasNull())
+        ret.insert("null");
+    if (pts.hasUnknown())
+        ret.insert("unknown");
+    return ret;
+}
+
+// the updated analysis must have the same results
+// as the analysis that runs from scratch
+static void checkSameAsFresh(DGLLVMPointerAnalysis &PTA,
+                             const llvm::Module *M) {
+    DGLLVMPointerAnalysis fresh(M);
+    fresh.run();
+
+    for (const auto &F : *M) {
+        for (const auto &B : F) {
+            for (const auto &I : B) {
+                if (!I.getType()->isPointerTy())
+                    continue;
+                auto mine = PTA.getLLVMPointsToChecked(&I);
+                auto theirs = fresh.getLLVMPointsToChecked(&I);
+                REQUIRE(mine.first == theirs.first);
+                REQUIRE(pointsTo(PTA, &I) == pointsTo(fresh, &I));
+            }
+        }
+    }
+}
+
+TEST_CASE("Update changed function", "[pta-update]") {
+    llvm::LLVMContext ctx;
+    auto M = parse(ctx, R"(
+@a = global i32 0
+@b = global i32 0
+
+define void @set(i32** %p) {
+  store i32* @a, i32** %p
+  ret void
+}
+
+define i32* @main() {
+  %p = alloca i32*
+  call void @set(i32** %p)
+  %v = load i32*, i32** %p
+  ret i32* %v
+}
+)");
+
+    auto *main = M->getFunction("main");
+    auto *set = M->getFunction("set");
+    auto *load = findInst(main, llvm::Instruction::Load);
+
+    DGLLVMPointerAnalysis PTA(M.get());
+    PTA.run();
+    REQUIRE(pointsTo(PTA, load) == std::set<std::string>{"a"});
+
+    auto *store = findInst(set, llvm::Instruction::Store);
+    store->setOperand(0, M->getNamedGlobal("b"));
+
+    PTA.update({set}, {}, {});
+    REQUIRE(pointsTo(PTA, load) == std::set<std::string>{"b"});
+    checkSameAsFresh(PTA, M.get());
+}
+
+TEST_CASE("Update removed function", "[pta-update]") {
+    llvm::LLVMContext ctx;
+    auto M = parse(ctx, R"(
+@a = global i32 0
+@b = global i32 0
+@g = global i32* null
+
+define void @f1() {
+  store i32* @a, i32** @g
+  ret void
+}
+
+define void @f2() {
+  store i32* @b, i32** @g
+  ret void
+}
+
+define i32* @main() {
+  call void @f1()
+  %v = load i32*, i32** @g
+  ret i32* %v
+}
+)");
+
+    auto *main = M->getFunction("main");
+    auto *f1 = M->getFunction("f1");
+    auto *f2 = M->getFunction("f2");
+    auto *load = findInst(main, llvm::Instruction::Load);
+
+    DGLLVMPointerAnalysis PTA(M.get());
+    PTA.run();
+    REQUIRE(pointsTo(PTA, load) == std::set<std::string>{"a"});
+
+    // call f2 instead of f1
+    auto *call = llvm::cast<llvm::CallInst>(
+            findInst(main, llvm::Instruction::Call));
+    call->setCalledFunction(f2);
+    f1->eraseFromParent();
+
+    PTA.update({main}, {}, {f1});
+    REQUIRE(pointsTo(PTA, load) == std::set<std::string>{"b"});
+    checkSameAsFresh(PTA, M.get());
+
+    // add f1 back and call it via a pointer before f2
+    f1 = llvm::Function::Create(f2->getFunctionType(),
+                                llvm::GlobalValue::ExternalLinkage, "f1",
+                                M.get());
+    auto *entry = llvm::BasicBlock::Create(ctx, "", f1);
+    new llvm::StoreInst(M->getNamedGlobal("a"), M->getNamedGlobal("g"),
+                        entry);
+    llvm::ReturnInst::Create(ctx, entry);
+
+    auto *fptr = new llvm::AllocaInst(f1->getType(), 0, "fptr", call);
+    new llvm::StoreInst(f1, fptr, call);
+    auto *fval = new llvm::LoadInst(f1->getType(), fptr, "fval", call);
+    llvm::CallInst::Create(f1->getFunctionType(), fval, "", call);
+
+    PTA.update({main}, {f1}, {});
+    REQUIRE(pointsTo(PTA, load) == std::set<std::string>{"a", "b"});
+    checkSameAsFresh(PTA, M.get());
+}
+
+TEST_CASE("Update function called via pointer", "[pta-update]") {
+    llvm::LLVMContext ctx;
+    auto M = parse(ctx, R"(
+@a = global i32 0
+@b = global i32 0
+@c = global i32 0
+@g = global i32* @a
+
+define void @f1() {
+  store i32* @b, i32** @g
+  ret void
+}
+
+define void @f2() {
+  store i32* @c, i32** @g
+  ret void
+}
+
+define void @call(void ()* %fp) {
+  call void %fp()
+  ret void
+}
+
+define i32* @main() {
+  call void @call(void ()* @f1)
+  %v = load i32*, i32** @g
+  ret i32* %v
+}
+)");
+
+    auto *main = M->getFunction("main");
+    auto *f1 = M->getFunction("f1");
+    auto *f2 = M->getFunction("f2");
+    auto *load = findInst(main, llvm::Instruction::Load);
+
+    DGLLVMPointerAnalysis PTA(M.get());
+    PTA.run();
+    REQUIRE(pointsTo(PTA, load) == std::set<std::string>{"a", "b"});
+
+    // change the function called via the pointer
+    auto *store = findInst(f1, llvm::Instruction::Store);
+    store->setOperand(0, M->getNamedGlobal("c"));
+
+    PTA.update({f1}, {}, {});
+    REQUIRE(pointsTo(PTA, load) == std::set<std::string>{"a", "c"});
+    checkSameAsFresh(PTA, M.get());
+
+    // pass f2 instead of f1 and remove f1
+    auto *call = llvm::cast<llvm::CallInst>(
+            findInst(main, llvm::Instruction::Call));
+    call->setArgOperand(0, f2);
+    store = findInst(f2, llvm::Instruction::Store);
+    store->setOperand(0, M->getNamedGlobal("b"));
+    f1->eraseFromParent();
+
+    PTA.update({main, f2}, {}, {f1});
+    REQUIRE(pointsTo(PTA, load) == std::set<std::string>{"a", "b"});
+    checkSameAsFresh(PTA, M.get());
+}
@@ -0,0 +1,126 @@
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <vector>
+
+#include "dg/PointerAnalysis/PointerAnalysis.h"
+#include "dg/PointerAnalysis/PointerAnalysisFS.h"
+#include "dg/PointerAnalysis/PointerAnalysisPFS.h"
+#include "dg/PointerAnalysis/PointerGraph.h"
+#include "dg/util/TimeMeasure.h"
+
+using namespace dg::pta;
+
+// count the allocated memory, we keep the size
+// of every allocation in front of the allocated block
+static size_t allocated = 0;
+static size_t peak = 0;
+
+static const size_t HEADER = alignof(std::max_align_t);
+
+void *operator new(size_t size) {
+    auto *mem = static_cast<char *>(std::malloc(size + HEADER));
+    if (!mem)
+        std::abort();
+    *reinterpret_cast<size_t *>(mem) = size;
+    allocated += size;
+    if (allocated > peak)
+        peak = allocated;
+    return mem + HEADER;
+}
+
+void operator delete(void *ptr) noexcept {
+    if (!ptr)
+        return;
+    auto *mem = static_cast<char *>(ptr) - HEADER;
+    allocated -= *reinterpret_cast<size_t *>(mem);
+    std::free(mem);
+}
+
+void operator delete(void *ptr, size_t /*unused*/) noexcept {
+    operator delete(ptr);
+}
+
+///
+// Build a graph with 'objects' allocations followed by 'segments'
+// diamonds. Every branch of a diamond stores to one of the objects
+// and the join loads from it. The last node jumps back
+// to the first diamond, so the analysis must iterate.
+static std::vector<PSNode *> buildGraph(PointerGraph &PS, unsigned objects,
+                                        unsigned segments) {
+    std::vector<PSNode *> allocs;
+    std::vector<PSNode *> loads;
+    for (unsigned i = 0; i < objects; ++i) {
+        allocs.push_back(PS.create<PSNodeType::ALLOC>());
+        if (i > 0)
+            allocs[i - 1]->addSuccessor(allocs[i]);
+    }
+
+    PSNode *last = allocs.back();
+    PSNode *first = nullptr;
+    for (unsigned i = 0; i < segments; ++i) {
+        PSNode *to = allocs[(i * 7) % objects];
+        PSNode *S1 = PS.create<PSNodeType::STORE>(allocs[i % objects], to);
+        PSNode *S2 = PS.create<PSNodeType::STORE>(
+                allocs[(i * 13 + 1) % objects], to);
+        PSNode *L = PS.create<PSNodeType::LOAD>(to);
+        last->addSuccessor(S1);
+        last->addSuccessor(S2);
+        S1->addSuccessor(L);
+        S2->addSuccessor(L);
+        loads.push_back(L);
+        if (!first)
+            first = S1;
+        last = L;
+    }
+    last->addSuccessor(first);
+
+    auto *subg = PS.createSubgraph(allocs[0]);
+    PS.setEntry(subg);
+    return loads;
+}
+
+template <typename PTAType>
+static std::vector<size_t> run(unsigned objects, unsigned segments,
+                               const char *msg) {
+    std::vector<size_t> result;
+
+    const size_t before = allocated;
+    peak = allocated;
+
+    dg::debug::TimeMeasure tm;
+    tm.start();
+    {
+        PointerGraph PS;
+        auto loads = buildGraph(PS, objects, segments);
+        PTAType PA(&PS);
+        PA.run();
+
+        for (PSNode *L : loads)
+            result.push_back(L->pointsTo.size());
+    }
+    tm.stop();
+
+    std::cout << " -- " << msg << ": peak memory " << (peak - before) / 1024
+              << " kB\n";
+    tm.report(std::string(" -- ") + msg + " took", std::cout);
+    return result;
+}
+
+static void compare(unsigned objects, unsigned segments) {
+    std::cout << "Running " << objects << " objects, " << segments
+              << " diamonds\n";
+
+    auto fs = run<PointerAnalysisFS>(objects, segments, "std::map maps");
+    auto pfs = run<PointerAnalysisPFS>(objects, segments, "persistent maps");
+    if (fs != pfs) {
+        std::cout << "The results differ!\n";
+        std::abort();
+    }
+}
+
+int main() {
+    compare(10, 1000);
+    compare(100, 1000);
+    compare(1000, 1000);
+}
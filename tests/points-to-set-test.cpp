@@ -250,6 +250,8 @@ TEST_CASE("Querying empty set", "PointsToSet") {
     queryingEmptySet<SimplePointsToSet>();
     queryingEmptySet<SeparateOffsetsPointsToSet>();
     queryingEmptySet<PointerIdPointsToSet>();
+    queryingEmptySet<BlockPointerIdPointsToSet>();
+    queryingEmptySet<SharedPointerIdPointsToSet>();
     queryingEmptySet<SmallOffsetsPointsToSet>();
     queryingEmptySet<AlignedSmallOffsetsPointsToSet>();
     queryingEmptySet<AlignedPointerIdPointsToSet>();
@@ -260,6 +262,8 @@ TEST_CASE("Add an element", "PointsToSet") {
     addAnElement<SimplePointsToSet>();
     addAnElement<SeparateOffsetsPointsToSet>();
     addAnElement<PointerIdPointsToSet>();
+    addAnElement<BlockPointerIdPointsToSet>();
+    addAnElement<SharedPointerIdPointsToSet>();
     addAnElement<SmallOffsetsPointsToSet>();
     addAnElement<AlignedSmallOffsetsPointsToSet>();
     addAnElement<AlignedPointerIdPointsToSet>();
@@ -270,6 +274,8 @@ TEST_CASE("Add few elements", "PointsToSet") {
     addFewElements<SimplePointsToSet>();
     addFewElements<SeparateOffsetsPointsToSet>();
     addFewElements<PointerIdPointsToSet>();
+    addFewElements<BlockPointerIdPointsToSet>();
+    addFewElements<SharedPointerIdPointsToSet>();
     addFewElements<SmallOffsetsPointsToSet>();
     addFewElements<AlignedSmallOffsetsPointsToSet>();
     addFewElements<AlignedPointerIdPointsToSet>();
@@ -280,6 +286,8 @@ TEST_CASE("Add few elements 2", "PointsToSet") {
     addFewElements2<SimplePointsToSet>();
     addFewElements2<SeparateOffsetsPointsToSet>();
     addFewElements2<PointerIdPointsToSet>();
+    addFewElements2<BlockPointerIdPointsToSet>();
+    addFewElements2<SharedPointerIdPointsToSet>();
     addFewElements2<SmallOffsetsPointsToSet>();
     addFewElements2<AlignedSmallOffsetsPointsToSet>();
     addFewElements2<AlignedPointerIdPointsToSet>();
@@ -290,6 +298,8 @@ TEST_CASE("Merge points-to sets", "PointsToSet") {
     mergePointsToSets<SimplePointsToSet>();
     mergePointsToSets<SeparateOffsetsPointsToSet>();
     mergePointsToSets<PointerIdPointsToSet>();
+    mergePointsToSets<BlockPointerIdPointsToSet>();
+    mergePointsToSets<SharedPointerIdPointsToSet>();
     mergePointsToSets<SmallOffsetsPointsToSet>();
     mergePointsToSets<AlignedSmallOffsetsPointsToSet>();
     mergePointsToSets<AlignedPointerIdPointsToSet>();
@@ -301,6 +311,8 @@ TEST_CASE("Remove element",
     removeElement<OffsetsSetPointsToSet>();
     removeElement<SimplePointsToSet>();
     removeElement<PointerIdPointsToSet>();
+    removeElement<BlockPointerIdPointsToSet>();
+    removeElement<SharedPointerIdPointsToSet>();
     removeElement<SmallOffsetsPointsToSet>();
     removeElement<AlignedSmallOffsetsPointsToSet>();
     removeElement<AlignedPointerIdPointsToSet>();
@@ -312,6 +324,8 @@ TEST_CASE("Remove few elements",
     removeFewElements<OffsetsSetPointsToSet>();
     removeFewElements<SimplePointsToSet>();
     removeFewElements<PointerIdPointsToSet>();
+    removeFewElements<BlockPointerIdPointsToSet>();
+    removeFewElements<SharedPointerIdPointsToSet>();
     removeFewElements<SmallOffsetsPointsToSet>();
     removeFewElements<AlignedSmallOffsetsPointsToSet>();
     removeFewElements<AlignedPointerIdPointsToSet>();
@@ -323,6 +337,8 @@ TEST_CASE("Remove all elements pointing to a target",
     removeAnyTest<OffsetsSetPointsToSet>();
     removeAnyTest<SimplePointsToSet>();
     removeAnyTest<PointerIdPointsToSet>();
+    removeAnyTest<BlockPointerIdPointsToSet>();
+    removeAnyTest<SharedPointerIdPointsToSet>();
     removeAnyTest<SmallOffsetsPointsToSet>();
     removeAnyTest<AlignedSmallOffsetsPointsToSet>();
     removeAnyTest<AlignedPointerIdPointsToSet>();
@@ -333,6 +349,8 @@ TEST_CASE("Test various points-to functions", "PointsToSet") {
     pointsToTest<SimplePointsToSet>();
     pointsToTest<SeparateOffsetsPointsToSet>();
     pointsToTest<PointerIdPointsToSet>();
+    pointsToTest<BlockPointerIdPointsToSet>();
+    pointsToTest<SharedPointerIdPointsToSet>();
     pointsToTest<SmallOffsetsPointsToSet>();
     pointsToTest<AlignedSmallOffsetsPointsToSet>();
     pointsToTest<AlignedPointerIdPointsToSet>();
@@ -346,3 +364,97 @@ TEST_CASE("Test aligned overflow set behavior", "PointsToSet") {
     testAlignedOverflowBehavior<AlignedSmallOffsetsPointsToSet>();
     testAlignedOverflowBehavior<AlignedPointerIdPointsToSet>();
 }
+
+TEST_CASE("Shared points-to sets", "PointsToSet") {
+    PointerGraph PS;
+    PSNode *A = PS.create<PSNodeType::ALLOC>();
+    PSNode *B = PS.create<PSNodeType::ALLOC>();
+
+    SharedPointerIdPointsToSet S1, S2, S3;
+    REQUIRE(S1 == S2);
+    REQUIRE(S1.add({A, 0}));
+    REQUIRE(S1 != S2);
+    REQUIRE(S1.add({B, 8}));
+    // the same elements added in a different order give the same set
+    REQUIRE(S2.add({B, 8}));
+    REQUIRE(S2.add({A, 0}));
+    REQUIRE(S1 == S2);
+
+    REQUIRE(S3.add({A, 0}));
+    REQUIRE(S3.isSubsetOf(S1));
+    REQUIRE(!S1.isSubsetOf(S3));
+    REQUIRE(S3.add(S1));
+    REQUIRE(S3 == S1);
+    REQUIRE(S3.add(S2) == false);
+
+    // modifying one set does not change the others
+    REQUIRE(S3.remove({A, 0}));
+    REQUIRE(S3.size() == 1);
+    REQUIRE(S1.size() == 2);
+    REQUIRE(S1.has({A, 0}));
+    REQUIRE(S3.add({B, dg::Offset::UNKNOWN}));
+    REQUIRE(S3.size() == 1);
+    REQUIRE(S2.has({B, 8}));
+    S3.clear();
+    REQUIRE(S3.empty());
+    REQUIRE(!S1.empty());
+    REQUIRE(S3.isSubsetOf(S1));
+}
+
+TEST_CASE("Shared points-to sets are released", "PointsToSet") {
+    PointerGraph PS;
+    PSNode *A = PS.create<PSNodeType::ALLOC>();
+    PSNode *B = PS.create<PSNodeType::ALLOC>();
+
+    auto sets = SharedPointerIdPointsToSet::getNumberOfSharedSets();
+    {
+        SharedPointerIdPointsToSet S1, S2;
+        for (unsigned i = 0; i < 100; ++i)
+            REQUIRE(S1.add({A, i}));
+        // the intermediate sets were released
+        REQUIRE(SharedPointerIdPointsToSet::getNumberOfSharedSets() ==
+                sets + 1);
+        REQUIRE(S2.add({B, 0}));
+        REQUIRE(S2.add(S1));
+        REQUIRE(SharedPointerIdPointsToSet::getNumberOfSharedSets() ==
+                sets + 2);
+        REQUIRE(S1.isSubsetOf(S2));
+        REQUIRE(!S2.isSubsetOf(S1));
+    }
+    REQUIRE(SharedPointerIdPointsToSet::getNumberOfSharedSets() == sets);
+}
+
+TEST_CASE("Add many elements to shared points-to set", "PointsToSet") {
+    PointerGraph PS;
+    PSNode *A = PS.create<PSNodeType::ALLOC>();
+    PSNode *B = PS.create<PSNodeType::ALLOC>();
+    PSNode *C = PS.create<PSNodeType::ALLOC>();
+
+    std::vector<Pointer> ptrs{{A, 0},
+                              {B, 4},
+                              {A, dg::Offset::UNKNOWN},
+                              {A, 8},
+                              {C, 0},
+                              {B, 4}};
+
+    SharedPointerIdPointsToSet S1, S2;
+    REQUIRE(S1.add({B, 8}));
+    REQUIRE(S2.add({B, 8}));
+    REQUIRE(S2.add({C, dg::Offset::UNKNOWN}));
+    REQUIRE(S1.add({C, dg::Offset::UNKNOWN}));
+
+    auto sets = SharedPointerIdPointsToSet::getNumberOfSharedSets();
+    // adding all at once gives the same set as adding one by one
+    REQUIRE(S1.add(ptrs));
+    // no intermediate sets were created
+    REQUIRE(SharedPointerIdPointsToSet::getNumberOfSharedSets() ==
+            sets + 1);
+    for (const auto &ptr : ptrs)
+        S2.add(ptr);
+    REQUIRE(S1 == S2);
+    REQUIRE(S1.size() == 4);
+    REQUIRE(S1.has({A, dg::Offset::UNKNOWN}));
+    REQUIRE(!S1.has({A, 0}));
+    REQUIRE(!S1.has({C, 0}));
+    REQUIRE(S1.add(ptrs) == false);
+}
@@ -1,8 +1,13 @@
 #include <catch2/catch.hpp>
 
+#include <set>
+
 #include "dg/PointerAnalysis/PointerAnalysisFI.h"
 #include "dg/PointerAnalysis/PointerAnalysisFS.h"
+#include "dg/PointerAnalysis/PointerAnalysisPFS.h"
+#include "dg/PointerAnalysis/PointerAnalysisSFS.h"
 #include "dg/PointerAnalysis/PointerGraph.h"
+#include "dg/PointerAnalysis/PointerGraphTopoOrder.h"
 
 using namespace dg::pta;
 using dg::Offset;
@@ -895,6 +900,350 @@ TEST_CASE("Flow insensitive", "FI") {
     memcpy_test8<dg::pta::PointerAnalysisFI>();
 }
 
+// FI analysis that processes the nodes using several threads
+class PointerAnalysisFIParallel : public PointerAnalysisFI {
+  public:
+    PointerAnalysisFIParallel(PointerGraph *PS)
+            : PointerAnalysisFI(
+                      PS, dg::PointerAnalysisOptions().setSolverThreads(4)) {}
+};
+
+// a graph with many nodes that can be processed in parallel:
+// chains of GEPs and casts over several objects stored into
+// and loaded from a common memory. If 'loop' is true, the chains
+// are in a loop.
+template <typename PTStoT>
+std::vector<std::set<std::pair<unsigned, Offset>>>
+wide_graph(bool loop = false) {
+    PointerGraph PS;
+    PSNode *M = PS.create<PSNodeType::ALLOC>();
+    M->setSize(8);
+    PSNode *last = M;
+    std::vector<PSNode *> loads;
+
+    for (int i = 0; i < 200; ++i) {
+        PSNode *A = PS.create<PSNodeType::ALLOC>();
+        A->setSize(16);
+        PSNode *G = PS.create<PSNodeType::GEP>(A, i % 16);
+        PSNode *C = PS.create<PSNodeType::CAST>(G);
+        PSNode *S = PS.create<PSNodeType::STORE>(C, M);
+        PSNode *L = PS.create<PSNodeType::LOAD>(M);
+        PSNode *C2 = PS.create<PSNodeType::CAST>(L);
+        PSNode *G2 = PS.create<PSNodeType::GEP>(C2, Offset::UNKNOWN);
+
+        last->addSuccessor(A);
+        A->addSuccessor(G);
+        G->addSuccessor(C);
+        C->addSuccessor(S);
+        S->addSuccessor(L);
+        L->addSuccessor(C2);
+        C2->addSuccessor(G2);
+        last = G2;
+        loads.push_back(L);
+        loads.push_back(G2);
+    }
+
+    if (loop)
+        last->addSuccessor(M->getSingleSuccessor());
+
+    auto *subg = PS.createSubgraph(M);
+    PS.setEntry(subg);
+    PTStoT PA(&PS);
+    PA.run();
+
+    // compare sets, the order of pointers in points-to sets depends
+    // on the order in which the pointers were created
+    std::vector<std::set<std::pair<unsigned, Offset>>> result;
+    for (PSNode *L : loads) {
+        result.emplace_back();
+        for (const auto &ptr : L->pointsTo)
+            result.back().emplace(ptr.target->getID(), ptr.offset);
+        REQUIRE(!result.back().empty());
+    }
+    return result;
+}
+
+TEST_CASE("Flow insensitive parallel", "FI") {
+    store_load<PointerAnalysisFIParallel>();
+    store_load2<PointerAnalysisFIParallel>();
+    store_load3<PointerAnalysisFIParallel>();
+    store_load4<PointerAnalysisFIParallel>();
+    store_load5<PointerAnalysisFIParallel>();
+    gep1<PointerAnalysisFIParallel>();
+    gep2<PointerAnalysisFIParallel>();
+    gep3<PointerAnalysisFIParallel>();
+    gep4<PointerAnalysisFIParallel>();
+    gep5<PointerAnalysisFIParallel>();
+    nulltest<PointerAnalysisFIParallel>();
+    constant_store<PointerAnalysisFIParallel>();
+    load_from_zeroed<PointerAnalysisFIParallel>();
+    load_from_unknown_offset<PointerAnalysisFIParallel>();
+    load_from_unknown_offset2<PointerAnalysisFIParallel>();
+    load_from_unknown_offset3<PointerAnalysisFIParallel>();
+    memcpy_test<PointerAnalysisFIParallel>();
+    memcpy_test2<PointerAnalysisFIParallel>();
+    memcpy_test3<PointerAnalysisFIParallel>();
+    memcpy_test4<PointerAnalysisFIParallel>();
+    memcpy_test5<PointerAnalysisFIParallel>();
+    memcpy_test6<PointerAnalysisFIParallel>();
+    memcpy_test7<PointerAnalysisFIParallel>();
+    memcpy_test8<PointerAnalysisFIParallel>();
+
+    auto seq = wide_graph<dg::pta::PointerAnalysisFI>();
+    auto parallel = wide_graph<PointerAnalysisFIParallel>();
+    REQUIRE(seq.size() == parallel.size());
+    for (size_t i = 0; i < seq.size(); ++i)
+        REQUIRE(seq[i] == parallel[i]);
+}
+
+// FI analysis that propagates only differences of points-to sets
+class PointerAnalysisFIDiff : public PointerAnalysisFI {
+  public:
+    PointerAnalysisFIDiff(PointerGraph *PS)
+            : PointerAnalysisFI(PS, dg::PointerAnalysisOptions()
+                                            .setDifferencePropagation(true)) {}
+};
+
+// the same, but using also several threads
+class PointerAnalysisFIDiffParallel : public PointerAnalysisFI {
+  public:
+    PointerAnalysisFIDiffParallel(PointerGraph *PS)
+            : PointerAnalysisFI(PS, dg::PointerAnalysisOptions()
+                                            .setDifferencePropagation(true)
+                                            .setSolverThreads(4)) {}
+};
+
+TEST_CASE("Flow insensitive difference propagation", "FI") {
+    store_load<PointerAnalysisFIDiff>();
+    store_load2<PointerAnalysisFIDiff>();
+    store_load3<PointerAnalysisFIDiff>();
+    store_load4<PointerAnalysisFIDiff>();
+    store_load5<PointerAnalysisFIDiff>();
+    gep1<PointerAnalysisFIDiff>();
+    gep2<PointerAnalysisFIDiff>();
+    gep3<PointerAnalysisFIDiff>();
+    gep4<PointerAnalysisFIDiff>();
+    gep5<PointerAnalysisFIDiff>();
+    nulltest<PointerAnalysisFIDiff>();
+    constant_store<PointerAnalysisFIDiff>();
+    load_from_zeroed<PointerAnalysisFIDiff>();
+    load_from_unknown_offset<PointerAnalysisFIDiff>();
+    load_from_unknown_offset2<PointerAnalysisFIDiff>();
+    load_from_unknown_offset3<PointerAnalysisFIDiff>();
+    memcpy_test<PointerAnalysisFIDiff>();
+    memcpy_test2<PointerAnalysisFIDiff>();
+    memcpy_test3<PointerAnalysisFIDiff>();
+    memcpy_test4<PointerAnalysisFIDiff>();
+    memcpy_test5<PointerAnalysisFIDiff>();
+    memcpy_test6<PointerAnalysisFIDiff>();
+    memcpy_test7<PointerAnalysisFIDiff>();
+    memcpy_test8<PointerAnalysisFIDiff>();
+
+    for (bool loop : {false, true}) {
+        auto full = wide_graph<dg::pta::PointerAnalysisFI>(loop);
+        auto diff = wide_graph<PointerAnalysisFIDiff>(loop);
+        auto diffpar = wide_graph<PointerAnalysisFIDiffParallel>(loop);
+        REQUIRE(full.size() == diff.size());
+        REQUIRE(full.size() == diffpar.size());
+        for (size_t i = 0; i < full.size(); ++i) {
+            REQUIRE(full[i] == diff[i]);
+            REQUIRE(full[i] == diffpar[i]);
+        }
+    }
+}
+
+// a cycle of PHI and cast nodes in a loop:
+// P1 = PHI(A, C2), C1 = CAST(P1), P2 = PHI(C1, B), C2 = CAST(P2)
+// Return the number of merged nodes.
+template <typename PTStoT>
+size_t copy_cycle() {
+    PointerGraph PS;
+    PSNode *A = PS.create<PSNodeType::ALLOC>();
+    PSNode *B = PS.create<PSNodeType::ALLOC>();
+    PSNode *M = PS.create<PSNodeType::ALLOC>();
+    PSNode *P1 = PS.create<PSNodeType::PHI>();
+    PSNode *C1 = PS.create<PSNodeType::CAST>(P1);
+    PSNode *P2 = PS.create<PSNodeType::PHI>(C1, B);
+    PSNode *C2 = PS.create<PSNodeType::CAST>(P2);
+    PSNode *S = PS.create<PSNodeType::STORE>(C1, M);
+    PSNode *L = PS.create<PSNodeType::LOAD>(M);
+    P1->addOperand(A, C2);
+
+    A->addSuccessor(B);
+    B->addSuccessor(M);
+    M->addSuccessor(P1);
+    P1->addSuccessor(C1);
+    C1->addSuccessor(P2);
+    P2->addSuccessor(C2);
+    C2->addSuccessor(S);
+    S->addSuccessor(L);
+    L->addSuccessor(P1);
+
+    auto *subg = PS.createSubgraph(A);
+    PS.setEntry(subg);
+    PTStoT PA(&PS);
+    PA.run();
+
+    for (PSNode *nd : {P1, C1, P2, C2, L}) {
+        PSNode *rep = PS.getRepresentative(nd);
+        REQUIRE(rep->doesPointsTo(A));
+        REQUIRE(rep->doesPointsTo(B));
+        REQUIRE(rep->pointsTo.size() == 2);
+    }
+
+    return PS.getMergedNodes().size();
+}
+
+// FI analysis that collapses cycles of copy nodes
+class PointerAnalysisFICollapse : public PointerAnalysisFI {
+  public:
+    PointerAnalysisFICollapse(PointerGraph *PS)
+            : PointerAnalysisFI(
+                      PS, dg::PointerAnalysisOptions().setCollapseCycles(true)) {
+    }
+};
+
+TEST_CASE("Flow insensitive cycle collapsing", "FI") {
+    store_load<PointerAnalysisFICollapse>();
+    store_load2<PointerAnalysisFICollapse>();
+    store_load3<PointerAnalysisFICollapse>();
+    store_load4<PointerAnalysisFICollapse>();
+    store_load5<PointerAnalysisFICollapse>();
+    gep1<PointerAnalysisFICollapse>();
+    gep2<PointerAnalysisFICollapse>();
+    gep3<PointerAnalysisFICollapse>();
+    gep4<PointerAnalysisFICollapse>();
+    gep5<PointerAnalysisFICollapse>();
+    nulltest<PointerAnalysisFICollapse>();
+    constant_store<PointerAnalysisFICollapse>();
+    load_from_zeroed<PointerAnalysisFICollapse>();
+    load_from_unknown_offset<PointerAnalysisFICollapse>();
+    load_from_unknown_offset2<PointerAnalysisFICollapse>();
+    load_from_unknown_offset3<PointerAnalysisFICollapse>();
+    memcpy_test<PointerAnalysisFICollapse>();
+    memcpy_test2<PointerAnalysisFICollapse>();
+    memcpy_test3<PointerAnalysisFICollapse>();
+    memcpy_test4<PointerAnalysisFICollapse>();
+    memcpy_test5<PointerAnalysisFICollapse>();
+    memcpy_test6<PointerAnalysisFICollapse>();
+    memcpy_test7<PointerAnalysisFICollapse>();
+    memcpy_test8<PointerAnalysisFICollapse>();
+
+    REQUIRE(copy_cycle<dg::pta::PointerAnalysisFI>() == 0);
+    REQUIRE(copy_cycle<PointerAnalysisFICollapse>() == 3);
+}
+
+// FI analysis that processes nodes in the topological order
+class PointerAnalysisFITopo : public PointerAnalysisFI {
+  public:
+    PointerAnalysisFITopo(PointerGraph *PS)
+            : PointerAnalysisFI(PS, dg::PointerAnalysisOptions()
+                                            .setTopologicalScheduling(true)) {}
+};
+
+TEST_CASE("Flow insensitive topological scheduling", "FI") {
+    store_load<PointerAnalysisFITopo>();
+    store_load2<PointerAnalysisFITopo>();
+    store_load3<PointerAnalysisFITopo>();
+    store_load4<PointerAnalysisFITopo>();
+    store_load5<PointerAnalysisFITopo>();
+    gep1<PointerAnalysisFITopo>();
+    gep2<PointerAnalysisFITopo>();
+    gep3<PointerAnalysisFITopo>();
+    gep4<PointerAnalysisFITopo>();
+    gep5<PointerAnalysisFITopo>();
+    nulltest<PointerAnalysisFITopo>();
+    constant_store<PointerAnalysisFITopo>();
+    load_from_zeroed<PointerAnalysisFITopo>();
+    load_from_unknown_offset<PointerAnalysisFITopo>();
+    load_from_unknown_offset2<PointerAnalysisFITopo>();
+    load_from_unknown_offset3<PointerAnalysisFITopo>();
+    memcpy_test<PointerAnalysisFITopo>();
+    memcpy_test2<PointerAnalysisFITopo>();
+    memcpy_test3<PointerAnalysisFITopo>();
+    memcpy_test4<PointerAnalysisFITopo>();
+    memcpy_test5<PointerAnalysisFITopo>();
+    memcpy_test6<PointerAnalysisFITopo>();
+    memcpy_test7<PointerAnalysisFITopo>();
+    memcpy_test8<PointerAnalysisFITopo>();
+    copy_cycle<PointerAnalysisFITopo>();
+
+    for (bool loop : {false, true}) {
+        auto bfs = wide_graph<dg::pta::PointerAnalysisFI>(loop);
+        auto topo = wide_graph<PointerAnalysisFITopo>(loop);
+        REQUIRE(bfs.size() == topo.size());
+        for (size_t i = 0; i < bfs.size(); ++i)
+            REQUIRE(bfs[i] == topo[i]);
+    }
+}
+
+TEST_CASE("Topological order", "FI") {
+    // A -> B -> C -> D -> E
+    //      ^         |
+    //      +---------+
+    // and A -> E
+    PointerGraph PS;
+    PSNode *A = PS.create<PSNodeType::NOOP>();
+    PSNode *B = PS.create<PSNodeType::NOOP>();
+    PSNode *C = PS.create<PSNodeType::NOOP>();
+    PSNode *D = PS.create<PSNodeType::NOOP>();
+    PSNode *E = PS.create<PSNodeType::NOOP>();
+    A->addSuccessor(E);
+    A->addSuccessor(B);
+    B->addSuccessor(C);
+    C->addSuccessor(D);
+    D->addSuccessor(B);
+    D->addSuccessor(E);
+
+    PointerGraphTopoOrder order(&PS);
+    order.compute(A);
+    REQUIRE(order.getOrder() == std::vector<PSNode *>({A, B, C, D, E}));
+
+    // new nodes are put after the node from which they are reachable
+    PSNode *F = PS.create<PSNodeType::NOOP>();
+    PSNode *G = PS.create<PSNodeType::NOOP>();
+    C->addSuccessor(F);
+    F->addSuccessor(G);
+    G->addSuccessor(D);
+    REQUIRE(!order.hasPosition(F));
+    order.update(C);
+    REQUIRE(order.getOrder() ==
+            std::vector<PSNode *>({A, B, C, F, G, D, E}));
+
+    std::vector<PSNode *> nodes;
+    order.getReachableNodes({G, C}, nodes);
+    REQUIRE(nodes == std::vector<PSNode *>({B, C, F, G, D, E}));
+}
+
+template <typename PTStoT>
+void strong_update() {
+    PointerGraph PS;
+    PSNode *A = PS.create<PSNodeType::ALLOC>();
+    PSNode *B = PS.create<PSNodeType::ALLOC>();
+    PSNode *C = PS.create<PSNodeType::ALLOC>();
+    PSNode *S1 = PS.create<PSNodeType::STORE>(A, B);
+    PSNode *L1 = PS.create<PSNodeType::LOAD>(B);
+    PSNode *S2 = PS.create<PSNodeType::STORE>(C, B);
+    PSNode *L2 = PS.create<PSNodeType::LOAD>(B);
+
+    A->addSuccessor(B);
+    B->addSuccessor(C);
+    C->addSuccessor(S1);
+    S1->addSuccessor(L1);
+    L1->addSuccessor(S2);
+    S2->addSuccessor(L2);
+
+    auto *subg = PS.createSubgraph(A);
+    PS.setEntry(subg);
+    PTStoT PA(&PS);
+    PA.run();
+
+    REQUIRE(L1->pointsTo.size() == 1);
+    REQUIRE(L1->doesPointsTo(A));
+    REQUIRE(L2->pointsTo.size() == 1);
+    REQUIRE(L2->doesPointsTo(C));
+}
+
 TEST_CASE("Flow sensitive", "FS") {
     store_load<dg::pta::PointerAnalysisFS>();
     store_load2<dg::pta::PointerAnalysisFS>();
@@ -922,6 +1271,63 @@ TEST_CASE("Flow sensitive", "FS") {
     memcpy_test8<dg::pta::PointerAnalysisFS>();
 }
 
+TEST_CASE("Sparse flow sensitive", "SFS") {
+    store_load<dg::pta::PointerAnalysisSFS>();
+    store_load2<dg::pta::PointerAnalysisSFS>();
+    store_load3<dg::pta::PointerAnalysisSFS>();
+    store_load4<dg::pta::PointerAnalysisSFS>();
+    store_load5<dg::pta::PointerAnalysisSFS>();
+    gep1<dg::pta::PointerAnalysisSFS>();
+    gep2<dg::pta::PointerAnalysisSFS>();
+    gep3<dg::pta::PointerAnalysisSFS>();
+    gep4<dg::pta::PointerAnalysisSFS>();
+    gep5<dg::pta::PointerAnalysisSFS>();
+    nulltest<dg::pta::PointerAnalysisSFS>();
+    constant_store<dg::pta::PointerAnalysisSFS>();
+    load_from_zeroed<dg::pta::PointerAnalysisSFS>();
+    load_from_unknown_offset<dg::pta::PointerAnalysisSFS>();
+    load_from_unknown_offset2<dg::pta::PointerAnalysisSFS>();
+    load_from_unknown_offset3<dg::pta::PointerAnalysisSFS>();
+    memcpy_test<dg::pta::PointerAnalysisSFS>();
+    memcpy_test2<dg::pta::PointerAnalysisSFS>();
+    memcpy_test3<dg::pta::PointerAnalysisSFS>();
+    memcpy_test4<dg::pta::PointerAnalysisSFS>();
+    memcpy_test5<dg::pta::PointerAnalysisSFS>();
+    memcpy_test6<dg::pta::PointerAnalysisSFS>();
+    memcpy_test7<dg::pta::PointerAnalysisSFS>();
+    memcpy_test8<dg::pta::PointerAnalysisSFS>();
+    strong_update<dg::pta::PointerAnalysisFS>();
+    strong_update<dg::pta::PointerAnalysisSFS>();
+}
+
+TEST_CASE("Flow sensitive with persistent maps", "PFS") {
+    store_load<dg::pta::PointerAnalysisPFS>();
+    store_load2<dg::pta::PointerAnalysisPFS>();
+    store_load3<dg::pta::PointerAnalysisPFS>();
+    store_load4<dg::pta::PointerAnalysisPFS>();
+    store_load5<dg::pta::PointerAnalysisPFS>();
+    gep1<dg::pta::PointerAnalysisPFS>();
+    gep2<dg::pta::PointerAnalysisPFS>();
+    gep3<dg::pta::PointerAnalysisPFS>();
+    gep4<dg::pta::PointerAnalysisPFS>();
+    gep5<dg::pta::PointerAnalysisPFS>();
+    nulltest<dg::pta::PointerAnalysisPFS>();
+    constant_store<dg::pta::PointerAnalysisPFS>();
+    load_from_zeroed<dg::pta::PointerAnalysisPFS>();
+    load_from_unknown_offset<dg::pta::PointerAnalysisPFS>();
+    load_from_unknown_offset2<dg::pta::PointerAnalysisPFS>();
+    load_from_unknown_offset3<dg::pta::PointerAnalysisPFS>();
+    memcpy_test<dg::pta::PointerAnalysisPFS>();
+    memcpy_test2<dg::pta::PointerAnalysisPFS>();
+    memcpy_test3<dg::pta::PointerAnalysisPFS>();
+    memcpy_test4<dg::pta::PointerAnalysisPFS>();
+    memcpy_test5<dg::pta::PointerAnalysisPFS>();
+    memcpy_test6<dg::pta::PointerAnalysisPFS>();
+    memcpy_test7<dg::pta::PointerAnalysisPFS>();
+    memcpy_test8<dg::pta::PointerAnalysisPFS>();
+    strong_update<dg::pta::PointerAnalysisPFS>();
+}
+
 TEST_CASE("PSNode test", "PSNode") {
     using namespace dg::pta;
     PointerGraph PS;
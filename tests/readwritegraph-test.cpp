@@ -1,5 +1,8 @@
 #include <catch2/catch.hpp>
 
+#include <set>
+
+#include "dg/MemorySSA/ModRef.h"
 #include "dg/ReadWriteGraph/ReadWriteGraph.h"
 
 using namespace dg::dda;
@@ -89,3 +92,66 @@ TEST_CASE("split around in middle", "[RWBBlock]") {
     CHECK(blks.first->getSingleSuccessor() == blks.second.get());
     CHECK(blks.second->getSingleSuccessor() == &succ);
 }
+
+TEST_CASE("split blocks of a graph on calls", "[ReadWriteGraph]") {
+    ReadWriteGraph graph;
+    auto &callee = graph.createSubgraph();
+    callee.createBBlock().append(&graph.create(RWNodeType::RETURN));
+
+    auto &subg = graph.createSubgraph();
+    auto &block = subg.createBBlock();
+    auto &A = graph.create(RWNodeType::STORE);
+    auto *C = RWNodeCall::get(&graph.create(RWNodeType::CALL));
+    auto &B = graph.create(RWNodeType::LOAD);
+    C->addCallee(&callee);
+    block.append(&A);
+    block.append(C);
+    block.append(&B);
+
+    REQUIRE(graph.getNode(C->getID()) == C);
+
+    graph.splitBBlocksOnCalls();
+    REQUIRE(subg.size() == 3);
+    REQUIRE(subg.getRoot() == &A);
+    REQUIRE(C->getBBlock()->getSubgraph() == &subg);
+    REQUIRE(C->getBBlock()->size() == 1);
+    REQUIRE(B.getBBlock()->getSubgraph() == &subg);
+    REQUIRE(block.getSingleSuccessor() == C->getBBlock());
+    REQUIRE(C->getBBlock()->getSingleSuccessor() == B.getBBlock());
+}
+
+TEST_CASE("modref joins defined intervals", "[ModRefInfo]") {
+    ReadWriteGraph graph;
+    auto &A = graph.create(RWNodeType::ALLOC);
+    auto &B = graph.create(RWNodeType::ALLOC);
+    auto &S1 = graph.create(RWNodeType::STORE);
+    auto &S2 = graph.create(RWNodeType::STORE);
+
+    ModRefInfo modref;
+    modref.addMayDef(DefSite{&A, 0, 4}, &S1);
+    modref.addMayDef(DefSite{&A, 8, 4}, &S2);
+    modref.addMayDef(DefSite{&B, 0, 4}, &S1);
+    modref.addMayDef(DefSite{&B, 8, 4}, &S1);
+    // fills the gap between the intervals of A
+    modref.addMayDef(DefSite{&A, 4, 4}, &S1);
+    modref.addMayDef(DefSite{UNKNOWN_MEMORY, 0, 4}, &S2);
+
+    std::set<DefSite> defs;
+    modref.forEachMayDef([&defs](const DefSite &ds) { defs.insert(ds); });
+    const std::set<DefSite> expected{DefSite{&A, 0, 12}, DefSite{&B, 0, 4},
+                                     DefSite{&B, 8, 4}};
+    REQUIRE(defs == expected);
+    REQUIRE(modref.mayDefine(&A));
+    REQUIRE(modref.mayDefineUnknown());
+    REQUIRE(modref.getUnknownDefs() == std::set<RWNode *>{&S2});
+
+    ModRefInfo caller;
+    caller.addMayDef(DefSite{&B, 2, dg::Offset::UNKNOWN}, &S2);
+    caller.add(modref);
+    defs.clear();
+    caller.forEachMayDef([&defs](const DefSite &ds) { defs.insert(ds); });
+    const std::set<DefSite> joined{DefSite{&A, 0, 12},
+                                   DefSite{&B, 0, dg::Offset::UNKNOWN}};
+    REQUIRE(defs == joined);
+    REQUIRE(caller.getUnknownDefs() == std::set<RWNode *>{&S2});
+}
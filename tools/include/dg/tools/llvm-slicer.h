@@ -512,6 +512,12 @@ class ModuleAnnotator {
         case AnalysisType::fs:
             module_comment += "flow-sensitive\n";
             break;
+        case AnalysisType::sfs:
+            module_comment += "sparse flow-sensitive\n";
+            break;
+        case AnalysisType::pfs:
+            module_comment += "flow-sensitive with persistent memory maps\n";
+            break;
         case AnalysisType::inv:
             module_comment += "flow-sensitive with invalidate\n";
             break;
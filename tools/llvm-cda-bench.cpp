@@ -69,6 +69,11 @@ llvm::cl::opt<bool> ntscd2("ntscd2",
                            llvm::cl::desc("Benchmark NTSCD 2 (default=false)."),
                            llvm::cl::init(false), llvm::cl::cat(SlicingOpts));
 
+llvm::cl::opt<bool> ntscd_fast(
+        "ntscd-fast",
+        llvm::cl::desc("Benchmark the fast NTSCD (default=false)."),
+        llvm::cl::init(false), llvm::cl::cat(SlicingOpts));
+
 llvm::cl::opt<bool> ntscd_ranganath(
         "ntscd-ranganath",
         llvm::cl::desc(
@@ -308,6 +313,11 @@ int main(int argc, char *argv[]) {
                 dg::ControlDependenceAnalysisOptions::CDAlgorithm::NTSCD2;
         analyses.emplace_back("ntscd2", createAnalysis(M.get(), opts), 0);
     }
+    if (ntscd_fast) {
+        opts.algorithm =
+                dg::ControlDependenceAnalysisOptions::CDAlgorithm::NTSCD_FAST;
+        analyses.emplace_back("ntscd-fast", createAnalysis(M.get(), opts), 0);
+    }
     if (ntscd_ranganath) {
         opts.algorithm = dg::ControlDependenceAnalysisOptions::CDAlgorithm::
                 NTSCD_RANGANATH;
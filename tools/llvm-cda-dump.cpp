@@ -316,16 +316,13 @@ static void dumpIr(LLVMControlDependenceAnalysis &cda) {
         dump_graph(graph);
 
         if (cda.getOptions().ntscdCD() || cda.getOptions().ntscd2CD() ||
+            cda.getOptions().ntscdFastCD() ||
             cda.getOptions().ntscdRanganathCD()) {
             auto *ntscd = static_cast<dg::llvmdg::NTSCD *>(impl);
             const auto *info = ntscd->_getFunInfo(&f);
             if (info) {
                 for (auto *nd : *graph) {
-                    auto it = info->controlDependence.find(nd);
-                    if (it == info->controlDependence.end())
-                        continue;
-
-                    for (const auto *dep : it->second) {
+                    for (const auto *dep : info->controlDependence[nd]) {
                         // FIXME: for interproc CD this will not work as the
                         // nodes would be in a different graph
                         std::cout << " " << graph->getName() << "_"
@@ -341,11 +338,7 @@ static void dumpIr(LLVMControlDependenceAnalysis &cda) {
             const auto *info = dod->_getFunInfo(&f);
             if (info) {
                 for (auto *nd : *graph) {
-                    auto it = info->controlDependence.find(nd);
-                    if (it == info->controlDependence.end())
-                        continue;
-
-                    for (const auto *dep : it->second) {
+                    for (const auto *dep : info->controlDependence[nd]) {
                         std::cout << " " << graph->getName() << "_"
                                   << dep->getID() << " -> " << graph->getName()
                                   << "_" << nd->getID() << " [ color=red ]\n";
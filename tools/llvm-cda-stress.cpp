@@ -13,6 +13,7 @@
 #include "ControlDependence/DOD.h"
 #include "ControlDependence/DODNTSCD.h"
 #include "ControlDependence/NTSCD.h"
+#include "ControlDependence/NTSCDFast.h"
 
 using namespace dg;
 
@@ -52,6 +53,11 @@ llvm::cl::opt<bool> ntscd2("ntscd2",
                            llvm::cl::desc("Benchmark NTSCD 2 (default=false)."),
                            llvm::cl::init(false), llvm::cl::cat(SlicingOpts));
 
+llvm::cl::opt<bool> ntscd_fast(
+        "ntscd-fast",
+        llvm::cl::desc("Benchmark the fast NTSCD (default=false)."),
+        llvm::cl::init(false), llvm::cl::cat(SlicingOpts));
+
 llvm::cl::opt<bool> ntscd_ranganath(
         "ntscd-ranganath",
         llvm::cl::desc(
@@ -84,7 +90,8 @@ llvm::cl::opt<bool>
 llvm::cl::opt<bool> compare(
         "compare",
         llvm::cl::desc(
-                "Compare the resulting control dependencies (default=false)."),
+                "Compare the resulting control dependencies, currently "
+                "the fast NTSCD with NTSCD (default=false)."),
         llvm::cl::init(false), llvm::cl::cat(SlicingOpts));
 
 llvm::cl::opt<unsigned> Vn("nodes",
@@ -139,9 +146,10 @@ int main(int argc, char *argv[]) {
     generateRandomGraph(G, Vn, En);
 
     clock_t start, end, elapsed;
+    const auto threads = options.dgOptions.CDAOptions.computeThreads;
 
     if (ntscd) {
-        dg::NTSCD ntscd;
+        dg::NTSCD ntscd(threads);
         start = clock();
         ntscd.compute(G);
         end = clock();
@@ -151,7 +159,7 @@ int main(int argc, char *argv[]) {
                   << " s (" << elapsed << " ticks)\n";
     }
     if (ntscd2) {
-        dg::NTSCD2 ntscd;
+        dg::NTSCD2 ntscd(threads);
         start = clock();
         ntscd.compute(G);
         end = clock();
@@ -160,6 +168,25 @@ int main(int argc, char *argv[]) {
         std::cout << "ntscd: " << static_cast<float>(elapsed) / CLOCKS_PER_SEC
                   << " s (" << elapsed << " ticks)\n";
     }
+    if (ntscd_fast) {
+        dg::NTSCDFast ntscd;
+        start = clock();
+        auto result = ntscd.compute(G);
+        end = clock();
+        elapsed = end - start;
+
+        std::cout << "ntscd-fast: "
+                  << static_cast<float>(elapsed) / CLOCKS_PER_SEC << " s ("
+                  << elapsed << " ticks)\n";
+
+        if (compare) {
+            if (result != dg::NTSCD(threads).compute(G)) {
+                errs() << "ntscd-fast: the result differs from ntscd\n";
+                return 1;
+            }
+            std::cout << "ntscd-fast: the same result as ntscd\n";
+        }
+    }
     if (ntscd_ranganath) {
         dg::NTSCDRanganath ntscd;
         start = clock();
@@ -171,7 +198,7 @@ int main(int argc, char *argv[]) {
                   << " s (" << elapsed << " ticks)\n";
     }
     if (dod) {
-        dg::DOD dod;
+        dg::DOD dod(threads);
         start = clock();
         dod.compute(G);
         end = clock();
@@ -192,7 +219,7 @@ int main(int argc, char *argv[]) {
                   << elapsed << " ticks)\n";
     }
     if (dod_ntscd) {
-        dg::DODNTSCD ntscd;
+        dg::DODNTSCD ntscd(threads);
         start = clock();
         ntscd.compute(G);
         end = clock();
@@ -27,6 +27,7 @@
 #include "dg/llvm/CallGraph/CallGraph.h"
 #include "dg/llvm/PointerAnalysis/DGPointerAnalysis.h"
 #include "dg/llvm/PointerAnalysis/PointerAnalysis.h"
+#include "dg/llvm/PointerAnalysis/StoredPointerAnalysis.h"
 #include "dg/util/debug.h"
 
 using namespace dg;
@@ -89,7 +90,15 @@ int main(int argc, char *argv[]) {
             dumpCallGraph(CG);
         } else
 #endif // HAVE_SVF
-        {
+        if (ptaopts.isStored()) {
+            StoredPointerAnalysis PTA(M.get(), ptaopts);
+            PTA.run();
+
+            // there is no call graph from the analysis to re-use
+            llvmdg::CallGraph CG(M.get(), &PTA, /* lazy = */ true);
+            CG.build();
+            dumpCallGraph(CG);
+        } else {
             DGLLVMPointerAnalysis PTA(M.get(), ptaopts);
             PTA.run();
 
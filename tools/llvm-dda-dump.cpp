@@ -3,9 +3,11 @@
 #include <cstdio>
 #include <fstream>
 #include <iostream>
+#include <memory>
 #include <set>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 
 #include <llvm/IR/Instructions.h>
 #include <llvm/IR/LLVMContext.h>
@@ -25,6 +27,7 @@
 
 #include "dg/llvm/DataDependence/DataDependence.h"
 #include "dg/llvm/PointerAnalysis/PointerAnalysis.h"
+#include "dg/llvm/PointerAnalysis/StoredPointerAnalysis.h"
 
 #include "dg/tools/llvm-slicer-opts.h"
 #include "dg/tools/llvm-slicer-utils.h"
@@ -57,12 +60,29 @@ llvm::cl::opt<bool>
 llvm::cl::opt<bool> quiet("q", llvm::cl::desc("No output (for benchmarking)."),
                           llvm::cl::init(false), llvm::cl::cat(SlicingOpts));
 
+llvm::cl::opt<bool> stats("statistics",
+                          llvm::cl::desc("Dump statistics (default=false)."),
+                          llvm::cl::init(false), llvm::cl::cat(SlicingOpts));
+
 llvm::cl::opt<bool> dump_c_lines(
         "c-lines",
         llvm::cl::desc("Dump output as C lines (line:column where possible)."
                        "Requires metadata in the bitcode (default=false)."),
         llvm::cl::init(false), llvm::cl::cat(SlicingOpts));
 
+llvm::cl::opt<std::string> export_defuse(
+        "export-def-use",
+        llvm::cl::desc("Resolve uses one by one and stream the def-use pairs "
+                       "(IDs of LLVM values) into FILE (no other output)."),
+        llvm::cl::value_desc("FILE"), llvm::cl::init(""),
+        llvm::cl::cat(SlicingOpts));
+
+llvm::cl::opt<bool> export_binary(
+        "export-binary",
+        llvm::cl::desc("Export the def-use pairs as 32-bit little-endian "
+                       "integers instead of text lines (default=false)."),
+        llvm::cl::init(false), llvm::cl::cat(SlicingOpts));
+
 using VariablesMapTy = std::map<const llvm::Value *, CVariableDecl>;
 VariablesMapTy allocasToVars(const llvm::Module &M);
 VariablesMapTy valuesToVars;
@@ -609,6 +629,22 @@ class MemorySSADumper : public Dumper {
         dumpDDIMap(D->definitions);
         printf("<tr><td colspan=\"4\">==  kills ==</td></tr>");
         dumpDDIMap(D->kills);
+        if (D->scalars.empty())
+            return;
+        printf("<tr><td colspan=\"4\">==  scalars ==</td></tr>");
+        for (const auto &it : D->scalars) {
+            printf(R"(<tr><td align="left" colspan="4">)");
+            printName(it.first);
+            printf("</td></tr>");
+            DefinitionsMap<RWNode>::IntervalT interval(0, *it.second.len - 1);
+            for (auto *where : D->getScalarDefinitions(it.second)) {
+                printf("<tr><td>&nbsp;&nbsp;</td><td>");
+                printInterval(interval);
+                printf("</td><td>@</td><td>");
+                printName(where);
+                puts("</td></tr>");
+            }
+        }
     }
 
     void dumpSubgraphLabel(RWSubgraph *subgraph) override {
@@ -640,6 +676,132 @@ class MemorySSADumper : public Dumper {
             : Dumper(DDA, todot) {}
 };
 
+///
+// Write pairs (use, definition) into a file as the uses are resolved.
+// The values are identified by their position in the module: global
+// variables get IDs 0, 1, ... in the order of definition and the
+// instructions follow in the order of functions and their instructions.
+// With MemorySSA, the definitions of a use are released once they are
+// written and the cached definitions of phi nodes are released after
+// every function, so the memory does not grow with the size of the output
+// (only the phi nodes created by the searches are kept).
+class DefUseExporter {
+    LLVMDataDependenceAnalysis *DDA;
+    const llvm::Module *M;
+    std::unordered_map<const llvm::Value *, uint32_t> ids;
+    FILE *out;
+    // nullptr if the analysis is not MemorySSA
+    MemorySSATransformation *SSA{nullptr};
+
+    void number() {
+        uint32_t id = 0;
+        for (const auto &G : M->globals())
+            ids[&G] = id++;
+        for (const auto &F : *M) {
+            for (const auto &B : F) {
+                for (const auto &I : B)
+                    ids[&I] = id++;
+            }
+        }
+    }
+
+    static void writeLE(uint32_t x, FILE *out) {
+        unsigned char buf[4] = {
+                static_cast<unsigned char>(x),
+                static_cast<unsigned char>(x >> 8),
+                static_cast<unsigned char>(x >> 16),
+                static_cast<unsigned char>(x >> 24),
+        };
+        fwrite(buf, 1, sizeof(buf), out);
+    }
+
+    void write(uint32_t use, uint32_t def) {
+        if (export_binary) {
+            writeLE(use, out);
+            writeLE(def, out);
+        } else {
+            fprintf(out, "%u %u\n", use, def);
+        }
+    }
+
+  public:
+    DefUseExporter(LLVMDataDependenceAnalysis *DDA, const llvm::Module *M,
+                   FILE *out)
+            : DDA(DDA), M(M), out(out) {
+        if (DDA->getOptions().isSSA())
+            SSA = static_cast<MemorySSATransformation *>(
+                    DDA->getDDA()->getImpl());
+        number();
+    }
+
+    // return the number of written pairs
+    size_t run() {
+        size_t pairs = 0;
+        for (const auto &F : *M) {
+            for (const auto &B : F) {
+                for (const auto &I : B) {
+                    if (!DDA->isUse(&I))
+                        continue;
+                    auto *use = const_cast<llvm::Instruction *>(&I);
+                    auto useid = ids[&I];
+                    for (auto *def : DDA->getLLVMDefinitions(use)) {
+                        auto it = ids.find(def);
+                        if (it == ids.end()) {
+                            llvm::errs() << "WARNING: definition without ID: "
+                                         << *def << "\n";
+                            continue;
+                        }
+                        write(useid, it->second);
+                        ++pairs;
+                    }
+                    if (SSA)
+                        SSA->releaseDefinitions(DDA->getNode(use));
+                }
+            }
+            if (SSA)
+                SSA->releaseCachedDefinitions();
+        }
+        return pairs;
+    }
+};
+
+static int exportDefUse(LLVMDataDependenceAnalysis *DDA,
+                        const llvm::Module *M) {
+    FILE *out = fopen(export_defuse.c_str(), export_binary ? "wb" : "w");
+    if (!out) {
+        llvm::errs() << "Failed opening file: " << export_defuse << "\n";
+        return 1;
+    }
+
+    debug::TimeMeasure tm;
+    tm.start();
+    DefUseExporter exporter(DDA, M, out);
+    auto pairs = exporter.run();
+    tm.stop();
+
+    if (fclose(out) != 0) {
+        llvm::errs() << "Failed writing file: " << export_defuse << "\n";
+        return 1;
+    }
+
+    tm.report("INFO: Exporting " + std::to_string(pairs) +
+              " def-use pairs took");
+    return 0;
+}
+
+static void dumpStats(LLVMDataDependenceAnalysis *DDA) {
+    if (!DDA->getOptions().isSSA()) {
+        llvm::errs() << "Only MemorySSA analysis supports stats dumping\n";
+        return;
+    }
+
+    const auto *SSA = static_cast<MemorySSATransformation *>(
+            DDA->getDDA()->getImpl());
+    llvm::errs() << "Basic blocks: " << SSA->getBBlocksNum() << "\n";
+    llvm::errs() << "Basic blocks with LVN: " << SSA->getLvnBBlocksNum()
+                 << "\n";
+}
+
 static void dumpDefs(LLVMDataDependenceAnalysis *DDA, bool todot) {
     assert(DDA);
 
@@ -682,16 +844,22 @@ int main(int argc, char *argv[]) {
 
     debug::TimeMeasure tm;
 
-    DGLLVMPointerAnalysis PTA(M.get(), options.dgOptions.PTAOptions);
+    const auto &ptaopts = options.dgOptions.PTAOptions;
+    std::unique_ptr<LLVMPointerAnalysis> PTA;
+    if (ptaopts.isStored())
+        PTA.reset(new StoredPointerAnalysis(M.get(), ptaopts));
+    else
+        PTA.reset(new DGLLVMPointerAnalysis(M.get(), ptaopts));
 
     tm.start();
-    PTA.run();
+    PTA->run();
 
     tm.stop();
     tm.report("INFO: Pointer analysis took");
 
     tm.start();
-    LLVMDataDependenceAnalysis DDA(M.get(), &PTA, options.dgOptions.DDAOptions);
+    LLVMDataDependenceAnalysis DDA(M.get(), PTA.get(),
+                                   options.dgOptions.DDAOptions);
     if (graph_only) {
         DDA.buildGraph();
     } else {
@@ -713,7 +881,19 @@ int main(int argc, char *argv[]) {
         }
     }
 
-    dumpDefs(&DDA, todot);
+    int ret = 0;
+    if (!export_defuse.empty()) {
+        if (graph_only) {
+            llvm::errs() << "-export-def-use cannot be used with -graph-only\n";
+            return 1;
+        }
+        ret = exportDefUse(&DDA, M.get());
+    } else {
+        dumpDefs(&DDA, todot);
+    }
+
+    if (stats)
+        dumpStats(&DDA);
 
-    return 0;
+    return ret;
 }
@@ -54,6 +54,15 @@ llvm::cl::opt<bool> fi("fi", llvm::cl::desc("Run flow-insensitive PTA."),
 llvm::cl::opt<bool> fs("fs", llvm::cl::desc("Run flow-sensitive PTA."),
                        llvm::cl::init(false), llvm::cl::cat(SlicingOpts));
 
+llvm::cl::opt<bool> sfs("sfs",
+                        llvm::cl::desc("Run sparse flow-sensitive PTA."),
+                        llvm::cl::init(false), llvm::cl::cat(SlicingOpts));
+
+llvm::cl::opt<bool>
+        pfs("pfs",
+            llvm::cl::desc("Run flow-sensitive PTA with persistent memory maps."),
+            llvm::cl::init(false), llvm::cl::cat(SlicingOpts));
+
 llvm::cl::opt<bool> fsinv(
         "fsinv",
         llvm::cl::desc(
@@ -214,6 +223,18 @@ int main(int argc, char *argv[]) {
                 "DG FS", createAnalysis<DGLLVMPointerAnalysis>(M.get(), opts),
                 0);
     }
+    if (sfs) {
+        opts.analysisType = dg::LLVMPointerAnalysisOptions::AnalysisType::sfs;
+        analyses.emplace_back(
+                "DG SFS", createAnalysis<DGLLVMPointerAnalysis>(M.get(), opts),
+                0);
+    }
+    if (pfs) {
+        opts.analysisType = dg::LLVMPointerAnalysisOptions::AnalysisType::pfs;
+        analyses.emplace_back(
+                "DG PFS", createAnalysis<DGLLVMPointerAnalysis>(M.get(), opts),
+                0);
+    }
     if (fsinv) {
         opts.analysisType = dg::LLVMPointerAnalysisOptions::AnalysisType::inv;
         analyses.emplace_back(
@@ -23,6 +23,7 @@
 
 #include "dg/PointerAnalysis/Pointer.h"
 #include "dg/llvm/PointerAnalysis/PointerAnalysis.h"
+#include "dg/llvm/PointerAnalysis/StoredPointerAnalysis.h"
 
 #include "dg/tools/llvm-slicer-opts.h"
 #include "dg/tools/llvm-slicer-utils.h"
@@ -116,6 +117,12 @@ llvm::cl::opt<bool> dump_c_lines(
                        "Requires metadata in the bitcode (default=false)."),
         llvm::cl::init(false), llvm::cl::cat(SlicingOpts));
 
+llvm::cl::opt<std::string> store_results(
+        "pta-store",
+        llvm::cl::desc("Store the results of the analysis into the given file "
+                       "(that can be used with -pta-load)."),
+        llvm::cl::init(""), llvm::cl::cat(SlicingOpts));
+
 using VariablesMapTy = std::map<const llvm::Value *, CVariableDecl>;
 VariablesMapTy allocasToVars(const llvm::Module &M);
 VariablesMapTy valuesToVars;
@@ -300,41 +307,72 @@ static void dumpMemoryObject(MemoryObject *mo, int ind, bool dot) {
     }
 }
 
-static void dumpMemoryMap(PointerAnalysisFS::MemoryMapT *mm, int ind,
-                          bool dot) {
-    for (const auto &it : *mm) {
-        // print the key
-        if (!dot)
-            printf("%*s", ind, "");
+static void dumpMemoryMapEntry(PSNode *target, MemoryObject *mo, int ind,
+                               bool dot) {
+    // print the key
+    if (!dot)
+        printf("%*s", ind, "");
 
-        putchar('<');
-        printName(it.first, dot);
-        putchar('>');
+    putchar('<');
+    printName(target, dot);
+    putchar('>');
 
-        if (dot)
-            printf("\\l");
-        else
-            putchar('\n');
+    if (dot)
+        printf("\\l");
+    else
+        putchar('\n');
 
-        dumpMemoryObject(it.second.get(), ind + 4, dot);
+    dumpMemoryObject(mo, ind + 4, dot);
+}
+
+static void dumpMemoryMap(PointerAnalysisFS::MemoryMapT *mm, int ind,
+                          bool dot) {
+    for (const auto &it : *mm) {
+        dumpMemoryMapEntry(it.first, it.second.get(), ind, dot);
     }
 }
 
+static void dumpMemoryMap(PointerAnalysisPFS::PersistentMemoryMapT *mm,
+                          int ind, bool dot) {
+    mm->forEach([ind, dot](PSNode *target, MemoryObject *mo) {
+        dumpMemoryMapEntry(target, mo, ind, dot);
+    });
+}
+
+template <typename MemoryMapT>
 static bool mmChanged(PSNode *n) {
     if (n->predecessorsNum() == 0)
         return true;
 
-    PointerAnalysisFS::MemoryMapT *mm =
-            n->getData<PointerAnalysisFS::MemoryMapT>();
+    MemoryMapT *mm = n->getData<MemoryMapT>();
 
     for (PSNode *pred : n->predecessors()) {
-        if (pred->getData<PointerAnalysisFS::MemoryMapT>() != mm)
+        if (pred->getData<MemoryMapT>() != mm)
             return true;
     }
 
     return false;
 }
 
+template <typename MemoryMapT>
+static void dumpMemoryMapData(PSNode *n, bool dot) {
+    MemoryMapT *mm = n->getData<MemoryMapT>();
+    if (!mm)
+        return;
+
+    if (dot)
+        printf(R"(\n------\n    --- Memory map [%p] ---\n)",
+               static_cast<void *>(mm));
+    else
+        printf("    Memory map: [%p]\n", static_cast<void *>(mm));
+
+    if (verbose_more || mmChanged<MemoryMapT>(n))
+        dumpMemoryMap(mm, 6, dot);
+
+    if (!dot)
+        printf("    ----------------\n");
+}
+
 static void dumpPointerGraphData(PSNode *n, PTType type, bool dot = false) {
     assert(n && "No node given");
     if (type == dg::LLVMPointerAnalysisOptions::AnalysisType::fi) {
@@ -351,27 +389,16 @@ static void dumpPointerGraphData(PSNode *n, PTType type, bool dot = false) {
 
         if (!dot)
             printf("    -----------\n");
+    } else if (type == dg::LLVMPointerAnalysisOptions::AnalysisType::pfs) {
+        dumpMemoryMapData<PointerAnalysisPFS::PersistentMemoryMapT>(n, dot);
     } else {
-        PointerAnalysisFS::MemoryMapT *mm =
-                n->getData<PointerAnalysisFS::MemoryMapT>();
-        if (!mm)
-            return;
-
-        if (dot)
-            printf(R"(\n------\n    --- Memory map [%p] ---\n)",
-                   static_cast<void *>(mm));
-        else
-            printf("    Memory map: [%p]\n", static_cast<void *>(mm));
-
-        if (verbose_more || mmChanged(n))
-            dumpMemoryMap(mm, 6, dot);
-
-        if (!dot)
-            printf("    ----------------\n");
+        dumpMemoryMapData<PointerAnalysisFS::MemoryMapT>(n, dot);
     }
 }
 
-static void dumpPSNode(PSNode *n, PTType type) {
+// 'rep' is the node that keeps the points-to set of 'n'
+// (it differs from 'n' if 'n' was merged into another node)
+static void dumpPSNode(PSNode *n, const PSNode *rep, PTType type) {
     printf("NODE %3u: ", n->getID());
     printName(n);
 
@@ -381,9 +408,12 @@ static void dumpPSNode(PSNode *n, PTType type) {
         printf(" [size: %zu, heap: %u, zeroed: %u]", alloc->getSize(),
                alloc->isHeap(), alloc->isZeroInitialized());
 
-    printf(" (points-to size: %zu)\n", n->pointsTo.size());
+    if (rep != n)
+        printf(" (merged into %u)", rep->getID());
+
+    printf(" (points-to size: %zu)\n", rep->pointsTo.size());
 
-    for (const Pointer &ptr : n->pointsTo) {
+    for (const Pointer &ptr : rep->pointsTo) {
         printf("    -> ");
         printName(ptr.target, false);
         if (ptr.offset.isUnknown())
@@ -599,7 +629,8 @@ static void dumpPointerGraph(DGLLVMPointerAnalysis *pta, PTType type) {
         const auto &nodes = pta->getNodes();
         for (const auto &node : nodes) {
             if (node) // node id 0 is nullptr
-                dumpPSNode(node.get(), type);
+                dumpPSNode(node.get(),
+                           pta->getPS()->getRepresentative(node.get()), type);
         }
     }
 }
@@ -810,6 +841,11 @@ int main(int argc, char *argv[]) {
     }
 #endif
 
+    if (opts.isStored() && dump_ir) {
+        llvm::errs() << "Stored results do not contain the IR of the analysis\n";
+        return 1;
+    }
+
     if (!dump_ir) {
         std::unique_ptr<LLVMPointerAnalysis> llvmpta;
 
@@ -818,6 +854,9 @@ int main(int argc, char *argv[]) {
             llvmpta.reset(new SVFPointerAnalysis(M.get(), opts));
         else
 #endif
+        if (opts.isStored())
+            llvmpta.reset(new StoredPointerAnalysis(M.get(), opts));
+        else
             llvmpta.reset(new DGLLVMPointerAnalysis(M.get(), opts));
 
         tm.start();
@@ -825,9 +864,18 @@ int main(int argc, char *argv[]) {
         tm.stop();
         tm.report("INFO: Pointer analysis took");
 
+        if (!store_results.empty()) {
+            tm.start();
+            if (!StoredPointerAnalysis::store(*llvmpta, M.get(),
+                                              store_results))
+                return 1;
+            tm.stop();
+            tm.report("INFO: Storing the results took");
+        }
+
         if (_stats) {
-            if (opts.isSVF()) {
-                llvm::errs() << "SVF analysis does not support stats dumping\n";
+            if (!opts.isDG()) {
+                llvm::errs() << "Only DG analyses support stats dumping\n";
             } else {
                 dumpStats(static_cast<DGLLVMPointerAnalysis *>(llvmpta.get()));
             }
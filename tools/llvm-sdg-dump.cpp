@@ -1,6 +1,7 @@
 #include <cassert>
 #include <fstream>
 #include <iostream>
+#include <memory>
 #include <set>
 #include <string>
 #include <vector>
@@ -21,6 +22,7 @@
 #include <llvm/IR/LLVMContext.h>
 #include <llvm/Support/raw_ostream.h>
 
+#include "dg/llvm/PointerAnalysis/StoredPointerAnalysis.h"
 #include "dg/llvm/SystemDependenceGraph/SDG2Dot.h"
 #include "dg/util/debug.h"
 
@@ -92,14 +94,20 @@ int main(int argc, char *argv[]) {
         return 1;
     }
 
-    DGLLVMPointerAnalysis PTA(M.get(), options.dgOptions.PTAOptions);
-    PTA.run();
-    LLVMDataDependenceAnalysis DDA(M.get(), &PTA, options.dgOptions.DDAOptions);
+    const auto &ptaopts = options.dgOptions.PTAOptions;
+    std::unique_ptr<LLVMPointerAnalysis> PTA;
+    if (ptaopts.isStored())
+        PTA.reset(new StoredPointerAnalysis(M.get(), ptaopts));
+    else
+        PTA.reset(new DGLLVMPointerAnalysis(M.get(), ptaopts));
+    PTA->run();
+    LLVMDataDependenceAnalysis DDA(M.get(), PTA.get(),
+                                   options.dgOptions.DDAOptions);
     DDA.run();
     LLVMControlDependenceAnalysis CDA(M.get(), options.dgOptions.CDAOptions);
     // CDA runs on-demand
 
-    llvmdg::SystemDependenceGraph sdg(M.get(), &PTA, &DDA, &CDA);
+    llvmdg::SystemDependenceGraph sdg(M.get(), PTA.get(), &DDA, &CDA);
 
     SDGDumper dumper(options, &sdg, dump_bb_only);
     dumper.dumpToDot();
@@ -136,6 +136,22 @@ SlicerOptions parseSlicerOptions(int argc, char *argv[], bool requireCrit,
                     "true.\n"),
             llvm::cl::init(true), llvm::cl::cat(SlicingOpts));
 
+    llvm::cl::opt<unsigned> cdaThreads(
+            "cda-threads",
+            llvm::cl::desc("Compute NTSCD and DOD of every node of a function "
+                           "in parallel using N threads (default=1).\n"),
+            llvm::cl::value_desc("N"), llvm::cl::init(1),
+            llvm::cl::cat(SlicingOpts));
+
+    llvm::cl::opt<std::string> cdaCacheDir(
+            "cda-cache",
+            llvm::cl::desc("Cache control dependencies of functions in the "
+                           "given directory and reuse them in later runs "
+                           "(not used by the standard CD and with "
+                           "-cda-icfg)."),
+            llvm::cl::value_desc("DIR"), llvm::cl::init(""),
+            llvm::cl::cat(SlicingOpts));
+
     llvm::cl::opt<bool> cdaPerInstr(
             "cda-per-inst",
             llvm::cl::desc("Compute control dependencies per instruction (the "
@@ -162,6 +178,42 @@ SlicerOptions parseSlicerOptions(int argc, char *argv[], bool requireCrit,
             llvm::cl::value_desc("N"), llvm::cl::init(dg::Offset::UNKNOWN),
             llvm::cl::cat(SlicingOpts));
 
+    llvm::cl::opt<unsigned> ptaSolverThreads(
+            "pta-solver-threads",
+            llvm::cl::desc("Number of threads used to solve the "
+                           "flow-insensitive pointer analysis (default=1).\n"),
+            llvm::cl::value_desc("N"), llvm::cl::init(1),
+            llvm::cl::cat(SlicingOpts));
+
+    llvm::cl::opt<bool> ptaDiffPropagation(
+            "pta-diff-propagation",
+            llvm::cl::desc("Propagate only differences of points-to sets "
+                           "in the flow-insensitive pointer analysis "
+                           "(default=false).\n"),
+            llvm::cl::init(false), llvm::cl::cat(SlicingOpts));
+
+    llvm::cl::opt<bool> ptaCollapseCycles(
+            "pta-collapse-cycles",
+            llvm::cl::desc("Collapse cycles of PHI and cast nodes found "
+                           "while solving the pointer analysis "
+                           "(default=false).\n"),
+            llvm::cl::init(false), llvm::cl::cat(SlicingOpts));
+
+    llvm::cl::opt<bool> ptaTopoOrder(
+            "pta-topo-order",
+            llvm::cl::desc("Process the nodes of the pointer analysis in "
+                           "the topological order of the graph computed "
+                           "once before solving (default=false).\n"),
+            llvm::cl::init(false), llvm::cl::cat(SlicingOpts));
+
+    llvm::cl::opt<std::string> ptaLoad(
+            "pta-load",
+            llvm::cl::desc("Load the results of pointer analysis from the "
+                           "given file\n"
+                           "(created by llvm-pta-dump -pta-store) instead "
+                           "of running the analysis.\n"),
+            llvm::cl::init(""), llvm::cl::cat(SlicingOpts));
+
     llvm::cl::opt<dg::dda::UndefinedFunsBehavior> undefinedFunsBehavior(
             "undefined-funs",
             llvm::cl::desc("Set the behavior of undefined functions\n"),
@@ -231,6 +283,12 @@ SlicerOptions parseSlicerOptions(int argc, char *argv[], bool requireCrit,
                                "fi", "Flow-insensitive PTA (default)"),
                     clEnumValN(LLVMPointerAnalysisOptions::AnalysisType::fs,
                                "fs", "Flow-sensitive PTA"),
+                    clEnumValN(LLVMPointerAnalysisOptions::AnalysisType::sfs,
+                               "sfs",
+                               "Flow-sensitive PTA with sparse memory state"),
+                    clEnumValN(LLVMPointerAnalysisOptions::AnalysisType::pfs,
+                               "pfs",
+                               "Flow-sensitive PTA with persistent memory maps"),
                     clEnumValN(LLVMPointerAnalysisOptions::AnalysisType::inv,
                                "inv", "PTA with invalidate nodes")
 #ifdef HAVE_SVF
@@ -262,6 +320,28 @@ SlicerOptions parseSlicerOptions(int argc, char *argv[], bool requireCrit,
                     LLVMDataDependenceAnalysisOptions::AnalysisType::ssa),
             llvm::cl::cat(SlicingOpts));
 
+    llvm::cl::opt<unsigned> ddaThreads(
+            "dda-threads",
+            llvm::cl::desc("Compute data dependencies of all instructions "
+                           "at once using N threads (default=0, "
+                           "compute them on demand).\n"),
+            llvm::cl::value_desc("N"), llvm::cl::init(0),
+            llvm::cl::cat(SlicingOpts));
+
+    llvm::cl::opt<bool> ddaSummaries(
+            "dda-summaries",
+            llvm::cl::desc("Compute summaries of all functions bottom-up "
+                           "over the call graph before searching data "
+                           "dependencies (in parallel with -dda-threads).\n"),
+            llvm::cl::init(false), llvm::cl::cat(SlicingOpts));
+
+    llvm::cl::opt<bool> ddaScalars(
+            "dda-scalars",
+            llvm::cl::desc("Track local variables that are always "
+                           "overwritten as a whole only by their last "
+                           "definition (default=false).\n"),
+            llvm::cl::init(false), llvm::cl::cat(SlicingOpts));
+
     llvm::cl::opt<dg::ControlDependenceAnalysisOptions::CDAlgorithm>
             cdAlgorithm(
                     "cda",
@@ -288,6 +368,12 @@ SlicerOptions parseSlicerOptions(int argc, char *argv[], bool requireCrit,
                                        "Non-termination sensitive control "
                                        "dependencies algorithm (a different "
                                        "implementation)"),
+                            clEnumValN(dg::ControlDependenceAnalysisOptions::
+                                               CDAlgorithm::NTSCD_FAST,
+                                       "ntscd-fast",
+                                       "Non-termination sensitive control "
+                                       "dependencies algorithm (near-linear "
+                                       "implementation)"),
                             clEnumValN(dg::ControlDependenceAnalysisOptions::
                                                CDAlgorithm::NTSCD_RANGANATH,
                                        "ntscd-ranganath",
@@ -411,6 +497,8 @@ SlicerOptions parseSlicerOptions(int argc, char *argv[], bool requireCrit,
 
     CDAOptions.algorithm = cdAlgorithm;
     CDAOptions.interprocedural = interprocCd;
+    CDAOptions.computeThreads = cdaThreads;
+    CDAOptions.cacheDir = cdaCacheDir;
     CDAOptions._icfg = icfgCD;
     CDAOptions.setNodePerInstruction(cdaPerInstr);
 
@@ -420,11 +508,19 @@ SlicerOptions parseSlicerOptions(int argc, char *argv[], bool requireCrit,
     PTAOptions.fieldSensitivity = dg::Offset(ptaFieldSensitivity);
     PTAOptions.analysisType = ptaType;
     PTAOptions.threads = threads;
+    PTAOptions.solverThreads = ptaSolverThreads;
+    PTAOptions.differencePropagation = ptaDiffPropagation;
+    PTAOptions.collapseCycles = ptaCollapseCycles;
+    PTAOptions.topologicalScheduling = ptaTopoOrder;
+    PTAOptions.storedResults = ptaLoad;
 
     DDAOptions.threads = threads;
     DDAOptions.entryFunction = entryFunction;
     DDAOptions.undefinedFunsBehavior = undefinedFunsBehavior;
     DDAOptions.analysisType = ddaType;
+    DDAOptions.eagerThreads = ddaThreads;
+    DDAOptions.summaries = ddaSummaries;
+    DDAOptions.scalarObjects = ddaScalars;
 
     return options;
 }